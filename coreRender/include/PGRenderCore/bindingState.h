@@ -0,0 +1,44 @@
+#pragma once
+#include <algorithm>
+#include <span>
+#include <utility>
+#include <cstddef>
+
+namespace pgrender {
+
+    /**
+     * @brief Tramo [first, last) de unidades o bindings que han cambiado.
+     */
+    struct DirtyRange {
+        size_t first = 0;
+        size_t last = 0;
+
+        bool empty() const { return first >= last; }
+        size_t count() const { return empty() ? 0 : last - first; }
+    };
+
+    /**
+     * @brief Actualiza la copia del estado de binding de unidades consecutivas.
+     *
+     * Compara cada entrada nueva (resolve(i), del tipo Slot) con la guardada en slots[i],
+     * guarda las que cambian y devuelve el menor tramo que las contiene. Un backend envía sólo
+     * ese tramo con una llamada multi-bind (glBindTextures, glBindSamplers,
+     * glBindBuffersRange...), leyendo de slots también las entradas intermedias sin cambios.
+     * Slot debe poder compararse con ==.
+     */
+    template <typename Slot, typename Resolve>
+    DirtyRange updateBindingSlots(std::span<Slot> slots, Resolve&& resolve) {
+        DirtyRange dirty{ slots.size(), 0 };
+        for (size_t i = 0; i < slots.size(); ++i) {
+            Slot slot = resolve(i);
+            if (slots[i] == slot) {
+                continue;
+            }
+            slots[i] = std::move(slot);
+            dirty.first = std::min(dirty.first, i);
+            dirty.last = i + 1;
+        }
+        return dirty;
+    }
+
+} // namespace pgrender
@@ -0,0 +1,91 @@
+#pragma once
+#include "texture.h"
+#include "sampler.h"
+
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    /**
+     * @brief Gestiona la residencia de los handles bindless de texturas.
+     *
+     * Cada frame se registran con use() las combinaciones textura + sampler que usan los shaders;
+     * nextFrame() hace no residentes los handles que llevan más de maxUnusedFrames sin usarse,
+     * liberando la memoria de GPU que el driver mantiene fijada para ellos.
+     * maxUnusedFrames debe cubrir los frames en vuelo, ya que la GPU puede seguir leyendo
+     * un handle de un frame anterior.
+     */
+    class BindlessResidencyManager {
+    public:
+        /**
+         * @brief Estadísticas de residencia.
+         */
+        struct Statistics {
+            uint32_t residentHandles = 0;   ///< Handles residentes actualmente
+            uint64_t madeResident = 0;      ///< Veces que un handle se ha hecho residente
+            uint64_t evictions = 0;         ///< Handles hechos no residentes por envejecimiento
+        };
+
+        /**
+         * @param maxUnusedFrames Frames que un handle sin usar se mantiene residente.
+         */
+        explicit BindlessResidencyManager(uint32_t maxUnusedFrames = 3);
+        ~BindlessResidencyManager();
+
+        BindlessResidencyManager(const BindlessResidencyManager&) = delete;
+        BindlessResidencyManager& operator=(const BindlessResidencyManager&) = delete;
+
+        /**
+         * @brief Marca la combinación textura + sampler como usada en el frame actual.
+         * @return Handle bindless residente, listo para escribirse en un buffer.
+         */
+        uint64_t use(const std::shared_ptr<Texture>& texture, const std::shared_ptr<Sampler>& sampler = nullptr);
+
+        /**
+         * @brief Avanza el contador de frames y hace no residentes los handles
+         * que llevan más de maxUnusedFrames sin usarse.
+         */
+        void nextFrame();
+
+        /**
+         * @brief Hace no residentes todos los handles y deja de seguirlos.
+         */
+        void releaseAll();
+
+        void setMaxUnusedFrames(uint32_t frames) { m_maxUnusedFrames = frames; }
+        uint32_t getMaxUnusedFrames() const { return m_maxUnusedFrames; }
+
+        /**
+         * @brief Obtiene las estadísticas de residencia.
+         */
+        const Statistics& getStatistics() const { return m_statistics; }
+
+    private:
+        struct Key {
+            const Texture* texture;
+            const Sampler* sampler;
+
+            bool operator==(const Key& other) const = default;
+        };
+
+        struct KeyHasher {
+            size_t operator()(const Key& key) const;
+        };
+
+        struct Entry {
+            std::shared_ptr<Texture> texture;
+            std::shared_ptr<Sampler> sampler;
+            uint64_t handle = 0;
+            uint64_t lastUsedFrame = 0;
+        };
+
+        uint32_t m_maxUnusedFrames;
+        uint64_t m_frame = 0;
+        std::unordered_map<Key, Entry, KeyHasher> m_entries;
+        Statistics m_statistics;
+    };
+
+} // namespace pgrender
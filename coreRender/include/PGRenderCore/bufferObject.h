@@ -1,5 +1,6 @@
 #pragma once
 #include "core.h"
+#include "handle.h"
 
 #include <cstdint>
 #include <memory>
@@ -15,7 +16,8 @@ namespace pgrender {
         Uniform,          ///< Uniform Buffer Object (UBO)
         ShaderStorage,    ///< Shader Storage Buffer Object (SSBO)
         TransferSrc,      ///< Buffer fuente para transferencias
-        TransferDst       ///< Buffer destino para transferencias
+        TransferDst,      ///< Buffer destino para transferencias
+        Indirect          ///< Buffer de comandos indirectos (dispatch/draw)
     };
 
     /**
@@ -127,4 +129,22 @@ namespace pgrender {
         CAST_HELPERS
     };
 
+    /**
+     * @brief Rango de un buffer para los bindings por lotes de Context.
+     */
+    struct BufferRange {
+        std::shared_ptr<BufferObject> buffer;   ///< nullptr desvincula el binding
+        size_t offset = 0;
+        size_t size = 0;                        ///< 0 = hasta el final del buffer
+    };
+
+    /**
+     * @brief Rango de un buffer creado con Context::createBufferHandle.
+     */
+    struct BufferHandleRange {
+        BufferHandle buffer;                    ///< Handle nulo desvincula el binding
+        size_t offset = 0;
+        size_t size = 0;                        ///< 0 = hasta el final del buffer
+    };
+
 } // namespace pgrender
@@ -1,6 +1,7 @@
 #pragma once
 #include "bufferObject.h"
 #include "texture.h"
+#include "formatInfo.h"
 #include "sampler.h"
 #include "pipeline.h"
 #include "renderTarget.h"
@@ -12,6 +13,7 @@
 #include "RayTracingStructures.h"
 //#include "RayTracingPipeline.h"
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <cstdint>
 #include <glm/vec4.hpp>
@@ -43,6 +45,65 @@ namespace pgrender {
 		return static_cast<uint32_t>(flags) == 0;
 	}
 
+	/**
+	 * @brief Modo de acceso de un shader a una imagen vinculada con Context::bindImage.
+	 */
+	enum class ImageAccess {
+		ReadOnly,
+		WriteOnly,
+		ReadWrite
+	};
+
+	/**
+	 * @brief Flags de barrera de memoria.
+	 * Indican qu tipo de accesos posteriores deben ver las escrituras
+	 * realizadas por shaders (imgenes, SSBOs, atmicos) antes de la barrera.
+	 */
+	enum class BarrierFlags : uint32_t {
+		None = 0,
+		VertexAttribArray = 1 << 0,   ///< Lectura de atributos de vrtice desde buffers
+		ElementArray = 1 << 1,        ///< Lectura de ndices
+		Uniform = 1 << 2,             ///< Lectura de UBOs
+		TextureFetch = 1 << 3,        ///< Muestreo de texturas
+		ShaderImageAccess = 1 << 4,   ///< Acceso a imgenes (imageLoad/imageStore)
+		Command = 1 << 5,             ///< Lectura de comandos indirectos (dispatch/draw)
+		PixelBuffer = 1 << 6,         ///< Transferencias pixel pack/unpack
+		TextureUpdate = 1 << 7,       ///< Actualizacin/lectura de texturas desde CPU
+		BufferUpdate = 1 << 8,        ///< Actualizacin/copia/mapeo de buffers
+		Framebuffer = 1 << 9,         ///< Lectura/escritura de framebuffers
+		AtomicCounter = 1 << 10,      ///< Contadores atmicos
+		ShaderStorage = 1 << 11,      ///< Acceso a SSBOs
+		All = 0xFFFFFFFF
+	};
+
+	inline BarrierFlags operator|(BarrierFlags a, BarrierFlags b) {
+		return static_cast<BarrierFlags>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+	}
+
+	inline BarrierFlags operator&(BarrierFlags a, BarrierFlags b) {
+		return static_cast<BarrierFlags>(static_cast<uint32_t>(a) & static_cast<uint32_t>(b));
+	}
+
+	/**
+	 * @brief Comando de dibujo indexado indirecto, tal y como se almacena en un buffer BufferType::Indirect.
+	 */
+	struct DrawIndexedIndirectCommand {
+		uint32_t indexCount;
+		uint32_t instanceCount;
+		uint32_t firstIndex;
+		int32_t vertexOffset;
+		uint32_t firstInstance;
+	};
+
+	/**
+	 * @brief Comando de dispatch indirecto, tal y como se almacena en un buffer BufferType::Indirect.
+	 */
+	struct DispatchIndirectCommand {
+		uint32_t numGroupsX;
+		uint32_t numGroupsY;
+		uint32_t numGroupsZ;
+	};
+
 	/**
 	 * @brief Contexto de renderizado abstracto.
 	 * No depende de ningn framework externo (SDL, GLFW, etc.).
@@ -83,6 +144,14 @@ namespace pgrender {
 		 */
 		virtual void swapBuffers() = 0;
 
+		/**
+		 * @brief Marca el final de un frame. Los recursos destruidos durante l liberan sus
+		 * objetos nativos cuando la GPU termina los comandos enviados hasta aqu.
+		 * swapBuffers() lo llama; hay que llamarlo si se presenta por otra va (p.ej. el
+		 * GraphicsContext de la ventana) o se renderiza sin presentar.
+		 */
+		virtual void endFrame() = 0;
+
 		// ===== FBRICAS DE RECURSOS =====
 
 		virtual std::shared_ptr<BufferObject> createBufferObject(const BufferObject::Desc& desc) = 0;
@@ -115,6 +184,19 @@ namespace pgrender {
 		virtual void bindTexture(const std::shared_ptr<Texture>& texture, uint32_t slot = 0) = 0;
 		virtual void bindSampler(const std::shared_ptr<Sampler>& sampler, uint32_t slot = 0) = 0;
 
+		/**
+		 * @brief Vincula texturas en unidades consecutivas desde firstSlot con una sola llamada.
+		 * Las unidades que ya tienen la misma textura no se vuelven a vincular.
+		 * @param textures Texturas; nullptr desvincula su unidad.
+		 */
+		virtual void bindTextures(uint32_t firstSlot, std::span<const std::shared_ptr<Texture>> textures) = 0;
+
+		/**
+		 * @brief Vincula samplers en unidades consecutivas desde firstSlot con una sola llamada.
+		 * @param samplers Samplers; nullptr desvincula su unidad.
+		 */
+		virtual void bindSamplers(uint32_t firstSlot, std::span<const std::shared_ptr<Sampler>> samplers) = 0;
+
 		virtual void bindUniformBuffer(const std::shared_ptr<BufferObject>& buffer,
 			uint32_t binding,
 			size_t offset = 0,
@@ -125,8 +207,71 @@ namespace pgrender {
 			size_t offset = 0,
 			size_t size = 0) = 0;
 
-		virtual std::shared_ptr<BufferObject> getBoundUniformBuffer(uint32_t binding) const = 0;
-		virtual std::shared_ptr<BufferObject> getBoundShaderStorageBuffer(uint32_t binding) const = 0;
+		/**
+		 * @brief Buffer vinculado a un binding, o nullptr. El estado de binding no es
+		 * propietario: quien vincula un recurso debe mantenerlo vivo mientras lo use.
+		 */
+		virtual BufferObject* getBoundUniformBuffer(uint32_t binding) const = 0;
+		virtual BufferObject* getBoundShaderStorageBuffer(uint32_t binding) const = 0;
+
+		/**
+		 * @brief Vincula varios rangos de uniform buffers en bindings consecutivos con una sola llamada.
+		 * @param firstBinding Binding del primer rango.
+		 * @param ranges Rangos; sus offsets deben ser mltiplos de getUniformBufferOffsetAlignment().
+		 * Size 0 cubre desde offset hasta el final del buffer.
+		 * @throws std::out_of_range si un rango se sale del buffer.
+		 */
+		virtual void bindUniformBuffers(uint32_t firstBinding, std::span<const BufferRange> ranges) = 0;
+
+		/**
+		 * @brief Vincula varios rangos de storage buffers en bindings consecutivos con una sola llamada.
+		 */
+		virtual void bindShaderStorageBuffers(uint32_t firstBinding, std::span<const BufferRange> ranges) = 0;
+
+		/**
+		 * @brief Alineacin exigida al offset de los rangos de uniform buffers.
+		 */
+		virtual size_t getUniformBufferOffsetAlignment() const = 0;
+
+		// ===== RECURSOS POR HANDLE =====
+		// Alternativa a las fbricas con shared_ptr para los caminos calientes. El contexto es
+		// propietario del recurso y lo guarda en un pool contiguo; resolver un handle al
+		// vincularlo es un ndice y una comparacin de generacin, sin contadores de referencias
+		// ni comprobaciones de backend. Estos recursos no se pueden pasar a las APIs que
+		// reciben shared_ptr.
+
+		/**
+		 * @brief Crea un recurso propiedad del contexto, que vive hasta destroy().
+		 */
+		virtual BufferHandle createBufferHandle(const BufferObject::Desc& desc) = 0;
+		virtual TextureHandle createTextureHandle(const Texture::Desc& desc) = 0;
+		virtual SamplerHandle createSamplerHandle(const Sampler::Desc& desc) = 0;
+
+		/**
+		 * @brief Destruye el recurso e invalida sus handles. El objeto nativo se borra cuando
+		 * la GPU termina los comandos que lo usan (ver endFrame()).
+		 * @return false si el handle era nulo o ya no era vlido.
+		 */
+		virtual bool destroy(BufferHandle buffer) = 0;
+		virtual bool destroy(TextureHandle texture) = 0;
+		virtual bool destroy(SamplerHandle sampler) = 0;
+
+		/**
+		 * @brief Recurso de un handle (para actualizarlo, mapearlo, etc.), o nullptr si el
+		 * handle ya no es vlido. El puntero deja de ser vlido con destroy().
+		 */
+		virtual BufferObject* getBuffer(BufferHandle buffer) const = 0;
+		virtual Texture* getTexture(TextureHandle texture) const = 0;
+		virtual Sampler* getSampler(SamplerHandle sampler) const = 0;
+
+		/**
+		 * @brief Equivalentes por handle de los binds mltiples; un handle nulo desvincula.
+		 * @throws std::invalid_argument si un handle no nulo ya no es vlido.
+		 */
+		virtual void bindTextures(uint32_t firstSlot, std::span<const TextureHandle> textures) = 0;
+		virtual void bindSamplers(uint32_t firstSlot, std::span<const SamplerHandle> samplers) = 0;
+		virtual void bindUniformBuffers(uint32_t firstBinding, std::span<const BufferHandleRange> ranges) = 0;
+		virtual void bindShaderStorageBuffers(uint32_t firstBinding, std::span<const BufferHandleRange> ranges) = 0;
 
 		// ===== OPERACIONES DE LIMPIEZA =====
 
@@ -165,6 +310,114 @@ namespace pgrender {
 			uint32_t firstIndex = 0, int32_t vertexOffset = 0,
 			uint32_t firstInstance = 0) = 0;
 
+		/**
+		 * @brief Dibuja drawCount comandos DrawIndexedIndirectCommand ledos de un buffer.
+		 * @param buffer Buffer de comandos indirectos.
+		 * @param offset Offset en bytes del primer comando (mltiplo de 4).
+		 * @param drawCount Nmero de comandos.
+		 * @param stride Distancia en bytes entre comandos (0 = comandos consecutivos).
+		 */
+		virtual void drawIndexedIndirect(const std::shared_ptr<BufferObject>& buffer,
+			size_t offset,
+			uint32_t drawCount,
+			uint32_t stride = 0) = 0;
+
+		/**
+		 * @brief Dibuja comandos indirectos leyendo el nmero de comandos de otro buffer en GPU.
+		 * Permite que un compute shader (p.ej. culling) decida cuntos objetos se dibujan
+		 * sin volver a la CPU.
+		 * @param buffer Buffer de comandos indirectos.
+		 * @param offset Offset en bytes del primer comando.
+		 * @param countBuffer Buffer con el nmero de comandos (uint32_t).
+		 * @param countOffset Offset en bytes del contador (mltiplo de 4).
+		 * @param maxDrawCount Nmero mximo de comandos a dibujar.
+		 * @param stride Distancia en bytes entre comandos (0 = comandos consecutivos).
+		 * @throws std::runtime_error si el dispositivo no soporta draw count en GPU.
+		 */
+		virtual void drawIndexedIndirectCount(const std::shared_ptr<BufferObject>& buffer,
+			size_t offset,
+			const std::shared_ptr<BufferObject>& countBuffer,
+			size_t countOffset,
+			uint32_t maxDrawCount,
+			uint32_t stride = 0) = 0;
+
+		// ===== COMPUTE =====
+
+		/**
+		 * @brief Lanza el compute shader del pipeline vinculado.
+		 * @param groupsX Nmero de grupos de trabajo en X.
+		 * @param groupsY Nmero de grupos de trabajo en Y.
+		 * @param groupsZ Nmero de grupos de trabajo en Z.
+		 * @throws std::runtime_error si no hay pipeline vinculado.
+		 * @throws std::invalid_argument si se superan los lmites del dispositivo.
+		 */
+		virtual void dispatch(uint32_t groupsX, uint32_t groupsY = 1, uint32_t groupsZ = 1) = 0;
+
+		/**
+		 * @brief Lanza el compute shader leyendo el nmero de grupos de un buffer.
+		 * @param buffer Buffer con un DispatchIndirectCommand.
+		 * @param offset Offset en bytes del comando (mltiplo de 4).
+		 */
+		virtual void dispatchIndirect(const std::shared_ptr<BufferObject>& buffer, size_t offset = 0) = 0;
+
+		/**
+		 * @brief Vincula un nivel de una textura como imagen para imageLoad/imageStore.
+		 * @param texture Textura creada con storageTexture (nullptr para desvincular).
+		 * @param unit Unidad de imagen.
+		 * @param access Modo de acceso desde el shader.
+		 * @param mipLevel Nivel MIP a vincular.
+		 * @param layer Capa a vincular, o -1 para vincular todas las capas (3D, cubemap).
+		 */
+		virtual void bindImage(const std::shared_ptr<Texture>& texture,
+			uint32_t unit,
+			ImageAccess access,
+			uint32_t mipLevel = 0,
+			int32_t layer = -1) = 0;
+
+		/**
+		 * @brief Inserta una barrera de memoria entre escrituras de shaders y accesos posteriores.
+		 * @param flags Tipos de acceso que deben ver las escrituras previas.
+		 */
+		virtual void memoryBarrier(BarrierFlags flags) = 0;
+
+		// ===== TEXTURAS BINDLESS =====
+
+		/**
+		 * @brief Indica si el dispositivo soporta texturas bindless (Texture::getBindlessHandle).
+		 */
+		virtual bool isBindlessTextureSupported() const = 0;
+
+		// ===== TEXTURAS DISPERSAS =====
+
+		/**
+		 * @brief Indica si el dispositivo soporta texturas dispersas (Texture::Desc::sparse).
+		 */
+		virtual bool isSparseTextureSupported() const = 0;
+
+		// ===== SHADERS =====
+
+		/**
+		 * @brief Indica si el dispositivo acepta etapas en SPIR-V (ShaderSource::spirv).
+		 */
+		virtual bool isSpirvSupported() const = 0;
+
+		// ===== FORMATOS =====
+
+		/**
+		 * @brief Indica si el dispositivo puede crear y muestrear texturas con el formato dado.
+		 *
+		 * Los formatos comprimidos por bloques dependen de la plataforma (BC en escritorio,
+		 * ETC2/ASTC en mviles). Equivale a comprobar FormatFeatures::Sampled.
+		 */
+		virtual bool isFormatSupported(Texture::Format format) const = 0;
+
+		/**
+		 * @brief Usos del formato que soporta el dispositivo.
+		 *
+		 * Se consultan al crear el contexto y son un subconjunto de getFormatInfo(format).features.
+		 */
+		virtual FormatFeatures getFormatFeatures(Texture::Format format) const = 0;
+
 		// ===== RAY TRACING =====
 
 		virtual bool isRayTracingSupported() const = 0;
@@ -177,7 +430,7 @@ namespace pgrender {
 		//virtual void bindAccelerationStructure(
 		//	const std::shared_ptr<AccelerationStructure>& tlas,
 		//	uint32_t binding) = 0;
-		//virtual std::shared_ptr<AccelerationStructure> getBoundAccelerationStructure(
+		//virtual AccelerationStructure* getBoundAccelerationStructure(
 		//	uint32_t binding) const = 0;
 		//virtual void traceRays(const TraceRaysDesc& desc) = 0;
 		virtual void buildAccelerationStructure(
@@ -0,0 +1,114 @@
+#pragma once
+#include <deque>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    /**
+     * @brief Cola de borrado diferido de objetos nativos, protegida por fences de la GPU.
+     *
+     * Los objetos entregados con release() forman un lote que endFrame() cierra con un fence;
+     * collect() borra, sin bloquear y en orden de entrega, los lotes cuyo fence ya se
+     * señalizó. Como los fences se señalizan en el orden en que se insertan, un lote nunca se
+     * borra antes que otro más antiguo. Las llamadas al API gráfico quedan en el Backend, de
+     * modo que la política de lotes no depende de ningún backend.
+     */
+    class DeferredReleaseQueue {
+    public:
+        /**
+         * @brief Fences y borrado de objetos del backend gráfico.
+         */
+        class Backend {
+        public:
+            virtual ~Backend() = default;
+
+            /**
+             * @brief Inserta un fence tras los comandos enviados hasta ahora.
+             */
+            virtual void* insertFence() = 0;
+
+            /**
+             * @brief Indica, sin esperar, si la GPU ha llegado al fence.
+             */
+            virtual bool isFenceSignaled(void* fence) = 0;
+
+            virtual void deleteFence(void* fence) = 0;
+
+            /**
+             * @brief Espera a que la GPU termine todos los comandos enviados.
+             */
+            virtual void waitIdle() = 0;
+
+            /**
+             * @brief Borra un objeto nativo; type es el tipo de objeto definido por el backend.
+             */
+            virtual void destroy(uint32_t type, uint32_t name) = 0;
+        };
+
+        /**
+         * @brief Objetos que se acumulan sin fence antes de cerrar el lote aunque nadie
+         * llame a endFrame().
+         */
+        static constexpr size_t kMaxBatchSize = 256;
+
+        /**
+         * @param backend Debe vivir más que la cola.
+         */
+        explicit DeferredReleaseQueue(Backend& backend) : m_backend(backend) {}
+
+        /**
+         * @brief Borra todos los objetos pendientes (ver flush()).
+         */
+        ~DeferredReleaseQueue();
+
+        DeferredReleaseQueue(const DeferredReleaseQueue&) = delete;
+        DeferredReleaseQueue& operator=(const DeferredReleaseQueue&) = delete;
+
+        /**
+         * @brief Entrega un objeto que ya no usa ningún recurso; se borra cuando la GPU termine
+         * los comandos enviados hasta el siguiente endFrame(). El nombre 0 se ignora.
+         */
+        void release(uint32_t type, uint32_t name);
+
+        /**
+         * @brief Cierra el lote del frame con un fence y borra los lotes ya completados.
+         */
+        void endFrame();
+
+        /**
+         * @brief Borra, sin esperar, los lotes cuyo fence se ha señalizado.
+         */
+        void collect();
+
+        /**
+         * @brief Espera a la GPU y borra todo lo pendiente.
+         */
+        void flush();
+
+        /**
+         * @brief Objetos entregados que aún no se han borrado.
+         */
+        size_t getPendingCount() const;
+
+    private:
+        struct Object {
+            uint32_t type;
+            uint32_t name;
+        };
+
+        struct Batch {
+            void* fence = nullptr;
+            std::vector<Object> objects;
+        };
+
+        Backend& m_backend;
+        std::vector<Object> m_current;
+        std::deque<Batch> m_batches;
+
+        void closeBatch();
+        void destroy(const std::vector<Object>& objects);
+    };
+
+} // namespace pgrender
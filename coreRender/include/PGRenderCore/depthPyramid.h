@@ -0,0 +1,99 @@
+#pragma once
+#include "texture.h"
+#include "renderTarget.h"
+#include "pipeline.h"
+#include "bufferObject.h"
+
+#include <memory>
+#include <cstdint>
+
+namespace pgrender {
+
+    class Context;
+
+    /**
+     * @brief Generador de pirámides de profundidad jerárquicas (Hi-Z).
+     *
+     * Reduce el depth de un render target a una textura R32F y construye su cadena de mips
+     * con un compute shader, reduciendo cada bloque 2x2 con min o max (en lugar de promediar
+     * como glGenerateMipmap). Con Reduction::Max cada texel guarda la profundidad más lejana
+     * de su región, que es lo que necesita GpuCulling para la oclusión.
+     *
+     * El nivel 0 mide la potencia de dos anterior al tamaño del depth en cada eje, y cada texel
+     * reduce de forma conservadora la región del depth que cubre; así todos los niveles se
+     * obtienen de bloques 2x2 exactos. Cada dispatch genera hasta 8 niveles en una sola pasada:
+     * cada grupo reduce un bloque de 32x32 texels hasta 1x1 en memoria compartida y el último
+     * grupo en terminar (contador atómico global) genera los dos niveles siguientes leyendo
+     * imágenes coherent. El límite de 8 niveles lo impone GL_MAX_COMPUTE_IMAGE_UNIFORMS, cuyo
+     * mínimo garantizado es 8: una imagen sólo da acceso a un nivel. Una pirámide de hasta
+     * 128x128 se genera en un dispatch y una de hasta 32768x32768 en dos.
+     */
+    class DepthPyramid {
+    public:
+        /**
+         * @brief Operación de reducción entre niveles.
+         */
+        enum class Reduction {
+            Min,    ///< Profundidad más cercana (depth test GL_GREATER / reverse-Z)
+            Max     ///< Profundidad más lejana (depth test GL_LESS)
+        };
+
+        /**
+         * @brief Parámetros de configuración.
+         */
+        struct Desc {
+            Reduction reduction = Reduction::Max;
+        };
+
+        DepthPyramid(Context& context, const Desc& desc);
+        ~DepthPyramid() = default;
+
+        DepthPyramid(const DepthPyramid&) = delete;
+        DepthPyramid& operator=(const DepthPyramid&) = delete;
+
+        /**
+         * @brief Construye la pirámide a partir del attachment de profundidad de un render target.
+         * @throws std::invalid_argument si el render target no tiene profundidad o es multisample.
+         */
+        void build(const std::shared_ptr<RenderTarget>& renderTarget);
+
+        /**
+         * @brief Construye la pirámide a partir de una textura de profundidad (Depth32F o Depth24Stencil8).
+         * La textura de la pirámide se recrea si cambia el tamaño.
+         * Modifica el pipeline, la unidad de textura 0, las unidades de imagen 0-7 y el SSBO 0 vinculados.
+         */
+        void build(const std::shared_ptr<Texture>& depthTexture);
+
+        /**
+         * @brief Textura R32F con la pirámide (nullptr hasta la primera construcción).
+         */
+        const std::shared_ptr<Texture>& getTexture() const { return m_pyramid; }
+
+        uint32_t getMipCount() const { return m_mipCount; }
+        Reduction getReduction() const { return m_desc.reduction; }
+
+        /**
+         * @brief Número de niveles de una cadena completa de mips para el tamaño dado.
+         */
+        static uint32_t mipCountFor(uint32_t width, uint32_t height);
+
+        /**
+         * @brief Tamaño del nivel 0 de la pirámide para un eje del depth (potencia de dos <= size).
+         */
+        static uint32_t pyramidSizeFor(uint32_t size);
+
+    private:
+        Context& m_context;
+        Desc m_desc;
+
+        std::shared_ptr<Program> m_program;
+        std::shared_ptr<Pipeline> m_pipeline;
+        std::shared_ptr<BufferObject> m_counterBuffer;      ///< Grupos terminados; el último lo pone a 0
+
+        std::shared_ptr<Texture> m_pyramid;
+        uint32_t m_mipCount = 0;
+
+        void ensurePyramid(uint32_t width, uint32_t height);
+    };
+
+} // namespace pgrender
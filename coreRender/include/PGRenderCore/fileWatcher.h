@@ -0,0 +1,55 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <filesystem>
+
+namespace pgrender {
+
+    /**
+     * @brief Vigila ficheros y devuelve sin bloquear los que han cambiado.
+     *
+     * En Linux usa inotify sobre los directorios que contienen los ficheros, de modo que
+     * también detecta los editores que guardan escribiendo un temporal y renombrándolo.
+     * En el resto de plataformas compara la fecha de modificación en cada poll().
+     */
+    class FileWatcher {
+    public:
+        /**
+         * @throws std::runtime_error si no se puede crear la instancia de inotify.
+         */
+        FileWatcher();
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        /**
+         * @brief Empieza a vigilar un fichero (la ruta se normaliza a absoluta).
+         * @throws std::runtime_error si no se puede vigilar su directorio.
+         */
+        void watch(const std::string& path);
+
+        /**
+         * @brief Ficheros vigilados modificados desde el último poll(), sin repetidos.
+         */
+        std::vector<std::string> poll();
+
+        /**
+         * @brief Ruta con la que se identifica un fichero vigilado.
+         */
+        static std::string normalizePath(const std::string& path);
+
+    private:
+        std::unordered_set<std::string> m_files;
+#ifdef __linux__
+        int m_fd = -1;
+        std::unordered_map<int, std::string> m_directoriesByWatch;
+        std::unordered_set<std::string> m_watchedDirectories;
+#else
+        std::unordered_map<std::string, std::filesystem::file_time_type> m_writeTimes;
+#endif
+    };
+
+} // namespace pgrender
@@ -0,0 +1,152 @@
+#pragma once
+#include "texture.h"
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    /**
+     * @brief Interpretación de los canales de un formato.
+     */
+    enum class FormatType {
+        UNorm,          ///< Entero normalizado a [0, 1]
+        Srgb,           ///< Normalizado con RGB en sRGB (se linealiza al muestrear)
+        Float,          ///< Coma flotante (16, 32 o empaquetado 11/11/10)
+        UInt,           ///< Entero sin signo sin normalizar (usampler/uimage)
+        Depth,          ///< Sólo profundidad
+        DepthStencil    ///< Profundidad y stencil
+    };
+
+    /**
+     * @brief Usos que admite un formato.
+     * La tabla de formatos recoge el máximo que permite la especificación; Context::getFormatFeatures
+     * devuelve lo que soporta realmente el dispositivo.
+     */
+    enum class FormatFeatures : uint32_t {
+        None = 0,
+        Sampled = 1 << 0,       ///< Se puede crear y muestrear
+        Filterable = 1 << 1,    ///< Admite filtrado lineal
+        Renderable = 1 << 2,    ///< Puede ser attachment de un RenderTarget
+        Storage = 1 << 3,       ///< Puede vincularse como imagen (Context::bindImage)
+        All = Sampled | Filterable | Renderable | Storage
+    };
+
+    constexpr FormatFeatures operator|(FormatFeatures a, FormatFeatures b) {
+        return static_cast<FormatFeatures>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+    }
+
+    constexpr FormatFeatures operator&(FormatFeatures a, FormatFeatures b) {
+        return static_cast<FormatFeatures>(static_cast<uint32_t>(a) & static_cast<uint32_t>(b));
+    }
+
+    /**
+     * @brief Indica si features incluye todos los usos de required.
+     */
+    constexpr bool hasFeatures(FormatFeatures features, FormatFeatures required) {
+        return (static_cast<uint32_t>(features) & static_cast<uint32_t>(required)) == static_cast<uint32_t>(required);
+    }
+
+    /**
+     * @brief Propiedades de un formato de textura, comunes a todos los backends.
+     */
+    struct FormatInfo {
+        Texture::Format format;
+        const char* name;
+        uint8_t blockSizeBytes;     ///< Bytes por texel, o por bloque en formatos comprimidos
+        uint8_t blockWidth;         ///< 1 en formatos sin comprimir
+        uint8_t blockHeight;
+        uint8_t channelCount;
+        FormatType type;
+        FormatFeatures features;    ///< Usos permitidos por la especificación
+
+        constexpr bool isCompressed() const { return blockWidth > 1; }
+        constexpr bool isDepth() const { return type == FormatType::Depth || type == FormatType::DepthStencil; }
+        constexpr bool hasStencil() const { return type == FormatType::DepthStencil; }
+        constexpr bool isInteger() const { return type == FormatType::UInt; }
+    };
+
+    /**
+     * @brief Número de formatos de Texture::Format.
+     */
+    inline constexpr size_t kFormatCount = static_cast<size_t>(Texture::Format::ASTC_8x8_SRGB) + 1;
+
+    namespace detail {
+        using F = Texture::Format;
+        using T = FormatType;
+        constexpr FormatFeatures kColorAll = FormatFeatures::All;
+        constexpr FormatFeatures kColorNoStorage = FormatFeatures::Sampled | FormatFeatures::Filterable | FormatFeatures::Renderable;
+        constexpr FormatFeatures kSampledOnly = FormatFeatures::Sampled | FormatFeatures::Filterable;
+        constexpr FormatFeatures kInteger = FormatFeatures::Sampled | FormatFeatures::Renderable | FormatFeatures::Storage;
+        constexpr FormatFeatures kDepth = FormatFeatures::Sampled | FormatFeatures::Filterable | FormatFeatures::Renderable;
+    }
+
+    /**
+     * @brief Tabla de formatos, indexada por el valor de Texture::Format.
+     */
+    inline constexpr std::array<FormatInfo, kFormatCount> kFormatTable = { {
+        { detail::F::R8,              "R8",              1,  1, 1, 1, detail::T::UNorm,        detail::kColorAll },
+        { detail::F::RG8,             "RG8",             2,  1, 1, 2, detail::T::UNorm,        detail::kColorAll },
+        { detail::F::RGB8,            "RGB8",            3,  1, 1, 3, detail::T::UNorm,        detail::kColorNoStorage },
+        { detail::F::RGBA8,           "RGBA8",           4,  1, 1, 4, detail::T::UNorm,        detail::kColorAll },
+        { detail::F::R16F,            "R16F",            2,  1, 1, 1, detail::T::Float,        detail::kColorAll },
+        { detail::F::RG16F,           "RG16F",           4,  1, 1, 2, detail::T::Float,        detail::kColorAll },
+        { detail::F::RGB16F,          "RGB16F",          6,  1, 1, 3, detail::T::Float,        detail::kSampledOnly },
+        { detail::F::RGBA16F,         "RGBA16F",         8,  1, 1, 4, detail::T::Float,        detail::kColorAll },
+        { detail::F::R32F,            "R32F",            4,  1, 1, 1, detail::T::Float,        detail::kColorAll },
+        { detail::F::RG32F,           "RG32F",           8,  1, 1, 2, detail::T::Float,        detail::kColorAll },
+        { detail::F::RGB32F,          "RGB32F",          12, 1, 1, 3, detail::T::Float,        detail::kSampledOnly },
+        { detail::F::RGBA32F,         "RGBA32F",         16, 1, 1, 4, detail::T::Float,        detail::kColorAll },
+        { detail::F::Depth24Stencil8, "Depth24Stencil8", 4,  1, 1, 2, detail::T::DepthStencil, detail::kDepth },
+        { detail::F::Depth32F,        "Depth32F",        4,  1, 1, 1, detail::T::Depth,        detail::kDepth },
+        { detail::F::SRGB8_A8,        "SRGB8_A8",        4,  1, 1, 4, detail::T::Srgb,         detail::kColorNoStorage },
+        { detail::F::RGB10_A2,        "RGB10_A2",        4,  1, 1, 4, detail::T::UNorm,        detail::kColorAll },
+        { detail::F::R11G11B10F,      "R11G11B10F",      4,  1, 1, 3, detail::T::Float,        detail::kColorAll },
+        { detail::F::R32UI,           "R32UI",           4,  1, 1, 1, detail::T::UInt,         detail::kInteger },
+        { detail::F::RG16UI,          "RG16UI",          4,  1, 1, 2, detail::T::UInt,         detail::kInteger },
+        { detail::F::Depth16,         "Depth16",         2,  1, 1, 1, detail::T::Depth,        detail::kDepth },
+        { detail::F::Depth24,         "Depth24",         4,  1, 1, 1, detail::T::Depth,        detail::kDepth },
+        { detail::F::BC1,             "BC1",             8,  4, 4, 4, detail::T::UNorm,        detail::kSampledOnly },
+        { detail::F::BC1_SRGB,        "BC1_SRGB",        8,  4, 4, 4, detail::T::Srgb,         detail::kSampledOnly },
+        { detail::F::BC3,             "BC3",             16, 4, 4, 4, detail::T::UNorm,        detail::kSampledOnly },
+        { detail::F::BC3_SRGB,        "BC3_SRGB",        16, 4, 4, 4, detail::T::Srgb,         detail::kSampledOnly },
+        { detail::F::BC4,             "BC4",             8,  4, 4, 1, detail::T::UNorm,        detail::kSampledOnly },
+        { detail::F::BC5,             "BC5",             16, 4, 4, 2, detail::T::UNorm,        detail::kSampledOnly },
+        { detail::F::BC6H_UF16,       "BC6H_UF16",       16, 4, 4, 3, detail::T::Float,        detail::kSampledOnly },
+        { detail::F::BC6H_SF16,       "BC6H_SF16",       16, 4, 4, 3, detail::T::Float,        detail::kSampledOnly },
+        { detail::F::BC7,             "BC7",             16, 4, 4, 4, detail::T::UNorm,        detail::kSampledOnly },
+        { detail::F::BC7_SRGB,        "BC7_SRGB",        16, 4, 4, 4, detail::T::Srgb,         detail::kSampledOnly },
+        { detail::F::ETC2_RGB8,       "ETC2_RGB8",       8,  4, 4, 3, detail::T::UNorm,        detail::kSampledOnly },
+        { detail::F::ETC2_RGB8_SRGB,  "ETC2_RGB8_SRGB",  8,  4, 4, 3, detail::T::Srgb,         detail::kSampledOnly },
+        { detail::F::ETC2_RGBA8,      "ETC2_RGBA8",      16, 4, 4, 4, detail::T::UNorm,        detail::kSampledOnly },
+        { detail::F::ETC2_RGBA8_SRGB, "ETC2_RGBA8_SRGB", 16, 4, 4, 4, detail::T::Srgb,         detail::kSampledOnly },
+        { detail::F::ASTC_4x4,        "ASTC_4x4",        16, 4, 4, 4, detail::T::UNorm,        detail::kSampledOnly },
+        { detail::F::ASTC_4x4_SRGB,   "ASTC_4x4_SRGB",   16, 4, 4, 4, detail::T::Srgb,         detail::kSampledOnly },
+        { detail::F::ASTC_6x6,        "ASTC_6x6",        16, 6, 6, 4, detail::T::UNorm,        detail::kSampledOnly },
+        { detail::F::ASTC_6x6_SRGB,   "ASTC_6x6_SRGB",   16, 6, 6, 4, detail::T::Srgb,         detail::kSampledOnly },
+        { detail::F::ASTC_8x8,        "ASTC_8x8",        16, 8, 8, 4, detail::T::UNorm,        detail::kSampledOnly },
+        { detail::F::ASTC_8x8_SRGB,   "ASTC_8x8_SRGB",   16, 8, 8, 4, detail::T::Srgb,         detail::kSampledOnly },
+    } };
+
+    namespace detail {
+        constexpr bool isFormatTableOrdered() {
+            for (size_t i = 0; i < kFormatTable.size(); ++i) {
+                if (static_cast<size_t>(kFormatTable[i].format) != i) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    static_assert(detail::isFormatTableOrdered(), "kFormatTable must follow the order of Texture::Format");
+
+    /**
+     * @brief Propiedades de un formato.
+     */
+    constexpr const FormatInfo& getFormatInfo(Texture::Format format) {
+        return kFormatTable[static_cast<size_t>(format)];
+    }
+
+} // namespace pgrender
@@ -0,0 +1,114 @@
+#pragma once
+#include "bufferObject.h"
+#include "texture.h"
+#include "pipeline.h"
+
+#include <memory>
+#include <cstdint>
+#include <glm/mat4x4.hpp>
+#include <glm/vec4.hpp>
+
+namespace pgrender {
+
+    class Context;
+
+    /**
+     * @brief Etapa de culling en GPU (frustum + oclusión por Hi-Z).
+     *
+     * Un compute shader recorre las esferas envolventes de las instancias, descarta las que
+     * quedan fuera del frustum o detrás de la pirámide de profundidad del frame anterior y
+     * escribe los DrawIndexedIndirectCommand de las visibles de forma compacta, junto con su número.
+     * El dibujado se realiza con una única llamada a Context::drawIndexedIndirectCount.
+     *
+     * Cada comando usa firstInstance = instanceId, de modo que el vertex shader puede
+     * recuperar los datos de la instancia con gl_BaseInstance. Funciona en OpenGL 4.5 con
+     * GL_ARB_indirect_parameters; en ese caso el vertex shader declara
+     * "#extension GL_ARB_shader_draw_parameters : require" y usa gl_BaseInstanceARB.
+     */
+    class GpuCulling {
+    public:
+        /**
+         * @brief Datos de una instancia (layout std430, 32 bytes).
+         */
+        struct InstanceBounds {
+            float center[3];        ///< Centro de la esfera envolvente (espacio mundo)
+            float radius;           ///< Radio de la esfera envolvente
+            uint32_t indexCount;    ///< Índices de la malla
+            uint32_t firstIndex;    ///< Primer índice de la malla
+            int32_t vertexOffset;   ///< Vértice base de la malla
+            uint32_t instanceId;    ///< Identificador de instancia (se escribe en firstInstance)
+        };
+
+        /**
+         * @brief Parámetros de configuración.
+         */
+        struct Desc {
+            uint32_t maxInstances = 0;      ///< Capacidad de los buffers de instancias y comandos
+        };
+
+        /**
+         * @brief Parámetros de un pase de culling.
+         */
+        struct CullParams {
+            glm::mat4 viewProjection{ 1.0f };           ///< Matriz vista-proyección del frame actual
+            uint32_t instanceCount = 0;                 ///< Instancias a procesar (<= maxInstances)
+
+            /**
+             * Pirámide de profundidad (R32F, cada texel con la profundidad más lejana de su región)
+             * construida a partir del depth del frame anterior. nullptr desactiva la oclusión.
+             */
+            std::shared_ptr<Texture> hiZ = nullptr;
+            glm::mat4 hiZViewProjection{ 1.0f };        ///< Vista-proyección con la que se generó hiZ
+        };
+
+        GpuCulling(Context& context, const Desc& desc);
+        ~GpuCulling() = default;
+
+        GpuCulling(const GpuCulling&) = delete;
+        GpuCulling& operator=(const GpuCulling&) = delete;
+
+        /**
+         * @brief Sube datos de instancias al buffer de entrada.
+         * @param instances Instancias a escribir.
+         * @param count Número de instancias.
+         * @param firstInstance Posición del buffer donde empezar a escribir.
+         */
+        void updateInstances(const InstanceBounds* instances, uint32_t count, uint32_t firstInstance = 0);
+
+        /**
+         * @brief Ejecuta el culling y deja listos el buffer de comandos y el contador.
+         * Inserta las barreras necesarias para consumir los comandos con draw().
+         * Modifica el pipeline, los SSBO 0-2, el UBO 0 y la unidad de textura 0 vinculados.
+         */
+        void cull(const CullParams& params);
+
+        /**
+         * @brief Dibuja las instancias visibles con una sola llamada indirecta.
+         * Debe haber un pipeline de dibujo y un vertex array vinculados.
+         */
+        void draw();
+
+        const std::shared_ptr<BufferObject>& getInstanceBuffer() const { return m_instanceBuffer; }
+        const std::shared_ptr<BufferObject>& getCommandBuffer() const { return m_commandBuffer; }
+        const std::shared_ptr<BufferObject>& getDrawCountBuffer() const { return m_drawCountBuffer; }
+        uint32_t getMaxInstances() const { return m_desc.maxInstances; }
+
+        /**
+         * @brief Extrae los 6 planos del frustum (normalizados, ax + by + cz + d) de una
+         * matriz vista-proyección con profundidad de clip en [-1, 1].
+         */
+        static void extractFrustumPlanes(const glm::mat4& viewProjection, glm::vec4 planes[6]);
+
+    private:
+        Context& m_context;
+        Desc m_desc;
+
+        std::shared_ptr<BufferObject> m_instanceBuffer;
+        std::shared_ptr<BufferObject> m_commandBuffer;
+        std::shared_ptr<BufferObject> m_drawCountBuffer;
+        std::shared_ptr<BufferObject> m_paramsBuffer;
+        std::shared_ptr<Pipeline> m_pipeline;
+        uint32_t m_lastInstanceCount = 0;
+    };
+
+} // namespace pgrender
@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+
+namespace pgrender {
+
+    /**
+     * @brief Handle generacional de 32 bits: índice en un HandlePool más la generación del hueco.
+     *
+     * Al destruir un recurso su hueco cambia de generación, de modo que los handles antiguos
+     * dejan de ser válidos aunque el índice se reutilice. El valor 0 es el handle nulo.
+     * Tag sólo distingue los tipos (BufferHandle no se convierte en TextureHandle).
+     */
+    template <typename Tag>
+    class Handle {
+    public:
+        static constexpr uint32_t kIndexBits = 20;
+        static constexpr uint32_t kGenerationBits = 32 - kIndexBits;
+        static constexpr uint32_t kMaxIndex = (1u << kIndexBits) - 1;
+        static constexpr uint32_t kMaxGeneration = (1u << kGenerationBits) - 1;
+
+        constexpr Handle() = default;
+
+        /**
+         * @param generation Entre 1 y kMaxGeneration; con generación 0 el handle sería nulo.
+         */
+        constexpr Handle(uint32_t index, uint32_t generation)
+            : m_value((generation << kIndexBits) | (index & kMaxIndex)) {}
+
+        static constexpr Handle fromValue(uint32_t value) {
+            Handle handle;
+            handle.m_value = value;
+            return handle;
+        }
+
+        constexpr uint32_t index() const { return m_value & kMaxIndex; }
+        constexpr uint32_t generation() const { return m_value >> kIndexBits; }
+        constexpr uint32_t value() const { return m_value; }
+
+        /**
+         * @brief Indica si no es el handle nulo; no garantiza que el recurso siga vivo.
+         */
+        constexpr bool isNull() const { return m_value == 0; }
+        constexpr explicit operator bool() const { return m_value != 0; }
+
+        friend constexpr bool operator==(Handle a, Handle b) = default;
+
+    private:
+        uint32_t m_value = 0;
+    };
+
+    using BufferHandle = Handle<struct BufferHandleTag>;
+    using TextureHandle = Handle<struct TextureHandleTag>;
+    using SamplerHandle = Handle<struct SamplerHandleTag>;
+
+} // namespace pgrender
+
+template <typename Tag>
+struct std::hash<pgrender::Handle<Tag>> {
+    size_t operator()(pgrender::Handle<Tag> handle) const noexcept {
+        return std::hash<uint32_t>{}(handle.value());
+    }
+};
@@ -0,0 +1,137 @@
+#pragma once
+#include "handle.h"
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    /**
+     * @brief Almacén de objetos de tipo T direccionados por handles generacionales.
+     *
+     * Los objetos se guardan por valor en bloques contiguos de kChunkSize huecos que no se
+     * mueven al crecer, por lo que T no necesita ser copiable ni movible y los punteros
+     * devueltos por get() son estables hasta destroy(). Resolver un handle cuesta un índice y una comparación de generación.
+     * Los huecos liberados se reutilizan con la generación siguiente; un hueco que agota las
+     * generaciones se retira para que ningún handle antiguo vuelva a ser válido.
+     */
+    template <typename HandleT, typename T>
+    class HandlePool {
+    public:
+        static constexpr uint32_t kChunkSize = 64;
+
+        HandlePool() = default;
+
+        HandlePool(const HandlePool&) = delete;
+        HandlePool& operator=(const HandlePool&) = delete;
+
+        /**
+         * @brief Construye un objeto en el pool con los argumentos dados.
+         * @throws std::length_error si se agotan los índices.
+         */
+        template <typename... Args>
+        HandleT create(Args&&... args) {
+            uint32_t index;
+            if (!m_freeList.empty()) {
+                index = m_freeList.back();
+                slot(index).emplace(std::forward<Args>(args)...);
+                m_freeList.pop_back();
+            }
+            else {
+                if (m_generations.size() > HandleT::kMaxIndex) {
+                    throw std::length_error("Handle pool is full");
+                }
+                index = static_cast<uint32_t>(m_generations.size());
+                if (index / kChunkSize == m_chunks.size()) {
+                    m_chunks.push_back(std::make_unique<Chunk>());
+                }
+                m_generations.push_back(1);
+                try {
+                    slot(index).emplace(std::forward<Args>(args)...);
+                }
+                catch (...) {
+                    m_generations.pop_back();
+                    throw;
+                }
+            }
+            ++m_size;
+            return HandleT(index, m_generations[index]);
+        }
+
+        /**
+         * @brief Destruye el objeto; el handle y sus copias dejan de ser válidos.
+         * @return false si el handle era nulo o ya no era válido.
+         */
+        bool destroy(HandleT handle) {
+            if (!contains(handle)) {
+                return false;
+            }
+            const uint32_t index = handle.index();
+            // La generación cambia antes de destruir: el destructor ya no puede resolver el handle
+            if (m_generations[index] < HandleT::kMaxGeneration) {
+                ++m_generations[index];
+                m_freeList.push_back(index);
+            }
+            else {
+                m_generations[index] = 0;   // Retirado
+            }
+            --m_size;
+            slot(index).reset();
+            return true;
+        }
+
+        /**
+         * @brief Indica si el handle sigue siendo válido. La generación 0 nunca lo es: marca
+         * los huecos retirados y los handles fabricados con fromValue().
+         */
+        bool contains(HandleT handle) const {
+            const uint32_t index = handle.index();
+            return handle.generation() != 0 && index < m_generations.size() && m_generations[index] == handle.generation();
+        }
+
+        /**
+         * @brief Objeto del handle, o nullptr si es nulo o ya se destruyó.
+         */
+        T* get(HandleT handle) {
+            return contains(handle) ? &*slot(handle.index()) : nullptr;
+        }
+
+        const T* get(HandleT handle) const {
+            return contains(handle) ? &*slot(handle.index()) : nullptr;
+        }
+
+        /**
+         * @brief Destruye todos los objetos e invalida todos los handles emitidos.
+         */
+        void clear() {
+            for (uint32_t index = 0; index < m_generations.size(); ++index) {
+                if (slot(index)) {
+                    destroy(HandleT(index, m_generations[index]));
+                }
+            }
+        }
+
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+    private:
+        struct Chunk {
+            std::array<std::optional<T>, kChunkSize> slots;
+        };
+
+        std::vector<std::unique_ptr<Chunk>> m_chunks;
+        std::vector<uint32_t> m_generations;
+        std::vector<uint32_t> m_freeList;
+        size_t m_size = 0;
+
+        std::optional<T>& slot(uint32_t index) { return m_chunks[index / kChunkSize]->slots[index % kChunkSize]; }
+        const std::optional<T>& slot(uint32_t index) const { return m_chunks[index / kChunkSize]->slots[index % kChunkSize]; }
+    };
+
+} // namespace pgrender
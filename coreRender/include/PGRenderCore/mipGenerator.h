@@ -0,0 +1,88 @@
+#pragma once
+#include "texture.h"
+#include "textureEncoder.h"
+
+#include <vector>
+#include <future>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    class ThreadPool;
+
+    /**
+     * @brief Generación de la cadena de mips en CPU para imágenes RGBA8.
+     *
+     * Cada nivel se obtiene del anterior con un filtro separable (reducción 2x, también con
+     * tamaños impares) trabajando en coma flotante; los niveles intermedios no se cuantizan,
+     * por lo que el error no se acumula a lo largo de la cadena. Con srgb los canales RGB se
+     * filtran en espacio lineal. Las filas de cada pasada se reparten entre los hilos del
+     * ThreadPool y el resultado es idéntico con o sin SIMD y con cualquier número de hilos.
+     */
+    class MipGenerator {
+    public:
+        /**
+         * @brief Filtro de reducción.
+         */
+        enum class Filter {
+            Box,        ///< Media de 2x2 texels: rápido, algo borroso
+            Kaiser,     ///< Sinc con ventana de Kaiser (radio 3): nítido y con poco ringing
+            Lanczos     ///< Lanczos-3: el más nítido, con algo más de ringing
+        };
+
+        /**
+         * @brief Opciones de generación.
+         */
+        struct Options {
+            Filter filter = Filter::Kaiser;
+            bool srgb = false;                  ///< Los canales RGB están codificados en sRGB
+            bool preserveAlphaCoverage = false; ///< Escalar el alfa de cada nivel para mantener la cobertura del nivel 0
+            float alphaCutoff = 0.5f;           ///< Umbral de alpha test usado para medir la cobertura
+            ThreadPool* threadPool = nullptr;   ///< nullptr = generar en el hilo que llama
+            bool useSimd = true;                ///< Permitir la ruta SSE si la CPU la soporta
+        };
+
+        /**
+         * @brief Un nivel de la cadena, RGBA8 sin padding entre filas.
+         */
+        struct Level {
+            uint32_t width = 0;
+            uint32_t height = 0;
+            std::vector<uint8_t> rgba;
+        };
+
+        /**
+         * @brief Número de niveles de la cadena completa (hasta 1x1).
+         */
+        static uint32_t fullChainLength(uint32_t width, uint32_t height);
+
+        /**
+         * @brief Genera la cadena de mips; el nivel 0 es una copia de la imagen de entrada.
+         * @param levelCount Niveles a generar (0 = cadena completa).
+         * @throws std::invalid_argument si la imagen está vacía.
+         */
+        static std::vector<Level> generate(const uint8_t* rgba, uint32_t width, uint32_t height,
+            uint32_t levelCount, const Options& options);
+
+        /**
+         * @brief Genera la cadena en un hilo del pool de options (que es obligatorio).
+         * El future se completa con todos los niveles, listos para upload().
+         * @throws std::invalid_argument si options.threadPool es nulo o la imagen es demasiado pequeña.
+         */
+        static std::future<std::vector<Level>> generateAsync(std::vector<uint8_t> rgba, uint32_t width, uint32_t height,
+            uint32_t levelCount, const Options& options);
+
+        /**
+         * @brief Sube todos los niveles a la textura a partir de su nivel base residente.
+         * Las texturas BC se comprimen nivel a nivel con TextureEncoder. La textura debería
+         * crearse sin Desc::mipmapped para no generar también los mips en GPU.
+         * @throws std::invalid_argument si el formato no es RGBA8, SRGB8_A8 ni codificable o los tamaños no coinciden.
+         */
+        static void upload(Texture& texture, const std::vector<Level>& levels, uint32_t arrayLayer,
+            const TextureEncoder::Options& encoderOptions);
+
+        MipGenerator() = delete;
+    };
+
+} // namespace pgrender
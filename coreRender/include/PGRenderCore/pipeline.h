@@ -2,7 +2,9 @@
 #include "backendType.h"
 #include "shader.h"
 #include "stateConstants.h"
+#include "vertexLayout.h"
 #include <memory>
+#include <vector>
 #include <cstdint>
 #include <glm/vec4.hpp>
 
@@ -52,6 +54,14 @@ namespace pgrender {
         struct Desc {
             std::shared_ptr<Program> program = nullptr;
 
+            /// Alternativa a program: programas separables (Program::Desc::separable) que aportan
+            /// cada uno algunas etapas. No puede haber dos programas con la misma etapa.
+            std::vector<std::shared_ptr<Program>> stagePrograms;
+
+            /// Layout de vrtices con el que se usar el pipeline; si tiene atributos se valida
+            /// al crear el pipeline contra las entradas reflejadas del vertex shader.
+            VertexLayout vertexLayout;
+
             // Estado de rasterizacin
             BlendStateDesc customBlendState;
 
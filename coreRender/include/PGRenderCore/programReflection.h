@@ -0,0 +1,149 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+namespace pgrender {
+
+    class VertexLayout;
+
+    /**
+     * @brief Hash de un nombre de recurso del shader (FNV-1a de 32 bits).
+     */
+    using NameHash = uint32_t;
+
+    /**
+     * @brief Calcula el hash de un nombre; al ser constexpr puede resolverse en compilación.
+     */
+    constexpr NameHash hashName(std::string_view name) noexcept {
+        NameHash hash = 2166136261u;
+        for (char c : name) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Reflexión de un programa enlazado: uniforms, bloques, samplers, imágenes y entradas de vértices.
+     *
+     * El backend la captura una sola vez tras el enlace. Las tablas están ordenadas por hash
+     * del nombre, de modo que las búsquedas son binarias y no comparan cadenas; lo habitual
+     * es resolver la location o el binding al crear el material y usar después sólo el índice.
+     */
+    class ProgramReflection {
+    public:
+        /**
+         * @brief Tipo base de una variable del shader.
+         */
+        enum class BaseType {
+            Float,
+            Double,
+            Int,
+            UInt,
+            Bool,
+            Sampler,    ///< sampler*, usampler*, isampler*
+            Image,      ///< image*, uimage*, iimage*
+            Unknown
+        };
+
+        /**
+         * @brief Uniform suelto o miembro de un bloque.
+         */
+        struct Uniform {
+            std::string name;           ///< Nombre sin el sufijo [0] de los arrays
+            NameHash hash = 0;
+            BaseType baseType = BaseType::Unknown;
+            uint32_t columns = 1;       ///< Columnas (matrices) o 1
+            uint32_t rows = 1;          ///< Componentes de un vector o filas de una matriz
+            uint32_t arraySize = 1;
+            int32_t location = -1;      ///< -1 en miembros de bloques
+            uint32_t binding = 0;       ///< Unidad de textura/imagen (samplers e imágenes)
+            uint32_t offset = 0;        ///< Offset en bytes dentro del bloque
+            uint32_t arrayStride = 0;
+            uint32_t matrixStride = 0;
+            bool rowMajor = false;
+        };
+
+        /**
+         * @brief Bloque de uniforms (UBO) o de almacenamiento (SSBO).
+         */
+        struct Block {
+            std::string name;
+            NameHash hash = 0;
+            uint32_t binding = 0;
+            uint32_t dataSize = 0;          ///< Tamaño mínimo del buffer (0 = array sin tamaño al final)
+            std::vector<Uniform> members;   ///< Ordenados por offset
+
+            /**
+             * @brief Busca un miembro por hash (nullptr si no existe).
+             */
+            const Uniform* findMember(NameHash memberHash) const;
+        };
+
+        /**
+         * @brief Entrada del vertex shader (se omiten las variables gl_*).
+         */
+        struct VertexInput {
+            std::string name;
+            NameHash hash = 0;
+            uint32_t location = 0;
+            BaseType baseType = BaseType::Float;
+            uint32_t components = 1;    ///< Componentes por location (filas en matrices)
+            uint32_t locationCount = 1; ///< Locations consecutivas que ocupa (columnas × arraySize)
+        };
+
+        ProgramReflection() = default;
+
+        /**
+         * @brief Construye las tablas a partir de los recursos enumerados por el backend.
+         * @throws std::runtime_error si dos nombres distintos producen el mismo hash.
+         */
+        ProgramReflection(std::vector<Uniform> uniforms, std::vector<Block> uniformBlocks,
+            std::vector<Block> storageBlocks, std::vector<VertexInput> vertexInputs);
+
+        /**
+         * @brief Indica si no hay reflexión (programa sin compilar).
+         */
+        bool empty() const;
+
+        // ===== BÚSQUEDA POR HASH =====
+
+        /**
+         * @brief Uniform suelto, sampler o imagen (nullptr si no existe o el compilador lo eliminó).
+         */
+        const Uniform* findUniform(NameHash hash) const;
+        const Block* findUniformBlock(NameHash hash) const;
+        const Block* findStorageBlock(NameHash hash) const;
+        const VertexInput* findVertexInput(NameHash hash) const;
+
+        /**
+         * @brief Location de un uniform suelto, o -1 (los setters de Program ignoran -1).
+         */
+        int32_t getUniformLocation(NameHash hash) const;
+
+        // ===== TABLAS COMPLETAS (ordenadas por hash) =====
+
+        const std::vector<Uniform>& getUniforms() const { return m_uniforms; }
+        const std::vector<Block>& getUniformBlocks() const { return m_uniformBlocks; }
+        const std::vector<Block>& getStorageBlocks() const { return m_storageBlocks; }
+        const std::vector<VertexInput>& getVertexInputs() const { return m_vertexInputs; }
+
+        // ===== VALIDACIÓN =====
+
+        /**
+         * @brief Comprueba que el layout alimenta todas las entradas del vertex shader con tipos compatibles:
+         * las entradas float requieren atributos Float/Half y las enteras atributos enteros del mismo signo.
+         * @throws std::invalid_argument con la lista de problemas encontrados.
+         */
+        void validateVertexLayout(const VertexLayout& layout) const;
+
+    private:
+        std::vector<Uniform> m_uniforms;
+        std::vector<Block> m_uniformBlocks;
+        std::vector<Block> m_storageBlocks;
+        std::vector<VertexInput> m_vertexInputs;
+    };
+
+} // namespace pgrender
@@ -2,6 +2,7 @@
 #include <memory>
 #include <cstdint>
 #include <string>
+#include <vector>
 #include <glm/vec4.hpp>
 
 #include "core.h"
@@ -10,10 +11,51 @@ namespace pgrender {
 
     class RenderTarget;
 
+    /**
+     * @brief Accin a realizar sobre el contenido de un attachment al iniciar el render pass.
+     */
+    enum class LoadAction {
+        Load,       ///< Conserva el contenido previo del attachment
+        Clear,      ///< Limpia el attachment con el valor de clear indicado
+        DontCare    ///< El contenido previo no importa (el driver puede descartarlo)
+    };
+
+    /**
+     * @brief Accin a realizar sobre el contenido de un attachment al finalizar el render pass.
+     */
+    enum class StoreAction {
+        Store,      ///< Conserva el resultado en memoria
+        DontCare,   ///< El resultado no se usar despus (se invalida el attachment)
+        Resolve     ///< Copia/resuelve el attachment sobre el render target de resolve y luego se descarta
+    };
+
+    /**
+     * @brief Acciones de carga/almacenamiento para un attachment de color.
+     */
+    struct ColorAttachmentOps {
+        LoadAction loadAction = LoadAction::Load;
+        StoreAction storeAction = StoreAction::Store;
+        glm::vec4 clearValue { 0, 0, 0, 1 };    ///< Valor usado si loadAction == Clear
+    };
+
+    /**
+     * @brief Acciones de carga/almacenamiento para el attachment de profundidad/stencil.
+     * Las acciones de stencil se ignoran si el formato no tiene stencil.
+     */
+    struct DepthStencilAttachmentOps {
+        LoadAction depthLoadAction = LoadAction::Load;
+        StoreAction depthStoreAction = StoreAction::Store;
+        float clearDepth = 1.0f;                ///< Valor usado si depthLoadAction == Clear
+
+        LoadAction stencilLoadAction = LoadAction::Load;
+        StoreAction stencilStoreAction = StoreAction::Store;
+        int clearStencil = 0;                   ///< Valor usado si stencilLoadAction == Clear
+    };
+
 
     /**
      * @brief Interfaz abstracta para RenderPass.
-     * Una unidad de renderizado con control de framebuffer, clears y estado asociado.
+     * Una unidad de renderizado con control de framebuffer, acciones de carga/almacenamiento y estado asociado.
      */
     class RenderPass {
     public:
@@ -21,20 +63,27 @@ namespace pgrender {
 
         /**
           * @brief Descriptor para configurar un RenderPass.
-          * Incluye opcionalmente el RenderTarget a usar y parmetros para limpiar buffers.
+          * Incluye opcionalmente el RenderTarget a usar y las acciones de carga/almacenamiento por attachment.
           */
         struct Desc {
             std::shared_ptr<RenderTarget> renderTarget = nullptr; ///< Render target usado, si es nullptr se usa framebuffer por defecto.
 
-            // Bs flags de clear (pueden combinarse)
-            bool clearColor = false;
-            bool clearDepth = false;
-            bool clearStencil = false;
+            /**
+             * @brief Acciones por attachment de color (ndice = slot del attachment).
+             * Los attachments sin entrada usan Load/Store.
+             */
+            std::vector<ColorAttachmentOps> colorAttachments;
+
+            /**
+             * @brief Acciones para el attachment de profundidad/stencil.
+             */
+            DepthStencilAttachmentOps depthStencilAttachment;
 
-            // Valores utilizados para limpiar buffers
-            glm::vec4 clearColorValue { 0, 0, 0, 1 };
-            float clearDepthValue = 1.0f;
-            int clearStencilValue = 0;
+            /**
+             * @brief Destino de los attachments con StoreAction::Resolve.
+             * Si es nullptr se resuelve sobre el framebuffer por defecto.
+             */
+            std::shared_ptr<RenderTarget> resolveTarget = nullptr;
 
             std::string debugName;
         };
@@ -47,12 +96,12 @@ namespace pgrender {
         virtual const Desc& getDesc() const = 0;
 
         /**
-         * @brief Inicia el render pass, bindear framebuffer y limpiar buffers segn descriptor.
+         * @brief Inicia el render pass: bindea el framebuffer y aplica las acciones de carga.
          */
         virtual void begin() = 0;
 
         /**
-         * @brief Finaliza el render pass, desvincula framebuffer, etc.
+         * @brief Finaliza el render pass: aplica las acciones de almacenamiento (resolve/descartar) y desvincula el framebuffer.
          */
         virtual void end() = 0;
 
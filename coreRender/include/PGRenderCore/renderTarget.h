@@ -39,8 +39,18 @@ namespace pgrender {
             uint32_t height = 0;
 
             /**
-             * @brief Ms flags adicionales si se requiere (multisample, array layers, etc.)
+             * @brief Nmero de muestras por pxel (debe coincidir con el de las texturas).
+             * Con valores > 1 los attachments deben ser Texture2DMultisample.
              */
+            uint32_t sampleCount = 1;
+
+            /**
+             * @brief Capa que se enlaza de los attachments con capas (cubemaps, arrays y 3D).
+             * -1 enlaza todas las capas (render target layered: el shader elige la capa con
+             * gl_Layer). En TextureCubeArray la capa es cubemap * 6 + cara.
+             * Los attachments sin capas se enlazan siempre completos.
+             */
+            int32_t layer = -1;
         };
 
         virtual ~RenderTarget() = default;
@@ -52,6 +62,11 @@ namespace pgrender {
          */
         virtual std::shared_ptr<Texture> getColorAttachment(uint32_t index) const = 0;
 
+        /**
+         * @brief Devuelve el nmero de attachments de color.
+         */
+        virtual uint32_t getColorAttachmentCount() const = 0;
+
         /**
          * @brief Devuelve la textura attachment de profundidad y stencil.
          * @return Shared pointer a la textura de profundidad/stencil, nullptr si no existe.
@@ -68,6 +83,19 @@ namespace pgrender {
          */
         virtual uint32_t getHeight() const = 0;
 
+        /**
+         * @brief Devuelve el nmero de muestras por pxel.
+         */
+        virtual uint32_t getSampleCount() const = 0;
+
+        /**
+         * @brief Resuelve (o copia, si no es multisample) los attachments sobre otro render target.
+         * Cada attachment de color i se resuelve sobre el attachment de color i del destino.
+         * @param destination Render target destino (nullptr = framebuffer por defecto, slo color 0).
+         * @param includeDepthStencil Resolver tambin profundidad/stencil.
+         */
+        virtual void resolve(const std::shared_ptr<RenderTarget>& destination, bool includeDepthStencil = false) = 0;
+
         /**
          * @brief Devuelve el identificador nativo o handle interno del render target.
          *        (Ej. framebuffer OpenGL o Vulkan).
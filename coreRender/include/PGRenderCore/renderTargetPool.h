@@ -0,0 +1,132 @@
+#pragma once
+#include "renderTarget.h"
+#include "texture.h"
+
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    class Context;
+
+    /**
+     * @brief Pool de render targets reutilizables entre frames.
+     *
+     * Evita recrear framebuffers y texturas cuando se piden render targets con la
+     * misma configuración (tamaño, formatos, muestras). Los render targets liberados vuelven
+     * al pool y se destruyen si no se reutilizan durante un número de frames.
+     *
+     * El ancho y el alto pedidos se redondean hacia arriba a múltiplos de sizeGranularity, de
+     * modo que los pasos pequeños de una resolución dinámica reutilizan el mismo render target.
+     * El render target entregado puede ser mayor que lo pedido: se dibuja con un viewport del
+     * tamaño pedido. Con sizeGranularity = 1 los tamaños son exactos.
+     */
+    class RenderTargetPool {
+    public:
+        /**
+         * @brief Clave que identifica una configuración de render target.
+         */
+        struct Key {
+            uint32_t width = 0;
+            uint32_t height = 0;
+            std::vector<Texture::Format> colorFormats;     ///< Un formato por attachment de color
+            bool hasDepthStencil = false;                  ///< Si se crea attachment de profundidad/stencil
+            Texture::Format depthStencilFormat = Texture::Format::Depth24Stencil8;
+            uint32_t sampleCount = 1;                      ///< Muestras por píxel (> 1 crea texturas multisample)
+
+            bool operator==(const Key& other) const = default;
+        };
+
+        /**
+         * @brief Estadísticas de uso y memoria del pool.
+         */
+        struct Statistics {
+            uint32_t totalTargets = 0;      ///< Render targets vivos (en uso + libres)
+            uint32_t inUseTargets = 0;      ///< Render targets entregados y no liberados
+            size_t totalMemoryBytes = 0;    ///< Memoria estimada de todos los attachments
+            size_t freeMemoryBytes = 0;     ///< Memoria estimada de los render targets libres
+            uint64_t hits = 0;              ///< Peticiones servidas reutilizando un render target
+            uint64_t misses = 0;            ///< Peticiones que han requerido crear uno nuevo
+            uint64_t evictions = 0;         ///< Render targets destruidos por envejecimiento
+        };
+
+        /**
+         * @param context Contexto usado para crear texturas y render targets.
+         * @param maxUnusedFrames Frames que un render target libre se conserva antes de destruirse.
+         * @param sizeGranularity Múltiplo al que se redondean ancho y alto (>= 1).
+         */
+        explicit RenderTargetPool(Context& context, uint32_t maxUnusedFrames = 3, uint32_t sizeGranularity = 64);
+        ~RenderTargetPool() = default;
+
+        RenderTargetPool(const RenderTargetPool&) = delete;
+        RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+        /**
+         * @brief Obtiene un render target con la configuración indicada (tamaño redondeado),
+         * reutilizando uno libre si existe.
+         */
+        std::shared_ptr<RenderTarget> acquire(const Key& key);
+
+        /**
+         * @brief Devuelve un render target al pool para que pueda reutilizarse.
+         * @throws std::invalid_argument si el render target no pertenece al pool.
+         */
+        void release(const std::shared_ptr<RenderTarget>& renderTarget);
+
+        /**
+         * @brief Avanza el contador de frames y destruye los render targets libres
+         * que llevan más de maxUnusedFrames sin usarse.
+         */
+        void nextFrame();
+
+        /**
+         * @brief Destruye todos los render targets libres.
+         */
+        void trim();
+
+        void setMaxUnusedFrames(uint32_t frames) { m_maxUnusedFrames = frames; }
+        uint32_t getMaxUnusedFrames() const { return m_maxUnusedFrames; }
+        uint32_t getSizeGranularity() const { return m_sizeGranularity; }
+
+        /**
+         * @brief Tamaño con el que se crea un render target para el tamaño pedido.
+         */
+        uint32_t roundSize(uint32_t size) const;
+
+        /**
+         * @brief Obtiene las estadísticas del pool.
+         */
+        const Statistics& getStatistics() const { return m_statistics; }
+
+        /**
+         * @brief Estima la memoria (en bytes) que ocupan los attachments de una configuración.
+         */
+        static size_t estimateMemory(const Key& key);
+
+    private:
+        struct KeyHasher {
+            size_t operator()(const Key& key) const;
+        };
+
+        struct Entry {
+            std::shared_ptr<RenderTarget> renderTarget;
+            size_t memoryBytes = 0;
+            uint64_t lastUsedFrame = 0;
+            bool inUse = false;
+        };
+
+        Context& m_context;
+        uint32_t m_maxUnusedFrames;
+        uint32_t m_sizeGranularity;
+        uint64_t m_frame = 0;
+        std::unordered_map<Key, std::vector<Entry>, KeyHasher> m_entries;
+        Statistics m_statistics;
+
+        std::shared_ptr<RenderTarget> createRenderTarget(const Key& key);
+        static Key makeKey(const RenderTarget& renderTarget);
+    };
+
+} // namespace pgrender
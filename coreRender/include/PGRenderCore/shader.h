@@ -1,8 +1,16 @@
 #pragma once
 #include <string>
 #include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/mat3x3.hpp>
+#include <glm/mat4x4.hpp>
 
 #include "core.h"
+#include "programReflection.h"
 
 namespace pgrender {
 
@@ -26,12 +34,57 @@ namespace pgrender {
         Callable
     };
 
+    /**
+     * @brief Hash FNV-1a de 64 bits, estable entre ejecuciones y plataformas.
+     * @param seed Hash previo, para encadenar varios bloques.
+     */
+    uint64_t hashContent(const void* data, size_t size, uint64_t seed = 14695981039346656037ull);
+
+    /**
+     * @brief Valor de una constante de especializacin SPIR-V (layout(constant_id = N)).
+     * Los valores float o bool se pasan con su representacin de 32 bits.
+     */
+    struct SpecializationConstant {
+        uint32_t id;
+        uint32_t value;
+
+        bool operator==(const SpecializationConstant& other) const = default;
+    };
+
     /**
      * @brief Descriptor que define los shaders en sus distintas etapas.
+     *
+     * Si spirv no est vaco la etapa se carga precompilada y source se ignora; requiere
+     * Context::isSpirvSupported(). Las constantes de especializacin se fijan al cargarla,
+     * por lo que una sola compilacin offline sirve para muchas variantes.
+     * Los campos tras source tienen inicializador: `{ stage, source }` sigue bastando para GLSL.
      */
     struct ShaderSource {
         ShaderStage stage;
         std::string source;  ///< Cdigo fuente GLSL u otro lenguaje compatible.
+        std::vector<uint32_t> spirv{};  ///< Mdulo SPIR-V (palabras en el orden de la mquina).
+        std::string entryPoint = "main";
+        std::vector<SpecializationConstant> specializationConstants{};
+
+        /**
+         * @brief Indica si la etapa se carga desde SPIR-V.
+         */
+        bool isSpirv() const { return !spirv.empty(); }
+
+        bool operator==(const ShaderSource& other) const = default;
+
+        /**
+         * @brief Hash del contenido de la etapa: tipo, fuente o mdulo SPIR-V con su punto de
+         * entrada y constantes. Dos etapas con el mismo hash producen el mismo shader compilado.
+         */
+        uint64_t contentHash() const;
+
+        /**
+         * @brief Convierte el contenido de un fichero .spv en palabras, corrigiendo el orden de
+         * bytes si el mdulo se gener en una mquina de distinto endianness.
+         * @throws std::invalid_argument si el tamao no es mltiplo de 4 o falta el nmero mgico.
+         */
+        static std::vector<uint32_t> spirvFromBytes(const void* data, size_t size);
     };
 
     /**
@@ -42,12 +95,29 @@ namespace pgrender {
     public:
         virtual ~Program() = default;
 
+        /**
+         * @brief Estado de la compilacin del programa.
+         */
+        enum class CompileStatus {
+            NotCompiled,
+            Pending,    ///< Lanzada con beginCompile() y an en curso
+            Ready,
+            Failed      ///< Ver getLastError()
+        };
+
         struct Desc {
             /**
              * @brief Lista de etapas del shader con su cdigo fuente.
              */
             std::vector<ShaderSource> stages;
             const char* debugName = nullptr; ///< Nombre para depuracin (opcional).
+
+            /**
+             * @brief Programa separable: slo contiene algunas etapas y se combina con otros
+             * en un pipeline (Pipeline::Desc::stagePrograms). Con N variantes de vertex y M de
+             * fragment se enlazan N + M programas en lugar de N  M.
+             */
+            bool separable = false;
         };
 
         /**
@@ -56,6 +126,39 @@ namespace pgrender {
          */
         virtual bool compile() = 0;
 
+        /**
+         * @brief Lanza la compilacin y el enlace sin esperar al resultado.
+         * Si el driver compila en paralelo (KHR_parallel_shader_compile) la llamada vuelve
+         * enseguida; si no, el coste se paga aqu o en la primera consulta del estado.
+         * @return false si no se pudo lanzar (el estado pasa a Failed).
+         */
+        virtual bool beginCompile() = 0;
+
+        /**
+         * @brief Consulta sin bloquear si la compilacin lanzada con beginCompile() termin;
+         * al terminar completa el enlace (reflexin incluida) y devuelve Ready o Failed.
+         */
+        virtual CompileStatus pollCompileStatus() = 0;
+
+        /**
+         * @brief ltimo estado conocido, sin consultar al driver.
+         */
+        virtual CompileStatus getCompileStatus() const = 0;
+
+        /**
+         * @brief Log del compilador o del enlazador de la ltima compilacin fallida.
+         */
+        virtual std::string getLastError() const = 0;
+
+        /**
+         * @brief Sustituye el programa nativo, la descripcin y la reflexin por las de other,
+         * que debe estar compilado (Ready); other se queda con el programa anterior.
+         * Quien comparte este Program (p.ej. los pipelines) pasa a usar el cdigo nuevo sin
+         * cambiar de objeto. Se usa para recargar shaders en caliente.
+         * @throws std::invalid_argument si other es de otro backend o no est compilado.
+         */
+        virtual void adopt(Program& other) = 0;
+
         /**
          * @brief Libera los recursos internos del shader.
          */
@@ -71,6 +174,33 @@ namespace pgrender {
          */
         virtual unsigned long nativeHandle() const = 0;
 
+        // ===== REFLEXIN =====
+
+        /**
+         * @brief Uniforms, bloques, samplers, imgenes y entradas capturados tras el ltimo enlace.
+         * Vaca si el programa no est compilado.
+         */
+        virtual const ProgramReflection& getReflection() const = 0;
+
+        // ===== UNIFORMS =====
+        // Escriben en el programa sin necesidad de vincularlo. La location se obtiene una vez con
+        // getReflection().getUniformLocation(hashName("...")); -1 se ignora, como en GLSL.
+
+        virtual void setUniform(int32_t location, float value) = 0;
+        virtual void setUniform(int32_t location, int32_t value) = 0;
+        virtual void setUniform(int32_t location, uint32_t value) = 0;
+        virtual void setUniform(int32_t location, const glm::vec2& value) = 0;
+        virtual void setUniform(int32_t location, const glm::vec3& value) = 0;
+        virtual void setUniform(int32_t location, const glm::vec4& value) = 0;
+        virtual void setUniform(int32_t location, const glm::mat3& value) = 0;
+        virtual void setUniform(int32_t location, const glm::mat4& value) = 0;
+
+        /**
+         * @brief Escribe count elementos consecutivos de un array de uniforms.
+         */
+        virtual void setUniform(int32_t location, const glm::vec4* values, uint32_t count) = 0;
+        virtual void setUniform(int32_t location, const glm::mat4* values, uint32_t count) = 0;
+
         BACKEND_CHECKER
         CAST_HELPERS
 
@@ -0,0 +1,242 @@
+#pragma once
+#include "shader.h"
+#include "fileWatcher.h"
+#include "shaderPreprocessor.h"
+
+#include <memory>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    class Context;
+
+    /**
+     * @brief Biblioteca de shaders con variantes (permutaciones) compiladas bajo demanda.
+     *
+     * Cada shader se registra con sus fuentes y una lista de keywords booleanas o enumeradas.
+     * Una variante se identifica por una máscara de bits (VariantKey) y sólo se compila la
+     * primera vez que se pide: se genera un preámbulo de #define tras la línea #version y se
+     * lanza la compilación con Program::beginCompile, sin esperar. Mientras está pendiente,
+     * o si falla, getVariant devuelve la variante de reserva (fallbackKey), que se compila de
+     * forma síncrona la primera vez que se usa el shader.
+     *
+     * Las keywords que no aparecen en ninguna etapa no generan #define y se ignoran en la
+     * clave; además las variantes con el mismo código final (también entre shaders distintos)
+     * comparten un único programa; se buscan por el hash del código y se confirman comparándolo.
+     *
+     * Las etapas GLSL se expanden al registrarlas con el ShaderPreprocessor de la biblioteca
+     * (getPreprocessor), que resuelve los #include y comparte entre shaders la lectura de los
+     * ficheros comunes; las keywords se buscan en el código ya expandido.
+     *
+     * Con enableHotReload() se vigilan los ficheros de las etapas (ShaderDesc::stageFiles) y
+     * todos los que incluyen: al cambiar uno, update() relee los shaders que dependen de él y recompila sus variantes en segundo plano con
+     * el mismo mecanismo asíncrono; cada programa nuevo se traslada con Program::adopt al
+     * objeto que ya usan los pipelines, o se descarta conservando el anterior si no compila.
+     * Un programa compartido con otros shaders no se modifica: el shader editado pasa a tener
+     * uno propio, que getVariant devuelve desde entonces. Las variantes que dependían de
+     * keywords que ya no aparecen en el código se olvidan.
+     *
+     * Debe usarse desde el hilo del contexto gráfico.
+     */
+    class ShaderLibrary {
+    public:
+        using ShaderId = uint32_t;
+        using VariantKey = uint64_t;
+
+        static constexpr ShaderId InvalidShader = ~0u;
+
+        /**
+         * @brief Keyword de un shader.
+         * Booleana (values vacío): ocupa un bit y define `name` cuando está activa.
+         * Enumerada: ocupa los bits necesarios para indexar values y define el valor elegido;
+         * el primer valor es el de por defecto y un valor vacío no define nada.
+         */
+        struct Keyword {
+            std::string name;
+            std::vector<std::string> values;
+        };
+
+        /**
+         * @brief Descripción de un shader con variantes.
+         */
+        struct ShaderDesc {
+            std::string name;                   ///< Nombre único (también para depuración)
+            std::vector<ShaderSource> stages;   ///< Fuentes comunes a todas las variantes
+            std::vector<Keyword> keywords;      ///< Hasta 64 bits en total
+            VariantKey fallbackKey = 0;         ///< Variante usada mientras otra compila o si falla
+
+            /// Fichero de cada etapa, en el orden de stages ("" = sin fichero). Si la fuente de
+            /// una etapa está vacía se lee del fichero al registrar el shader.
+            std::vector<std::string> stageFiles;
+        };
+
+        /**
+         * @brief Resultado de recargar un shader: log vacío si compiló, error del compilador si no.
+         */
+        using ReloadCallback = std::function<void(const std::string& shaderName, bool success, const std::string& log)>;
+
+        /**
+         * @brief Estadísticas de compilación.
+         */
+        struct Statistics {
+            uint32_t shaders = 0;               ///< Shaders registrados
+            uint32_t variantsRequested = 0;     ///< Claves distintas pedidas
+            uint32_t programsCompiled = 0;      ///< Programas creados (compilaciones lanzadas)
+            uint32_t programsShared = 0;        ///< Variantes resueltas con un programa existente
+            uint32_t programsPending = 0;       ///< Compilaciones en curso
+            uint32_t programsFailed = 0;
+            uint32_t programsReloaded = 0;      ///< Recargas en caliente aplicadas
+            uint32_t reloadsFailed = 0;         ///< Recargas descartadas (se conserva el programa anterior)
+        };
+
+        explicit ShaderLibrary(Context& context);
+        ~ShaderLibrary() = default;
+
+        ShaderLibrary(const ShaderLibrary&) = delete;
+        ShaderLibrary& operator=(const ShaderLibrary&) = delete;
+
+        /**
+         * @brief Registra un shader; no compila nada.
+         * @throws std::invalid_argument si el nombre está repetido, hay keywords repetidas o
+         * las keywords necesitan más de 64 bits.
+         * @throws std::runtime_error si no se puede leer un fichero de stageFiles necesario o
+         * falla la expansión de algún #include.
+         */
+        ShaderId add(const ShaderDesc& desc);
+
+        /**
+         * @brief Busca un shader por nombre (InvalidShader si no existe).
+         */
+        ShaderId find(std::string_view name) const;
+
+        /**
+         * @brief Bits de la clave que activan una keyword; se combinan con |.
+         * @param value Valor de una keyword enumerada (se ignora en las booleanas).
+         * @throws std::invalid_argument si la keyword o el valor no existen.
+         */
+        VariantKey keyword(ShaderId shader, std::string_view name, std::string_view value = {}) const;
+
+        /**
+         * @brief Programa de una variante. La primera petición lanza su compilación y devuelve
+         * la variante de reserva hasta que termine; las siguientes consultan el estado sin bloquear.
+         * @throws std::invalid_argument si la clave no es válida para el shader.
+         * @throws std::runtime_error si la variante de reserva no compila.
+         */
+        std::shared_ptr<Program> getVariant(ShaderId shader, VariantKey key);
+
+        /**
+         * @brief Estado de una variante (NotCompiled si nunca se ha pedido).
+         */
+        Program::CompileStatus getVariantStatus(ShaderId shader, VariantKey key) const;
+
+        /**
+         * @brief Lanza la compilación de una variante sin usarla todavía (p.ej. al cargar un nivel).
+         */
+        void prefetch(ShaderId shader, VariantKey key);
+
+        /**
+         * @brief Consulta las compilaciones pendientes y, con la recarga activa, los ficheros
+         * modificados; llamar una vez por frame.
+         */
+        void update();
+
+        /**
+         * @brief Activa la recarga en caliente de los shaders con stageFiles.
+         * @param callback Se invoca desde update() al terminar cada recarga (opcional).
+         * @throws std::runtime_error si no se pueden vigilar los ficheros.
+         */
+        void enableHotReload(ReloadCallback callback = {});
+
+        bool isHotReloadEnabled() const { return m_watcher != nullptr; }
+
+        /**
+         * @brief Preprocesador de #include; las rutas de inclusión y los ficheros virtuales
+         * deben añadirse antes de registrar los shaders que los usan.
+         */
+        ShaderPreprocessor& getPreprocessor() { return m_preprocessor; }
+
+        /**
+         * @brief #define de una variante, en el orden de las keywords.
+         */
+        std::vector<std::string> getDefines(ShaderId shader, VariantKey key) const;
+
+        const Statistics& getStatistics() const { return m_statistics; }
+
+        /**
+         * @brief Inserta los #define tras la línea #version (o al principio si no hay) y
+         * restaura la numeración de líneas con #line. Sin defines devuelve la fuente intacta.
+         */
+        static std::string buildVariantSource(const std::string& source, const std::vector<std::string>& defines);
+
+    private:
+        struct CompiledProgram {
+            std::string debugName;          ///< Debe vivir tanto como program (Program::Desc::debugName)
+            std::shared_ptr<Program> program;
+            Program::CompileStatus status = Program::CompileStatus::NotCompiled;
+            uint64_t sourceHash = 0;
+            std::vector<ShaderSource> stages;       ///< Código final, para confirmar las coincidencias de hash
+        };
+
+        /**
+         * @brief Recarga en curso de un programa de un shader.
+         * Si el programa era sólo de ese shader, target es el mismo entry y el código nuevo se
+         * adopta en su Program; si lo compartía con otros shaders, target es un programa propio
+         * que sustituye a entry en las variantes del shader al terminar.
+         */
+        struct Reload {
+            ShaderId shader = InvalidShader;
+            std::shared_ptr<CompiledProgram> entry;
+            std::shared_ptr<CompiledProgram> target;
+            std::vector<VariantKey> keys;           ///< Claves del shader que usan entry
+            std::shared_ptr<Program> replacement;
+        };
+
+        struct KeywordSlot {
+            uint32_t shift = 0;
+            uint32_t bits = 0;
+            bool used = false;              ///< Aparece en alguna etapa
+        };
+
+        struct Shader {
+            ShaderDesc desc;
+            std::vector<KeywordSlot> slots;
+            VariantKey validMask = 0;       ///< Bits ocupados por las keywords
+            VariantKey usedMask = 0;        ///< Bits de las keywords que aparecen en alguna etapa
+            std::unordered_map<VariantKey, std::shared_ptr<CompiledProgram>> variants;
+            std::vector<std::string> sources;       ///< Fuentes sin expandir, en el orden de stages
+            std::vector<std::string> watchedFiles;  ///< stageFiles e includes, normalizados
+        };
+
+        Context& m_context;
+        std::vector<Shader> m_shaders;
+        std::unordered_map<uint64_t, std::shared_ptr<CompiledProgram>> m_programsBySource;
+        std::vector<std::shared_ptr<CompiledProgram>> m_pending;
+        Statistics m_statistics;
+
+        ShaderPreprocessor m_preprocessor;
+        std::unique_ptr<FileWatcher> m_watcher;
+        ReloadCallback m_reloadCallback;
+        std::vector<Reload> m_reloading;
+
+        Shader& getShader(ShaderId shader);
+        const Shader& getShader(ShaderId shader) const;
+        VariantKey normalizeKey(const Shader& shader, VariantKey key) const;
+        std::vector<std::string> definesFor(const Shader& shader, VariantKey key) const;
+        void expandStages(Shader& shader, bool fromFiles);
+        void updateKeywordUsage(Shader& shader);
+        Program::Desc buildProgramDesc(const Shader& shader, VariantKey key) const;
+        std::shared_ptr<CompiledProgram> requestVariant(Shader& shader, VariantKey key);
+        void reloadShader(ShaderId shaderId);
+        bool isSharedWithOtherShaders(ShaderId shaderId, const std::shared_ptr<CompiledProgram>& entry) const;
+        void pollReloads();
+        const std::shared_ptr<Program>& getFallback(Shader& shader);
+        bool poll(CompiledProgram& entry);
+    };
+
+} // namespace pgrender
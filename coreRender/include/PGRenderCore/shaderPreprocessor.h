@@ -0,0 +1,86 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace pgrender {
+
+    /**
+     * @brief Resuelve las directivas #include de las fuentes GLSL antes de compilarlas.
+     *
+     * `#include "fichero"` se busca primero junto al fichero que lo incluye y después en las
+     * rutas de inclusión; `#include <fichero>` sólo en las rutas. Los ficheros virtuales
+     * (addVirtualFile) tienen prioridad sobre el disco. Los ficheros marcados con #pragma once
+     * se expanden una sola vez por etapa; los demás pueden protegerse con #ifndef como en C.
+     *
+     * El contenido de los ficheros leídos se guarda en una caché compartida por todas las
+     * etapas, de modo que un fichero común se lee una sola vez; invalidate() lo descarta
+     * cuando cambia en disco.
+     *
+     * Tras cada inclusión se emite `#line N S`, donde S es el índice del fichero en
+     * Result::files, para que los errores del driver ("S(N)") señalen el fichero real.
+     * Se eliminan las líneas #extension GL_GOOGLE_include_directive y
+     * GL_ARB_shading_language_include, que el driver no necesita tras la expansión.
+     */
+    class ShaderPreprocessor {
+    public:
+        /**
+         * @brief Fuente expandida de una etapa.
+         */
+        struct Result {
+            std::string source;
+            std::vector<std::string> files;     ///< [0] = raíz; el índice es el número de fuente de #line
+            uint64_t hash = 0;                  ///< hashContent de source
+        };
+
+        ShaderPreprocessor() = default;
+
+        void addIncludePath(const std::string& directory);
+
+        /**
+         * @brief Registra un fichero en memoria que se puede incluir por su nombre.
+         */
+        void addVirtualFile(const std::string& name, std::string source);
+
+        bool isVirtualFile(const std::string& name) const { return m_virtualFiles.count(name) != 0; }
+
+        /**
+         * @brief Expande una fuente; fileName (opcional) sirve para resolver includes relativos
+         * y para los mensajes de error.
+         * @throws std::runtime_error si un include no se encuentra, es cíclico o anida demasiado.
+         */
+        Result process(const std::string& source, const std::string& fileName = {});
+
+        /**
+         * @brief Lee (de la caché o del disco) y expande un fichero.
+         * @throws std::runtime_error si no se puede leer o falla la expansión.
+         */
+        Result processFile(const std::string& path);
+
+        /**
+         * @brief Descarta un fichero de la caché para releerlo en la próxima expansión.
+         */
+        void invalidate(const std::string& path);
+
+        void clearCache() { m_fileCache.clear(); }
+
+        size_t getCachedFileCount() const { return m_fileCache.size(); }
+
+    private:
+        struct Expansion {
+            Result result;
+            std::vector<std::string> stack;     ///< Ficheros en curso, para detectar ciclos
+            std::vector<std::string> onceFiles; ///< Ficheros con #pragma once ya expandidos
+        };
+
+        std::vector<std::string> m_includePaths;
+        std::unordered_map<std::string, std::string> m_virtualFiles;
+        std::unordered_map<std::string, std::string> m_fileCache;
+
+        const std::string* load(const std::string& path);
+        std::string resolve(const std::string& name, bool quoted, const std::string& includer);
+        void expand(Expansion& expansion, const std::string& source, const std::string& fileName);
+    };
+
+} // namespace pgrender
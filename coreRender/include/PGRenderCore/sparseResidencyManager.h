@@ -0,0 +1,145 @@
+#pragma once
+#include "texture.h"
+#include "bufferObject.h"
+
+#include <memory>
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    class Context;
+
+    /**
+     * @brief Gestor de residencia de páginas para una textura 2D dispersa (Texture::Desc::sparse).
+     *
+     * Los shaders escriben en un buffer de feedback las páginas que necesitan (packFeedback);
+     * processFeedback() acumula su prioridad y la de sus páginas padre en mips más gruesos, y
+     * update() asigna y carga las páginas más prioritarias, liberando las menos usadas cuando
+     * se supera el presupuesto.
+     *
+     * Una página sólo se asigna si su padre es residente y sólo se libera si no tiene hijos
+     * residentes, de forma que siempre existe un mip más grueso al que recurrir. El mapa de
+     * residencia (R32F, un texel por página del nivel 0) guarda el mip más fino disponible en
+     * cada zona; el shader debe limitar el LOD con él: textureLod(tex, uv, max(lod, minLod)).
+     * La cola de mips se asigna completa al crear el gestor y nunca se libera.
+     */
+    class SparseResidencyManager {
+    public:
+        /**
+         * @brief Callback que rellena una región recién asignada con sus datos.
+         */
+        using PageLoader = std::function<void(Texture& texture, const Texture::Region& region)>;
+
+        /**
+         * @brief Parámetros de configuración.
+         */
+        struct Desc {
+            std::shared_ptr<Texture> texture;   ///< Textura 2D dispersa
+            PageLoader pageLoader;              ///< Carga de datos de cada página asignada
+            uint32_t maxResidentPages = 1024;   ///< Presupuesto de páginas residentes (sin contar la cola de mips)
+            uint32_t maxCommitsPerFrame = 16;   ///< Páginas que se asignan y cargan como máximo por update()
+            uint32_t maxUnusedFrames = 60;      ///< Frames sin peticiones tras los que una página se libera
+        };
+
+        /**
+         * @brief Estadísticas de residencia.
+         */
+        struct Statistics {
+            uint32_t residentPages = 0;     ///< Páginas residentes (sin contar la cola de mips)
+            uint32_t pendingPages = 0;      ///< Páginas pedidas en el último update() que no se pudieron asignar
+            uint64_t commits = 0;           ///< Páginas asignadas en total
+            uint64_t evictions = 0;         ///< Páginas liberadas en total
+        };
+
+        /// Valor de una entrada vacía del buffer de feedback
+        static constexpr uint32_t kEmptyFeedback = 0xFFFFFFFF;
+
+        /**
+         * @brief Codifica una petición de página: mip (4 bits), pageY (14 bits), pageX (14 bits).
+         * El shader de feedback debe usar la misma codificación.
+         */
+        static constexpr uint32_t packFeedback(uint32_t mipLevel, uint32_t pageX, uint32_t pageY) {
+            return (mipLevel << 28) | ((pageY & 0x3FFF) << 14) | (pageX & 0x3FFF);
+        }
+
+        SparseResidencyManager(Context& context, const Desc& desc);
+        ~SparseResidencyManager() = default;
+
+        SparseResidencyManager(const SparseResidencyManager&) = delete;
+        SparseResidencyManager& operator=(const SparseResidencyManager&) = delete;
+
+        /**
+         * @brief Registra las peticiones de un buffer de feedback ya leído en CPU.
+         * Las entradas kEmptyFeedback o fuera de rango se ignoran.
+         */
+        void processFeedback(const uint32_t* entries, size_t count);
+
+        /**
+         * @brief Mapea un buffer de feedback de GPU y registra sus peticiones.
+         * @param buffer Buffer con entradas uint32_t (requiere acceso de lectura).
+         * @param count Número de entradas a procesar.
+         */
+        void processFeedback(const std::shared_ptr<BufferObject>& buffer, size_t count);
+
+        /**
+         * @brief Pide una página concreta (y sus padres) con la prioridad indicada.
+         */
+        void requestPage(uint32_t mipLevel, uint32_t pageX, uint32_t pageY, uint32_t priority = 1);
+
+        /**
+         * @brief Asigna y carga las páginas pedidas, libera las que sobran, actualiza
+         * el mapa de residencia y avanza al siguiente frame.
+         */
+        void update();
+
+        bool isPageResident(uint32_t mipLevel, uint32_t pageX, uint32_t pageY) const;
+        uint32_t getPageCountX(uint32_t mipLevel) const;
+        uint32_t getPageCountY(uint32_t mipLevel) const;
+
+        /**
+         * @brief Mapa de residencia: mip más fino residente por página del nivel 0 (R32F).
+         */
+        const std::shared_ptr<Texture>& getResidencyMap() const { return m_residencyMap; }
+
+        const Statistics& getStatistics() const { return m_statistics; }
+
+    private:
+        struct Page {
+            bool resident = false;
+            uint32_t priority = 0;
+            uint64_t lastRequestedFrame = 0;
+            bool requested = false;
+        };
+
+        struct Level {
+            uint32_t pagesX = 0;
+            uint32_t pagesY = 0;
+            std::vector<Page> pages;
+        };
+
+        Context& m_context;
+        Desc m_desc;
+        Texture::PageSize m_pageSize;
+        uint32_t m_mipTailStart = 0;
+        std::vector<Level> m_levels;    ///< Niveles fuera de la cola de mips
+        std::shared_ptr<Texture> m_residencyMap;
+        std::vector<float> m_residencyData;
+        bool m_residencyDirty = true;
+        uint64_t m_frame = 1;
+        Statistics m_statistics;
+
+        Page* findPage(uint32_t mipLevel, uint32_t pageX, uint32_t pageY);
+        const Page* findPage(uint32_t mipLevel, uint32_t pageX, uint32_t pageY) const;
+        Texture::Region pageRegion(uint32_t mipLevel, uint32_t pageX, uint32_t pageY) const;
+        bool parentResident(uint32_t mipLevel, uint32_t pageX, uint32_t pageY) const;
+        bool hasResidentChildren(uint32_t mipLevel, uint32_t pageX, uint32_t pageY) const;
+        void commitPage(uint32_t mipLevel, uint32_t pageX, uint32_t pageY);
+        void evictPage(uint32_t mipLevel, uint32_t pageX, uint32_t pageY);
+        bool evictLeastRecentlyUsed();
+        void updateResidencyMap();
+    };
+
+} // namespace pgrender
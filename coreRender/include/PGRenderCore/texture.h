@@ -1,13 +1,17 @@
 #pragma once
 #include <cstdint>
+#include <memory>
 #include "core.h"
 
 namespace pgrender {
 
+    class Sampler;
+
     /**
      * @brief Clase que representa una textura en GPU.
      *
-     * Soporta texturas 1D, 2D, 3D, cubemaps y buffers de textura, con formatos comunes y niveles MIP.
+     * Soporta texturas 1D, 2D, 3D, cubemaps, arrays 2D y de cubemaps y buffers de textura, con
+     * formatos comunes y niveles MIP.
      */
     class Texture {
     public:
@@ -21,6 +25,8 @@ namespace pgrender {
             Texture3D,
             TextureCube,
             TextureBuffer,
+            Texture2DArray,         ///< Desc::arrayLayers capas 2D del mismo tamao
+            TextureCubeArray,       ///< Desc::arrayLayers cubemaps (arrayLayers * 6 caras)
             // Opcionales: , TextureRectangle, etc.
         };
 
@@ -42,6 +48,35 @@ namespace pgrender {
             RGBA32F,
             Depth24Stencil8,
             Depth32F,
+            SRGB8_A8,           ///< RGBA8 con RGB en sRGB
+            RGB10_A2,           ///< RGB 10 bits + A 2 bits normalizados
+            R11G11B10F,         ///< RGB HDR empaquetado en 32 bits, sin alfa ni signo
+            R32UI,              ///< Entero sin signo (usampler/uimage)
+            RG16UI,
+            Depth16,
+            Depth24,
+
+            // Formatos comprimidos por bloques (4x4 salvo ASTC)
+            BC1,                ///< RGB(A) 4 bpp (DXT1)
+            BC1_SRGB,
+            BC3,                ///< RGBA 8 bpp (DXT5)
+            BC3_SRGB,
+            BC4,                ///< R 4 bpp (RGTC1)
+            BC5,                ///< RG 8 bpp (RGTC2), normal maps
+            BC6H_UF16,          ///< RGB HDR sin signo 8 bpp
+            BC6H_SF16,          ///< RGB HDR con signo 8 bpp
+            BC7,                ///< RGBA 8 bpp alta calidad
+            BC7_SRGB,
+            ETC2_RGB8,          ///< RGB 4 bpp
+            ETC2_RGB8_SRGB,
+            ETC2_RGBA8,         ///< RGBA 8 bpp (ETC2 + EAC)
+            ETC2_RGBA8_SRGB,
+            ASTC_4x4,           ///< RGBA 8 bpp
+            ASTC_4x4_SRGB,
+            ASTC_6x6,           ///< RGBA 3.56 bpp
+            ASTC_6x6_SRGB,
+            ASTC_8x8,           ///< RGBA 2 bpp
+            ASTC_8x8_SRGB,
             // Se pueden ampliar a otros formatos segn soporte
         };
 
@@ -53,23 +88,140 @@ namespace pgrender {
             uint32_t width;          ///< Ancho en pxeles.
             uint32_t height;         ///< Alto en pxeles (si aplica).
             uint32_t depth;          ///< Profundidad (si es 3D).
+            uint32_t arrayLayers = 1; ///< Nmero de capas (Texture2DArray) o de cubemaps (TextureCubeArray).
             uint16_t mipLevels;     ///< Nmero de niveles MIP.
             Format format;           ///< Formato interno.
-            bool mipmapped = false;  ///< Si genera mipmaps automticamente.
+            uint32_t sampleCount = 1; ///< Nmero de muestras por texel (slo Texture2DMultisample).
+            bool mipmapped = false;  ///< Regenera los mips en GPU al actualizar el nivel base con update() (mipLevels <= 1 = cadena completa).
             bool immutable = false;  ///< Textura inmutable (no se puede modificar despus).
             bool storageTexture = false; ///< Permitir uso como almacenamiento
+            bool sparse = false;     ///< Textura dispersa: la memoria se asigna por pginas con commitRegion.
+            uint32_t residentBaseLevel = 0; ///< Nivel MIP ms fino residente al crearla (ver setResidentBaseLevel).
             // Otros flags como anisotropa, muestreo, etc.
         };
 
+        /**
+         * @brief Regin de un nivel MIP, en texels.
+         * En cubemaps y arrays z y depth direccionan capas (ver getLayerCount).
+         */
+        struct Region {
+            uint32_t x = 0;
+            uint32_t y = 0;
+            uint32_t z = 0;
+            uint32_t width = 0;
+            uint32_t height = 0;
+            uint32_t depth = 1;
+            uint32_t mipLevel = 0;
+        };
+
+        /**
+         * @brief Tamao de pgina de una textura dispersa, en texels.
+         */
+        struct PageSize {
+            uint32_t width = 0;
+            uint32_t height = 0;
+            uint32_t depth = 0;
+        };
+
         /**
          * @brief Actualiza la textura con datos desde CPU.
          * @param pixelData Datos en memoria de la textura.
          * @param dataSize Tamao en bytes.
          * @param mipLevel Nivel MIP a actualizar.
-         * @param arrayLayer Capa de array (si aplica).
+         * @param arrayLayer Capa a actualizar en cubemaps y arrays (cubemap * 6 + cara en TextureCubeArray).
          */
         virtual void update(const void* pixelData, size_t dataSize, uint32_t mipLevel = 0, uint32_t arrayLayer = 0) = 0;
 
+        /**
+         * @brief Actualiza una regin de un nivel MIP con datos desde CPU.
+         * @param region Regin destino (debe estar dentro del nivel).
+         * @param pixelData Datos de la regin, filas consecutivas sin padding.
+         * @param dataSize Tamao en bytes.
+         */
+        virtual void updateRegion(const Region& region, const void* pixelData, size_t dataSize) = 0;
+
+        // ===== STREAMING DE MIPS =====
+
+        /**
+         * @brief Cambia el nivel MIP ms fino residente; los niveles anteriores dejan de muestrearse.
+         * En texturas no dispersas el almacenamiento se reasigna slo con los niveles
+         * [baseLevel, mipLevels), conservando el contenido de los niveles comunes; los niveles
+         * nuevos quedan sin inicializar y deben subirse con update(). Cambia el handle nativo:
+         * las unidades de textura vinculadas y los render targets que la usan pasan al nuevo
+         * automticamente, pero las unidades de imagen (bindImage) deben vincularse de nuevo.
+         * No se permite si la textura tiene handles bindless (ver hasBindlessHandles).
+         * En texturas dispersas slo se limita el muestreo: la asignacin de los niveles
+         * corresponde a quien llama (commitRegion).
+         * @throws std::out_of_range si baseLevel >= mipLevels.
+         * @throws std::runtime_error si la textura tiene handles bindless.
+         */
+        virtual void setResidentBaseLevel(uint32_t baseLevel) = 0;
+
+        /**
+         * @brief Nivel MIP ms fino residente.
+         */
+        virtual uint32_t getResidentBaseLevel() const = 0;
+
+        /**
+         * @brief Establece el sesgo de LOD aplicado al muestrear la textura.
+         * Valores positivos seleccionan mips ms gruesos. Es un parmetro de la textura: no
+         * afecta al muestreo con un Sampler, que usa su propio sesgo.
+         * @throws std::runtime_error si la textura tiene handles bindless.
+         */
+        virtual void setLodBias(float bias) = 0;
+
+        /**
+         * @brief Regenera en GPU los niveles MIP a partir del nivel base residente (filtro de caja).
+         * Para mips de ms calidad o de texturas comprimidas ver MipGenerator.
+         * @throws std::runtime_error si el formato es comprimido o la textura es multisample o buffer.
+         */
+        virtual void generateMipmaps() = 0;
+
+        // ===== TEXTURAS DISPERSAS (Desc::sparse) =====
+
+        /**
+         * @brief Asigna (commit) o libera la memoria de las pginas que cubren una regin.
+         * La regin debe estar alineada al tamao de pgina, salvo en los bordes del nivel.
+         * Los niveles a partir de getSparseMipTailStart() forman la cola de mips y se
+         * asignan como un bloque: la regin debe cubrir el nivel completo.
+         * @throws std::runtime_error si la textura no es dispersa.
+         */
+        virtual void commitRegion(const Region& region, bool commit) = 0;
+
+        /**
+         * @brief Tamao de pgina elegido para esta textura (0 si no es dispersa).
+         */
+        virtual PageSize getSparsePageSize() const = 0;
+
+        /**
+         * @brief Primer nivel MIP de la cola de mips (niveles ms pequeos que una pgina).
+         */
+        virtual uint32_t getSparseMipTailStart() const = 0;
+
+        /**
+         * @brief Obtiene un handle bindless de 64 bits para la combinacin textura + sampler,
+         * hacindolo residente. El handle puede escribirse en un UBO/SSBO y usarse
+         * directamente desde el shader sin vincular unidades de textura.
+         * Tras crear el primer handle los parmetros de la textura quedan fijados.
+         * @param sampler Sampler a usar (nullptr = parmetros de muestreo de la propia textura).
+         * @throws std::runtime_error si el backend no soporta texturas bindless.
+         */
+        virtual uint64_t getBindlessHandle(const std::shared_ptr<Sampler>& sampler = nullptr) = 0;
+
+        /**
+         * @brief Cambia la residencia de un handle obtenido con getBindlessHandle.
+         * Slo los handles residentes pueden usarse en shaders.
+         * @param handle Handle bindless de esta textura.
+         * @param resident true para hacerlo residente, false para liberarlo.
+         */
+        virtual void setBindlessHandleResident(uint64_t handle, bool resident) = 0;
+
+        /**
+         * @brief Indica si se ha creado algn handle bindless. Los handles viven tanto como la
+         * textura, as que desde entonces sus parmetros de muestreo y su nivel base no cambian.
+         */
+        virtual bool hasBindlessHandles() const = 0;
+
         /**
          * @brief Destructor virtual.
          */
@@ -86,6 +238,51 @@ namespace pgrender {
          */
         virtual uint64_t nativeHandle() const = 0;
 
+        // ===== TAMAOS =====
+
+        /**
+         * @brief Bytes por texel de un formato sin comprimir.
+         * @throws std::invalid_argument si el formato est comprimido por bloques.
+         */
+        static uint32_t getBytesPerPixel(Format format);
+
+        /**
+         * @brief Indica si el formato est comprimido por bloques.
+         */
+        static bool isCompressedFormat(Format format);
+
+        /**
+         * @brief Ancho y alto en texels de un bloque (1 en formatos sin comprimir).
+         */
+        static uint32_t getBlockWidth(Format format);
+        static uint32_t getBlockHeight(Format format);
+
+        /**
+         * @brief Bytes de un bloque (bytes por texel en formatos sin comprimir).
+         */
+        static uint32_t getBlockSizeBytes(Format format);
+
+        /**
+         * @brief Bytes de una fila de bloques (o de texels) de la anchura indicada, sin padding.
+         */
+        static size_t getRowPitch(Format format, uint32_t width);
+
+        /**
+         * @brief Bytes de una imagen de width x height x depth texels, sin padding.
+         */
+        static size_t getImageSize(Format format, uint32_t width, uint32_t height, uint32_t depth = 1);
+
+        /**
+         * @brief Bytes que ocupa un nivel MIP completo (todas las caras/capas).
+         */
+        static size_t getLevelSizeBytes(const Desc& desc, uint32_t mipLevel);
+
+        /**
+         * @brief Nmero de capas direccionables con Region::z: caras en cubemaps, capas en arrays
+         * (arrayLayers * 6 en TextureCubeArray) y 1 en el resto de tipos.
+         */
+        static uint32_t getLayerCount(const Desc& desc);
+
         BACKEND_CHECKER
         CAST_HELPERS
     };
@@ -0,0 +1,80 @@
+#pragma once
+#include "texture.h"
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    class ThreadPool;
+
+    /**
+     * @brief Compresor por bloques en CPU (BC1, BC4, BC5 y BC7) para texturas generadas en ejecución.
+     *
+     * La entrada es siempre RGBA8 sin padding entre filas; BC4 usa el canal R y BC5 los canales
+     * R y G. Los bloques incompletos del borde se rellenan repitiendo el último texel. Las filas
+     * de bloques se reparten entre los hilos del ThreadPool y la búsqueda de índices usa SSE4.1
+     * cuando la CPU lo soporta; el resultado es idéntico con o sin SIMD y con cualquier número
+     * de hilos.
+     *
+     * BC7 se codifica en el modo 6 (RGBA con endpoints de 7 bits + p-bit e índices de 4 bits),
+     * adecuado para texturas sin particiones claras de color.
+     */
+    class TextureEncoder {
+    public:
+        /**
+         * @brief Compromiso entre velocidad y calidad.
+         */
+        enum class Quality {
+            Fast,       ///< Endpoints de la caja envolvente, sin refinamiento
+            Normal,     ///< Eje principal (PCA) y una iteración de mínimos cuadrados
+            High        ///< PCA, varias iteraciones y búsqueda exhaustiva de p-bits en BC7
+        };
+
+        /**
+         * @brief Opciones de compresión.
+         */
+        struct Options {
+            Quality quality = Quality::Normal;
+            ThreadPool* threadPool = nullptr;   ///< nullptr = comprimir en el hilo que llama
+            bool useSimd = true;                ///< Permitir la ruta SSE4.1 si la CPU la soporta
+        };
+
+        /**
+         * @brief Indica si el formato puede generarse con encode().
+         */
+        static bool canEncode(Texture::Format format);
+
+        /**
+         * @brief Indica si la CPU soporta la ruta SIMD del compresor.
+         */
+        static bool isSimdSupported();
+
+        /**
+         * @brief Comprime una imagen RGBA8.
+         * @return Bloques en orden de filas, Texture::getImageSize(format, width, height) bytes.
+         * @throws std::invalid_argument si el formato no se puede codificar o la imagen está vacía.
+         */
+        static std::vector<uint8_t> encode(const uint8_t* rgba, uint32_t width, uint32_t height,
+            Texture::Format format, const Options& options);
+
+        /**
+         * @brief Descomprime bloques a RGBA8 (BC4 replica R en G y B; BC5 deja B a 0).
+         * Sólo se decodifican los modos que genera encode(): BC7 debe usar el modo 6.
+         * @throws std::runtime_error si un bloque BC7 usa otro modo.
+         */
+        static std::vector<uint8_t> decode(const uint8_t* blocks, uint32_t width, uint32_t height,
+            Texture::Format format);
+
+        /**
+         * @brief Comprime una imagen RGBA8 al formato de la textura y la sube a un nivel MIP.
+         * @throws std::invalid_argument si el formato de la textura no se puede codificar.
+         */
+        static void upload(Texture& texture, const uint8_t* rgba, uint32_t mipLevel, uint32_t arrayLayer,
+            const Options& options);
+
+        TextureEncoder() = delete;
+    };
+
+} // namespace pgrender
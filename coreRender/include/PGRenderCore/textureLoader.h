@@ -0,0 +1,75 @@
+#pragma once
+#include "texture.h"
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    class Context;
+
+    /**
+     * @brief Carga de texturas desde contenedores DDS y KTX2.
+     *
+     * Los datos se suben tal cual están en el fichero: los formatos comprimidos por bloques
+     * (BC, ETC2, ASTC) llegan a la GPU sin descomprimir y con la cadena de mips precalculada.
+     * Se admiten texturas 1D, 2D, 3D, cubemaps y arrays 2D y de cubemaps, sin supercompresión.
+     * Las cabeceras con dimensiones mayores que los mínimos garantizados por OpenGL 4.5
+     * (16384 texels por lado, 2048 en texturas 3D y 2048 capas) se rechazan como no válidas.
+     */
+    class TextureLoader {
+    public:
+        /**
+         * @brief Posición de un nivel MIP de una capa/cara dentro de TextureData::bytes.
+         */
+        struct Subresource {
+            uint32_t mipLevel = 0;
+            uint32_t layer = 0;     ///< Capa (en cubemaps, capa * 6 + cara); argumento arrayLayer de Texture::update
+            size_t offset = 0;
+            size_t size = 0;
+        };
+
+        /**
+         * @brief Contenido de un fichero de textura, listo para createTexture().
+         */
+        struct TextureData {
+            Texture::Desc desc{};
+            std::vector<uint8_t> bytes;
+            std::vector<Subresource> subresources;
+        };
+
+        /**
+         * @brief Carga un fichero DDS o KTX2 (detectado por su cabecera).
+         * @throws std::runtime_error si no se puede leer o el formato no está soportado.
+         */
+        static TextureData loadFromFile(const std::string& path);
+
+        /**
+         * @brief Interpreta un fichero DDS o KTX2 ya cargado en memoria.
+         * @throws std::runtime_error si el contenido no es válido o no está soportado.
+         */
+        static TextureData loadFromMemory(const void* data, size_t size);
+
+        /**
+         * @brief Interpreta un fichero DDS (cabecera clásica o DX10).
+         */
+        static TextureData loadDDS(const void* data, size_t size);
+
+        /**
+         * @brief Interpreta un fichero KTX2 sin supercompresión.
+         */
+        static TextureData loadKTX2(const void* data, size_t size);
+
+        /**
+         * @brief Crea la textura y sube todos sus niveles.
+         * @throws std::runtime_error si el dispositivo no soporta el formato (Context::isFormatSupported).
+         */
+        static std::shared_ptr<Texture> createTexture(Context& context, const TextureData& data);
+
+        TextureLoader() = delete;
+    };
+
+} // namespace pgrender
@@ -0,0 +1,123 @@
+#pragma once
+#include "texture.h"
+
+#include <memory>
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    /**
+     * @brief Streaming de niveles MIP con presupuesto global de memoria.
+     *
+     * Las texturas registradas empiezan con sólo su mip más grueso residente y van bajando
+     * su nivel base residente (Texture::setResidentBaseLevel) un nivel por update() hasta el
+     * que corresponde a su tamaño en pantalla. Cuando cargar un nivel superaría el presupuesto
+     * se liberan primero los niveles más finos que ya no hacen falta y después los de las
+     * texturas de menor prioridad.
+     *
+     * En texturas dispersas los niveles se asignan y liberan con commitRegion; la cola de mips
+     * se mantiene siempre residente. En el resto se reasigna el almacenamiento.
+     *
+     * Para que no se note el salto de detalle, un nivel recién cargado empieza con un sesgo de
+     * LOD de 1 (Texture::setLodBias), que baja hasta 0 en lodFadeFrames llamadas a update().
+     * El sesgo es un parámetro de la textura: la transición no se ve si se muestrea con un
+     * Sampler, que aplica su propio sesgo; el nivel base residente sí se respeta siempre.
+     *
+     * Los handles bindless fijan el estado de la textura (Texture::hasBindlessHandles): no se
+     * pueden registrar texturas que ya los tengan, y las que los obtienen después se quedan
+     * con los niveles que tuvieran residentes hasta que se quitan del streamer.
+     */
+    class TextureStreamer {
+    public:
+        /**
+         * @brief Callback que sube un nivel MIP recién residente (p.ej. con Texture::update).
+         */
+        using MipLoader = std::function<void(Texture& texture, uint32_t mipLevel)>;
+
+        /**
+         * @brief Parámetros de configuración.
+         */
+        struct Desc {
+            size_t memoryBudgetBytes = 256u * 1024u * 1024u;   ///< Memoria máxima de las texturas gestionadas
+            uint32_t maxLevelsPerFrame = 8;                    ///< Niveles cargados como máximo por update()
+            uint32_t lodFadeFrames = 4;                        ///< Frames de transición de un nivel nuevo (0 = sin transición)
+        };
+
+        /**
+         * @brief Estadísticas de streaming.
+         */
+        struct Statistics {
+            size_t residentBytes = 0;       ///< Memoria residente de las texturas gestionadas
+            uint32_t textures = 0;          ///< Texturas registradas
+            uint32_t pendingTextures = 0;   ///< Texturas que no alcanzan el nivel deseado
+            uint64_t levelsLoaded = 0;      ///< Niveles cargados en total
+            uint64_t levelsEvicted = 0;     ///< Niveles liberados en total
+        };
+
+        explicit TextureStreamer(const Desc& desc);
+        ~TextureStreamer() = default;
+
+        TextureStreamer(const TextureStreamer&) = delete;
+        TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+        /**
+         * @brief Registra una textura y carga su nivel más grueso.
+         * Para no reservar la cadena completa, las texturas no dispersas deberían crearse con
+         * Desc::residentBaseLevel = mipLevels - 1.
+         * @throws std::invalid_argument si la textura tiene handles bindless.
+         */
+        void add(const std::shared_ptr<Texture>& texture, MipLoader loader);
+
+        /**
+         * @brief Deja de gestionar una textura (conserva sus niveles residentes).
+         */
+        void remove(const std::shared_ptr<Texture>& texture);
+
+        /**
+         * @brief Actualiza la prioridad de una textura con su tamaño en pantalla.
+         * @param screenSize Tamaño máximo en píxeles con el que se ve (0 = no visible).
+         */
+        void setScreenSize(const std::shared_ptr<Texture>& texture, float screenSize);
+
+        /**
+         * @brief Carga y libera niveles según prioridades y presupuesto.
+         */
+        void update();
+
+        void setMemoryBudget(size_t bytes) { m_desc.memoryBudgetBytes = bytes; }
+        size_t getMemoryBudget() const { return m_desc.memoryBudgetBytes; }
+
+        const Statistics& getStatistics() const { return m_statistics; }
+
+        /**
+         * @brief Nivel MIP cuyo tamaño se ajusta a screenSize píxeles.
+         */
+        static uint32_t desiredBaseLevel(const Texture::Desc& desc, float screenSize);
+
+    private:
+        struct Entry {
+            std::shared_ptr<Texture> texture;
+            MipLoader loader;
+            float screenSize = 0.0f;
+            uint32_t baseLevel = 0;         ///< Nivel más fino residente
+            uint32_t coarsestLevel = 0;     ///< Nivel que nunca se libera
+            size_t residentBytes = 0;
+            float lodBias = 0.0f;           ///< Sesgo de la transición del último nivel cargado
+        };
+
+        Desc m_desc;
+        std::vector<Entry> m_entries;
+        Statistics m_statistics;
+
+        Entry* findEntry(const Texture* texture);
+        static bool isFrozen(const Entry& entry) { return entry.texture->hasBindlessHandles(); }
+        void loadLevel(Entry& entry);
+        void evictLevel(Entry& entry);
+        void setLodBias(Entry& entry, float bias);
+        bool makeRoom(size_t bytes, const Entry* requester);
+    };
+
+} // namespace pgrender
@@ -0,0 +1,61 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    /**
+     * @brief Pool de hilos de trabajo para tareas de CPU (compresión, generación de mips...).
+     *
+     * parallelFor reparte un rango en trozos entre los hilos y el hilo que llama también
+     * procesa trozos mientras espera, por lo que puede usarse desde dentro de otra tarea
+     * del mismo pool sin bloquearse.
+     */
+    class ThreadPool {
+    public:
+        /**
+         * @param threadCount Hilos de trabajo (0 = uno menos que los núcleos disponibles, mínimo 1).
+         */
+        explicit ThreadPool(uint32_t threadCount = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Encola una tarea y devuelve un future que se completa al terminarla.
+         * Las excepciones de la tarea se propagan a través del future.
+         */
+        std::future<void> submit(std::function<void()> task);
+
+        /**
+         * @brief Ejecuta body(begin, end) sobre [0, count) en trozos de hasta grainSize
+         * elementos y espera a que terminen todos.
+         * @throws La primera excepción lanzada por body.
+         */
+        void parallelFor(size_t count, size_t grainSize, const std::function<void(size_t begin, size_t end)>& body);
+
+        /**
+         * @brief Número de hilos de trabajo.
+         */
+        uint32_t getThreadCount() const { return static_cast<uint32_t>(m_workers.size()); }
+
+    private:
+        void workerLoop();
+        void enqueue(std::function<void()> task);
+
+        std::vector<std::thread> m_workers;
+        std::deque<std::function<void()>> m_tasks;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        bool m_stopping = false;
+    };
+
+} // namespace pgrender
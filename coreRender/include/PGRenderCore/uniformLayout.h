@@ -0,0 +1,237 @@
+#pragma once
+#include "programReflection.h"
+
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/mat3x3.hpp>
+#include <glm/mat4x4.hpp>
+
+namespace pgrender {
+
+    /**
+     * @brief Reglas de empaquetado de un bloque de uniforms o de almacenamiento.
+     */
+    enum class BlockLayout {
+        Std140,     ///< UBO: arrays y columnas de matrices alineados a 16 bytes
+        Std430      ///< SSBO: arrays y columnas de matrices sin redondear a 16 bytes
+    };
+
+    /**
+     * @brief Miembro de la descripción en compilación de un bloque (ver describeUniformBlock).
+     * Las matrices se describen por columnas (column-major, como en GLSL por defecto).
+     */
+    struct UniformMember {
+        std::string_view name;
+        ProgramReflection::BaseType baseType = ProgramReflection::BaseType::Float;
+        uint32_t columns = 1;       ///< Columnas (matrices) o 1
+        uint32_t rows = 1;          ///< Componentes de un vector o filas de una matriz
+        uint32_t arraySize = 1;
+    };
+
+    /**
+     * @brief Tipo GLSL equivalente a un tipo C++; especializado para los tipos de Program::setUniform.
+     */
+    template<typename T> struct UniformTypeTraits;
+
+    template<> struct UniformTypeTraits<float> { static constexpr auto baseType = ProgramReflection::BaseType::Float; static constexpr uint32_t columns = 1, rows = 1; };
+    template<> struct UniformTypeTraits<int32_t> { static constexpr auto baseType = ProgramReflection::BaseType::Int; static constexpr uint32_t columns = 1, rows = 1; };
+    template<> struct UniformTypeTraits<uint32_t> { static constexpr auto baseType = ProgramReflection::BaseType::UInt; static constexpr uint32_t columns = 1, rows = 1; };
+    template<> struct UniformTypeTraits<glm::vec2> { static constexpr auto baseType = ProgramReflection::BaseType::Float; static constexpr uint32_t columns = 1, rows = 2; };
+    template<> struct UniformTypeTraits<glm::vec3> { static constexpr auto baseType = ProgramReflection::BaseType::Float; static constexpr uint32_t columns = 1, rows = 3; };
+    template<> struct UniformTypeTraits<glm::vec4> { static constexpr auto baseType = ProgramReflection::BaseType::Float; static constexpr uint32_t columns = 1, rows = 4; };
+    template<> struct UniformTypeTraits<glm::mat3> { static constexpr auto baseType = ProgramReflection::BaseType::Float; static constexpr uint32_t columns = 3, rows = 3; };
+    template<> struct UniformTypeTraits<glm::mat4> { static constexpr auto baseType = ProgramReflection::BaseType::Float; static constexpr uint32_t columns = 4, rows = 4; };
+
+    /**
+     * @brief Miembro de tipo T, p.ej. `uniformMember<glm::mat4>("viewProjection")`.
+     */
+    template<typename T>
+    constexpr UniformMember uniformMember(std::string_view name, uint32_t arraySize = 1) {
+        return { name, UniformTypeTraits<T>::baseType, UniformTypeTraits<T>::columns, UniformTypeTraits<T>::rows, arraySize };
+    }
+
+    /**
+     * @brief Posición de un miembro dentro del bloque (mismo significado que en ProgramReflection::Uniform).
+     */
+    struct UniformMemberLayout {
+        uint32_t offset = 0;
+        uint32_t arrayStride = 0;   ///< 0 si no es un array
+        uint32_t matrixStride = 0;  ///< 0 si no es una matriz
+    };
+
+    /**
+     * @brief Bloque descrito en compilación con sus offsets ya calculados.
+     */
+    template<size_t N>
+    struct UniformBlockDesc {
+        BlockLayout layout = BlockLayout::Std140;
+        std::array<UniformMember, N> members{};
+        std::array<UniformMemberLayout, N> layouts{};
+        uint32_t size = 0;          ///< Tamaño total, redondeado a la alineación del bloque
+
+        /**
+         * @brief Offset de un miembro; en un contexto constexpr un nombre inexistente no compila,
+         * lo que permite `static_assert(offsetof(Camera, view) == kCamera.offsetOf("view"))`.
+         */
+        constexpr uint32_t offsetOf(std::string_view name) const {
+            for (size_t i = 0; i < N; ++i) {
+                if (members[i].name == name) {
+                    return layouts[i].offset;
+                }
+            }
+            throw std::invalid_argument("Unknown uniform block member");
+        }
+
+        /**
+         * @brief Convierte la descripción al formato de la reflexión (para UniformWriter y validación).
+         */
+        ProgramReflection::Block toBlock(std::string name = {}) const {
+            ProgramReflection::Block block;
+            block.name = std::move(name);
+            block.hash = hashName(block.name);
+            block.dataSize = size;
+            for (size_t i = 0; i < N; ++i) {
+                ProgramReflection::Uniform member;
+                member.name = std::string(members[i].name);
+                member.hash = hashName(members[i].name);
+                member.baseType = members[i].baseType;
+                member.columns = members[i].columns;
+                member.rows = members[i].rows;
+                member.arraySize = members[i].arraySize;
+                member.offset = layouts[i].offset;
+                member.arrayStride = layouts[i].arrayStride;
+                member.matrixStride = layouts[i].matrixStride;
+                block.members.push_back(std::move(member));
+            }
+            return block;
+        }
+    };
+
+    namespace detail {
+
+        constexpr uint32_t alignUp(uint32_t value, uint32_t alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        constexpr uint32_t componentSize(ProgramReflection::BaseType type) {
+            return type == ProgramReflection::BaseType::Double ? 8 : 4;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Calcula en compilación los offsets de un bloque con las reglas std140 o std430.
+     *
+     * Los escalares se alinean a su tamaño, los vec2 al doble y los vec3/vec4 al cuádruple.
+     * Las matrices son arrays de columnas. En std140 los elementos de arrays y las columnas de
+     * matrices se alinean además a 16 bytes; en std430 no. Ejemplo:
+     * @code
+     * constexpr UniformMember kCameraMembers[] = {
+     *     uniformMember<glm::mat4>("viewProjection"),
+     *     uniformMember<glm::vec3>("position"),
+     *     uniformMember<float>("exposure"),
+     * };
+     * constexpr auto kCamera = describeUniformBlock(BlockLayout::Std140, kCameraMembers);
+     * static_assert(kCamera.offsetOf("exposure") == 76);
+     * @endcode
+     */
+    template<size_t N>
+    constexpr UniformBlockDesc<N> describeUniformBlock(BlockLayout layout, const UniformMember(&members)[N]) {
+        UniformBlockDesc<N> desc;
+        desc.layout = layout;
+
+        uint32_t cursor = 0;
+        uint32_t blockAlignment = layout == BlockLayout::Std140 ? 16 : 1;
+        for (size_t i = 0; i < N; ++i) {
+            const UniformMember& member = members[i];
+            const uint32_t component = detail::componentSize(member.baseType);
+
+            // Alineación de un vector (o de una columna de matriz)
+            uint32_t alignment = (member.rows == 1 ? 1 : (member.rows == 2 ? 2 : 4)) * component;
+            if (layout == BlockLayout::Std140 && (member.columns > 1 || member.arraySize > 1)) {
+                alignment = detail::alignUp(alignment, 16);
+            }
+
+            UniformMemberLayout& memberLayout = desc.layouts[i];
+            memberLayout.matrixStride = member.columns > 1 ? detail::alignUp(member.rows * component, alignment) : 0;
+            const uint32_t elementSize = member.columns > 1 ? memberLayout.matrixStride * member.columns : member.rows * component;
+            memberLayout.arrayStride = member.arraySize > 1 ? detail::alignUp(elementSize, alignment) : 0;
+            memberLayout.offset = detail::alignUp(cursor, alignment);
+
+            cursor = memberLayout.offset + (member.arraySize > 1 ? memberLayout.arrayStride * member.arraySize : elementSize);
+            blockAlignment = alignment > blockAlignment ? alignment : blockAlignment;
+            desc.members[i] = member;
+        }
+        desc.size = detail::alignUp(cursor, blockAlignment);
+        return desc;
+    }
+
+    /**
+     * @brief Comprueba que un layout esperado (p.ej. UniformBlockDesc::toBlock) coincide con el
+     * bloque que el driver enlazó: mismos miembros, tipos, offsets y strides.
+     * @throws std::invalid_argument con la lista de diferencias encontradas.
+     */
+    void validateUniformBlock(const ProgramReflection::Block& expected, const ProgramReflection::Block& actual);
+
+    /**
+     * @brief Escribe valores en la memoria de un bloque respetando su layout.
+     *
+     * Los offsets y strides salen de la reflexión del programa o de una descripción en
+     * compilación, de modo que los vec3 de los arrays std140 o las columnas de las mat3 se
+     * rellenan solos. El writer no es propietario del bloque ni de la memoria.
+     */
+    class UniformWriter {
+    public:
+        UniformWriter() = default;
+
+        /**
+         * @param layout Layout del bloque; debe vivir mientras se use el writer.
+         * @param data Memoria de al menos layout.dataSize bytes.
+         */
+        UniformWriter(const ProgramReflection::Block& layout, void* data);
+
+        bool valid() const { return m_layout != nullptr && m_data != nullptr; }
+        const ProgramReflection::Block* getLayout() const { return m_layout; }
+        void* data() const { return m_data; }
+
+        /**
+         * @throws std::invalid_argument si el bloque no tiene ese miembro, el tipo no coincide o
+         * se escribe fuera del array.
+         */
+        void set(NameHash member, float value, uint32_t arrayIndex = 0);
+        void set(NameHash member, int32_t value, uint32_t arrayIndex = 0);
+        void set(NameHash member, uint32_t value, uint32_t arrayIndex = 0);
+        void set(NameHash member, const glm::vec2& value, uint32_t arrayIndex = 0);
+        void set(NameHash member, const glm::vec3& value, uint32_t arrayIndex = 0);
+        void set(NameHash member, const glm::vec4& value, uint32_t arrayIndex = 0);
+        void set(NameHash member, const glm::mat3& value, uint32_t arrayIndex = 0);
+        void set(NameHash member, const glm::mat4& value, uint32_t arrayIndex = 0);
+        void set(NameHash member, const glm::vec4* values, uint32_t count, uint32_t firstIndex = 0);
+        void set(NameHash member, const glm::mat4* values, uint32_t count, uint32_t firstIndex = 0);
+
+        template<typename T>
+        void set(std::string_view member, const T& value, uint32_t arrayIndex = 0) {
+            set(hashName(member), value, arrayIndex);
+        }
+
+        /**
+         * @brief Copia un bloque ya empaquetado (p.ej. un struct con static_assert de su layout).
+         */
+        void setRaw(const void* data, size_t size, size_t offset = 0);
+
+    private:
+        const ProgramReflection::Block* m_layout = nullptr;
+        void* m_data = nullptr;
+
+        void write(NameHash member, ProgramReflection::BaseType baseType, uint32_t columns, uint32_t rows,
+            const void* values, uint32_t count, uint32_t firstIndex);
+    };
+
+} // namespace pgrender
@@ -0,0 +1,127 @@
+#pragma once
+#include "bufferObject.h"
+#include "uniformLayout.h"
+
+#include <memory>
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    class Context;
+
+    /**
+     * @brief Reserva por frame para los bloques de uniforms de cada objeto.
+     *
+     * Sustituye al patrón "un UBO por objeto + BufferObject::update por dibujo": los bloques
+     * se empaquetan con UniformWriter en una copia en memoria del host, se suben de una vez
+     * (una sola actualización por tramo escrito) y se vinculan por lotes con
+     * Context::bindUniformBuffers.
+     *
+     * El buffer de GPU tiene una región por frame en vuelo; beginFrame() pasa a la siguiente,
+     * así que lo que se sobrescribe se leyó hace framesInFlight frames y el driver no tiene
+     * que esperar a la GPU ni duplicar el buffer.
+     *
+     * Uso típico:
+     * @code
+     * stager.beginFrame();
+     * auto object = stager.allocate(objectLayout);
+     * object.writer.set(hashName("model"), model);
+     * stager.bind(1, object);     // sube lo pendiente y vincula el rango
+     * context.drawIndexed(...);
+     * @endcode
+     * Un bloque debe escribirse antes de la siguiente llamada a upload() o bind().
+     */
+    class UniformStager {
+    public:
+        /**
+         * @brief Parámetros de configuración.
+         */
+        struct Desc {
+            size_t frameCapacity = 1 << 20;     ///< Bytes disponibles por frame
+            uint32_t framesInFlight = 3;
+            const char* debugName = "UniformStager";
+        };
+
+        /**
+         * @brief Bloque reservado en el frame actual.
+         */
+        struct Allocation {
+            UniformWriter writer;
+            size_t offset = 0;      ///< Offset en getBuffer(), ya alineado para bindUniformBuffer
+            size_t size = 0;
+        };
+
+        /**
+         * @brief Estadísticas del frame actual.
+         */
+        struct Statistics {
+            uint32_t blocks = 0;        ///< Bloques reservados
+            size_t bytes = 0;           ///< Bytes reservados (con el relleno de alineación)
+            uint32_t uploads = 0;       ///< Actualizaciones del buffer de GPU
+            uint32_t bindCalls = 0;     ///< Llamadas a Context::bindUniformBuffers
+        };
+
+        /**
+         * @throws std::invalid_argument si la capacidad o el número de frames es 0.
+         */
+        UniformStager(Context& context, const Desc& desc);
+        ~UniformStager() = default;
+
+        UniformStager(const UniformStager&) = delete;
+        UniformStager& operator=(const UniformStager&) = delete;
+
+        /**
+         * @brief Pasa a la región del siguiente frame; invalida las reservas anteriores.
+         */
+        void beginFrame();
+
+        /**
+         * @brief Reserva un bloque (inicializado a cero) con el tamaño del layout.
+         * @param layout Layout del bloque (reflexión o UniformBlockDesc::toBlock); debe vivir
+         * mientras se use el writer.
+         * @throws std::invalid_argument si el bloque no tiene tamaño fijo.
+         * @throws std::runtime_error si no cabe en la capacidad del frame.
+         */
+        Allocation allocate(const ProgramReflection::Block& layout);
+
+        /**
+         * @brief Reserva un bloque y copia datos ya empaquetados (p.ej. un struct std140).
+         * @throws std::invalid_argument si size es 0.
+         * @throws std::runtime_error si no cabe en la capacidad del frame.
+         */
+        Allocation push(const void* data, size_t size);
+
+        /**
+         * @brief Sube al buffer de GPU lo reservado desde la última subida.
+         */
+        void upload();
+
+        /**
+         * @brief Sube lo pendiente y vincula los bloques en bindings consecutivos desde firstBinding.
+         */
+        void bind(uint32_t firstBinding, std::span<const Allocation> allocations);
+        void bind(uint32_t binding, const Allocation& allocation) { bind(binding, std::span<const Allocation>(&allocation, 1)); }
+
+        const std::shared_ptr<BufferObject>& getBuffer() const { return m_buffer; }
+        const Statistics& getStatistics() const { return m_statistics; }
+
+    private:
+        Context& m_context;
+        Desc m_desc;
+        size_t m_alignment = 256;
+        std::shared_ptr<BufferObject> m_buffer;
+        std::vector<uint8_t> m_staging;         ///< Copia del frame actual
+        std::vector<BufferRange> m_ranges;      ///< Reutilizado en bind()
+        uint32_t m_frame = 0;
+        size_t m_cursor = 0;
+        size_t m_uploaded = 0;
+        Statistics m_statistics;
+
+        size_t reserve(size_t size);
+        size_t frameBase() const { return m_frame * m_desc.frameCapacity; }
+    };
+
+} // namespace pgrender
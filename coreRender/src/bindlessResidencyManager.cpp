@@ -0,0 +1,71 @@
+#include "PGRenderCore/bindlessResidencyManager.h"
+#include <stdexcept>
+#include <functional>
+
+namespace pgrender {
+
+    BindlessResidencyManager::BindlessResidencyManager(uint32_t maxUnusedFrames)
+        : m_maxUnusedFrames(maxUnusedFrames)
+    {
+    }
+
+    BindlessResidencyManager::~BindlessResidencyManager() {
+        releaseAll();
+    }
+
+    uint64_t BindlessResidencyManager::use(const std::shared_ptr<Texture>& texture, const std::shared_ptr<Sampler>& sampler) {
+        if (!texture) {
+            throw std::invalid_argument("Cannot use a null texture");
+        }
+
+        Key key{ texture.get(), sampler.get() };
+        auto it = m_entries.find(key);
+        if (it != m_entries.end()) {
+            it->second.lastUsedFrame = m_frame;
+            return it->second.handle;
+        }
+
+        // getBindlessHandle reutiliza el handle cacheado en la textura y lo hace residente
+        Entry entry;
+        entry.texture = texture;
+        entry.sampler = sampler;
+        entry.handle = texture->getBindlessHandle(sampler);
+        entry.lastUsedFrame = m_frame;
+
+        m_entries.emplace(key, entry);
+        m_statistics.residentHandles++;
+        m_statistics.madeResident++;
+        return entry.handle;
+    }
+
+    void BindlessResidencyManager::nextFrame() {
+        m_frame++;
+
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            if (m_frame - it->second.lastUsedFrame > m_maxUnusedFrames) {
+                it->second.texture->setBindlessHandleResident(it->second.handle, false);
+                m_statistics.residentHandles--;
+                m_statistics.evictions++;
+                it = m_entries.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    void BindlessResidencyManager::releaseAll() {
+        for (auto& [key, entry] : m_entries) {
+            entry.texture->setBindlessHandleResident(entry.handle, false);
+        }
+        m_entries.clear();
+        m_statistics.residentHandles = 0;
+    }
+
+    size_t BindlessResidencyManager::KeyHasher::operator()(const Key& key) const {
+        size_t seed = std::hash<const void*>{}(key.texture);
+        seed ^= std::hash<const void*>{}(key.sampler) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+
+} // namespace pgrender
@@ -0,0 +1,82 @@
+#include "PGRenderCore/deferredReleaseQueue.h"
+#include <utility>
+
+namespace pgrender {
+
+    DeferredReleaseQueue::~DeferredReleaseQueue() {
+        flush();
+    }
+
+    void DeferredReleaseQueue::release(uint32_t type, uint32_t name) {
+        if (name == 0) {
+            return;
+        }
+        m_current.push_back({ type, name });
+        if (m_current.size() >= kMaxBatchSize) {
+            closeBatch();
+            collect();
+        }
+    }
+
+    void DeferredReleaseQueue::endFrame() {
+        closeBatch();
+        collect();
+    }
+
+    void DeferredReleaseQueue::closeBatch() {
+        if (m_current.empty()) {
+            return;
+        }
+        Batch batch;
+        batch.fence = m_backend.insertFence();
+        batch.objects = std::move(m_current);
+        m_current.clear();
+        m_batches.push_back(std::move(batch));
+    }
+
+    void DeferredReleaseQueue::collect() {
+        // Los fences se señalizan en orden: basta con mirar el lote más antiguo
+        while (!m_batches.empty()) {
+            Batch& batch = m_batches.front();
+            if (batch.fence) {
+                if (!m_backend.isFenceSignaled(batch.fence)) {
+                    return;
+                }
+                m_backend.deleteFence(batch.fence);
+            }
+            destroy(batch.objects);
+            m_batches.pop_front();
+        }
+    }
+
+    void DeferredReleaseQueue::flush() {
+        if (m_batches.empty() && m_current.empty()) {
+            return;
+        }
+        m_backend.waitIdle();
+        for (const auto& batch : m_batches) {
+            if (batch.fence) {
+                m_backend.deleteFence(batch.fence);
+            }
+            destroy(batch.objects);
+        }
+        m_batches.clear();
+        destroy(m_current);
+        m_current.clear();
+    }
+
+    size_t DeferredReleaseQueue::getPendingCount() const {
+        size_t count = m_current.size();
+        for (const auto& batch : m_batches) {
+            count += batch.objects.size();
+        }
+        return count;
+    }
+
+    void DeferredReleaseQueue::destroy(const std::vector<Object>& objects) {
+        for (const auto& object : objects) {
+            m_backend.destroy(object.type, object.name);
+        }
+    }
+
+} // namespace pgrender
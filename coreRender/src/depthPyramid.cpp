@@ -0,0 +1,296 @@
+#include "PGRenderCore/depthPyramid.h"
+#include "PGRenderCore/context.h"
+#include <stdexcept>
+#include <algorithm>
+#include <string>
+
+namespace pgrender {
+
+    namespace {
+
+        constexpr uint32_t kGroupTileSize = 32;         // Texels del primer nivel por grupo y eje
+        constexpr uint32_t kMaxLevelsPerDispatch = 8;   // Unidades de imagen garantizadas en compute
+        constexpr int32_t kSourceLodLocation = 0;
+        constexpr int32_t kLevelCountLocation = 1;
+
+        // Genera hasta 8 niveles consecutivos de la pirámide en una sola pasada
+        const char* kReduceShader = R"(
+layout(local_size_x = 16, local_size_y = 16) in;
+
+// Origen del primer nivel del dispatch: el depth (lod 0) o el nivel anterior de la pirámide
+layout(binding = 0) uniform sampler2D source;
+layout(location = 0) uniform int sourceLod;
+layout(location = 1) uniform int levelCount;    // Niveles escritos por este dispatch (1-8)
+
+layout(r32f, binding = 0) uniform writeonly image2D level0;
+layout(r32f, binding = 1) uniform writeonly image2D level1;
+layout(r32f, binding = 2) uniform writeonly image2D level2;
+layout(r32f, binding = 3) uniform writeonly image2D level3;
+layout(r32f, binding = 4) uniform writeonly image2D level4;
+layout(r32f, binding = 5) uniform coherent image2D level5;     // Lo lee el último grupo
+layout(r32f, binding = 6) uniform coherent image2D level6;
+layout(r32f, binding = 7) uniform writeonly image2D level7;
+
+layout(std430, binding = 0) coherent buffer Counter { uint finishedGroups; };
+
+shared float tile[16][16];
+shared bool isLastGroup;
+
+ivec2 levelSize(int level) {
+    switch (level) {
+    case 0: return imageSize(level0);
+    case 1: return imageSize(level1);
+    case 2: return imageSize(level2);
+    case 3: return imageSize(level3);
+    case 4: return imageSize(level4);
+    case 5: return imageSize(level5);
+    case 6: return imageSize(level6);
+    default: return imageSize(level7);
+    }
+}
+
+void storeLevel(int level, ivec2 p, float value) {
+    vec4 texel = vec4(value);
+    switch (level) {
+    case 0: imageStore(level0, p, texel); break;
+    case 1: imageStore(level1, p, texel); break;
+    case 2: imageStore(level2, p, texel); break;
+    case 3: imageStore(level3, p, texel); break;
+    case 4: imageStore(level4, p, texel); break;
+    case 5: imageStore(level5, p, texel); break;
+    case 6: imageStore(level6, p, texel); break;
+    default: imageStore(level7, p, texel); break;
+    }
+}
+
+// Lee los niveles 5 y 6, escritos en este mismo dispatch; fuera de rango devuelve el neutro
+float loadLevel(int level, ivec2 p) {
+    if (any(greaterThanEqual(p, levelSize(level)))) {
+        return NEUTRAL;
+    }
+    return level == 5 ? imageLoad(level5, p).r : imageLoad(level6, p).r;
+}
+
+// Reducción conservadora de la región del origen que cubre el texel p del primer nivel
+// (hasta 3x3 texels desde el depth, exactamente 2x2 desde el nivel anterior)
+float reduceSource(ivec2 p, ivec2 dstSize, ivec2 srcSize) {
+    ivec2 first = p * srcSize / dstSize;
+    ivec2 last = min(((p + 1) * srcSize + dstSize - 1) / dstSize, srcSize) - 1;
+    float value = NEUTRAL;
+    for (int y = first.y; y <= last.y; ++y) {
+        for (int x = first.x; x <= last.x; ++x) {
+            value = REDUCE(value, texelFetch(source, ivec2(x, y), sourceLod).r);
+        }
+    }
+    return value;
+}
+
+void main() {
+    ivec2 local = ivec2(gl_LocalInvocationID.xy);
+    ivec2 group = ivec2(gl_WorkGroupID.xy);
+
+    // Primer nivel: cada hilo genera 2x2 texels del bloque de 32x32 del grupo
+    ivec2 firstSize = imageSize(level0);
+    ivec2 srcSize = textureSize(source, sourceLod);
+    float value = NEUTRAL;
+    for (int i = 0; i < 4; ++i) {
+        ivec2 p = group * 32 + local * 2 + ivec2(i & 1, i >> 1);
+        if (all(lessThan(p, firstSize))) {
+            float texel = reduceSource(p, firstSize, srcSize);
+            imageStore(level0, p, vec4(texel));
+            value = REDUCE(value, texel);
+        }
+    }
+
+    // Niveles 1-5 en memoria compartida: en cada nivel trabaja un cuarto de los hilos del anterior.
+    // Todos los tamaños son potencias de dos, así que los texels fuera de rango valen NEUTRAL
+    for (int level = 1; level < min(levelCount, 6); ++level) {
+        int tileSize = 32 >> level;
+        bool active = all(lessThan(local, ivec2(tileSize)));
+        if (level > 1) {
+            if (active) {
+                ivec2 t = local * 2;
+                value = REDUCE(REDUCE(tile[t.y][t.x], tile[t.y][t.x + 1]),
+                               REDUCE(tile[t.y + 1][t.x], tile[t.y + 1][t.x + 1]));
+            }
+            barrier();
+        }
+        if (active) {
+            tile[local.y][local.x] = value;
+            ivec2 p = group * tileSize + local;
+            if (all(lessThan(p, levelSize(level)))) {
+                storeLevel(level, p, value);
+            }
+        }
+        barrier();
+    }
+
+    if (levelCount > 6) {
+        // El nivel 5 de este grupo debe ser visible antes de contarlo como terminado
+        memoryBarrierImage();
+        barrier();
+        if (local == ivec2(0)) {
+            uint groupCount = gl_NumWorkGroups.x * gl_NumWorkGroups.y;
+            isLastGroup = atomicAdd(finishedGroups, 1u) == groupCount - 1u;
+        }
+        barrier();
+
+        // El último grupo genera los niveles 6 y 7 a partir del nivel 5 de todos los grupos
+        if (isLastGroup) {
+            if (local == ivec2(0)) {
+                finishedGroups = 0u;    // Listo para el siguiente dispatch
+            }
+            int invocation = local.y * 16 + local.x;
+            for (int level = 6; level < levelCount; ++level) {
+                ivec2 extent = levelSize(level);
+                for (int i = invocation; i < extent.x * extent.y; i += 256) {
+                    ivec2 p = ivec2(i % extent.x, i / extent.x);
+                    ivec2 s = p * 2;
+                    float reduced = REDUCE(REDUCE(loadLevel(level - 1, s), loadLevel(level - 1, s + ivec2(1, 0))),
+                                           REDUCE(loadLevel(level - 1, s + ivec2(0, 1)), loadLevel(level - 1, s + ivec2(1, 1))));
+                    storeLevel(level, p, reduced);
+                }
+                memoryBarrierImage();
+                barrier();
+            }
+        }
+    }
+}
+)";
+
+        uint32_t levelSize(uint32_t size, uint32_t level) {
+            return std::max<uint32_t>(size >> level, 1);
+        }
+
+        uint32_t groupCount(uint32_t size) {
+            return (size + kGroupTileSize - 1) / kGroupTileSize;
+        }
+
+    } // namespace
+
+    DepthPyramid::DepthPyramid(Context& context, const Desc& desc)
+        : m_context(context), m_desc(desc)
+    {
+        std::string source = "#version 450\n";
+        source += m_desc.reduction == Reduction::Max
+            ? "#define REDUCE(a, b) max(a, b)\n#define NEUTRAL 0.0\n"
+            : "#define REDUCE(a, b) min(a, b)\n#define NEUTRAL 1.0\n";
+        source += kReduceShader;
+
+        Program::Desc programDesc;
+        programDesc.stages.push_back({ ShaderStage::Compute, source });
+        programDesc.debugName = "DepthPyramid";
+        m_program = m_context.createProgram(programDesc);
+        if (!m_program->compile()) {
+            throw std::runtime_error("Failed to compile depth pyramid shader");
+        }
+
+        Pipeline::Desc pipelineDesc;
+        pipelineDesc.program = m_program;
+        pipelineDesc.debugName = "DepthPyramid";
+        m_pipeline = m_context.createPipeline(pipelineDesc);
+
+        const uint32_t zero = 0;
+        BufferObject::Desc counterDesc;
+        counterDesc.type = BufferType::ShaderStorage;
+        counterDesc.size = sizeof(uint32_t);
+        counterDesc.data = &zero;
+        counterDesc.debugName = "DepthPyramid.Counter";
+        m_counterBuffer = m_context.createBufferObject(counterDesc);
+    }
+
+    uint32_t DepthPyramid::pyramidSizeFor(uint32_t size) {
+        uint32_t result = 1;
+        while (result * 2 <= size) {
+            result *= 2;
+        }
+        return result;
+    }
+
+    uint32_t DepthPyramid::mipCountFor(uint32_t width, uint32_t height) {
+        uint32_t size = std::max(width, height);
+        uint32_t count = 1;
+        while (size > 1) {
+            size >>= 1;
+            ++count;
+        }
+        return count;
+    }
+
+    void DepthPyramid::ensurePyramid(uint32_t width, uint32_t height) {
+        if (m_pyramid) {
+            const auto& current = m_pyramid->getDesc();
+            if (current.width == width && current.height == height) {
+                return;
+            }
+        }
+
+        m_mipCount = mipCountFor(width, height);
+
+        Texture::Desc desc;
+        desc.type = Texture::Type::Texture2D;
+        desc.width = width;
+        desc.height = height;
+        desc.depth = 1;
+        desc.mipLevels = static_cast<uint16_t>(m_mipCount);
+        desc.format = Texture::Format::R32F;
+        desc.storageTexture = true;
+        m_pyramid = m_context.createTexture(desc);
+    }
+
+    void DepthPyramid::build(const std::shared_ptr<RenderTarget>& renderTarget) {
+        if (!renderTarget) {
+            throw std::invalid_argument("Depth pyramid source render target is null");
+        }
+        auto depth = renderTarget->getDepthStencilAttachment();
+        if (!depth) {
+            throw std::invalid_argument("Render target has no depth attachment");
+        }
+        build(depth);
+    }
+
+    void DepthPyramid::build(const std::shared_ptr<Texture>& depthTexture) {
+        if (!depthTexture) {
+            throw std::invalid_argument("Depth pyramid source texture is null");
+        }
+
+        const auto& depthDesc = depthTexture->getDesc();
+        if (!getFormatInfo(depthDesc.format).isDepth()) {
+            throw std::invalid_argument("Depth pyramid source must be a depth texture");
+        }
+        if (depthDesc.type != Texture::Type::Texture2D) {
+            throw std::invalid_argument("Depth pyramid source must be a non-multisampled 2D texture");
+        }
+
+        ensurePyramid(pyramidSizeFor(depthDesc.width), pyramidSizeFor(depthDesc.height));
+        const auto& pyramidDesc = m_pyramid->getDesc();
+
+        m_context.bindPipeline(m_pipeline);
+        m_context.bindShaderStorageBuffer(m_counterBuffer, 0);
+        for (uint32_t first = 0; first < m_mipCount; first += kMaxLevelsPerDispatch) {
+            const uint32_t count = std::min(kMaxLevelsPerDispatch, m_mipCount - first);
+
+            // El primer dispatch parte del depth y los siguientes del último nivel generado
+            if (first == 0) {
+                m_context.bindTexture(depthTexture, 0);
+                m_program->setUniform(kSourceLodLocation, 0);
+            }
+            else {
+                m_context.bindTexture(m_pyramid, 0);
+                m_program->setUniform(kSourceLodLocation, static_cast<int32_t>(first - 1));
+            }
+            m_program->setUniform(kLevelCountLocation, static_cast<int32_t>(count));
+
+            for (uint32_t i = 0; i < count; ++i) {
+                const bool readBack = i == 5 || i == 6;
+                m_context.bindImage(m_pyramid, i, readBack ? ImageAccess::ReadWrite : ImageAccess::WriteOnly, first + i);
+            }
+            m_context.dispatch(groupCount(levelSize(pyramidDesc.width, first)),
+                groupCount(levelSize(pyramidDesc.height, first)));
+
+            // La pirámide se consume muestreándola (siguiente dispatch, culling, efectos en espacio de pantalla)
+            m_context.memoryBarrier(BarrierFlags::ShaderImageAccess | BarrierFlags::TextureFetch | BarrierFlags::ShaderStorage);
+        }
+    }
+
+} // namespace pgrender
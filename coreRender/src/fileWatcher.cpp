@@ -0,0 +1,105 @@
+#include "PGRenderCore/fileWatcher.h"
+#include <stdexcept>
+#include <system_error>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace pgrender {
+
+    std::string FileWatcher::normalizePath(const std::string& path) {
+        return std::filesystem::absolute(path).lexically_normal().string();
+    }
+
+#ifdef __linux__
+
+    FileWatcher::FileWatcher() {
+        m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_fd < 0) {
+            throw std::runtime_error(std::string("inotify_init1 failed: ") + std::strerror(errno));
+        }
+    }
+
+    FileWatcher::~FileWatcher() {
+        if (m_fd >= 0) {
+            close(m_fd);
+        }
+    }
+
+    void FileWatcher::watch(const std::string& path) {
+        const std::string file = normalizePath(path);
+        const std::string directory = std::filesystem::path(file).parent_path().string();
+
+        if (m_watchedDirectories.count(directory) == 0) {
+            // IN_MOVED_TO cubre a los editores que guardan con un temporal + rename
+            const int wd = inotify_add_watch(m_fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+            if (wd < 0) {
+                throw std::runtime_error("Cannot watch directory '" + directory + "': " + std::strerror(errno));
+            }
+            m_directoriesByWatch[wd] = directory;
+            m_watchedDirectories.insert(directory);
+        }
+        m_files.insert(file);
+    }
+
+    std::vector<std::string> FileWatcher::poll() {
+        std::vector<std::string> changed;
+        std::unordered_set<std::string> seen;
+
+        alignas(struct inotify_event) char buffer[4096];
+        for (;;) {
+            const ssize_t length = read(m_fd, buffer, sizeof(buffer));
+            if (length <= 0) {
+                break;  // EAGAIN: no quedan eventos
+            }
+
+            for (ssize_t offset = 0; offset < length;) {
+                const auto* event = reinterpret_cast<const struct inotify_event*>(buffer + offset);
+                offset += sizeof(struct inotify_event) + event->len;
+
+                auto directory = m_directoriesByWatch.find(event->wd);
+                if (event->len == 0 || directory == m_directoriesByWatch.end()) {
+                    continue;
+                }
+
+                std::string file = directory->second + "/" + event->name;
+                if (m_files.count(file) != 0 && seen.insert(file).second) {
+                    changed.push_back(std::move(file));
+                }
+            }
+        }
+        return changed;
+    }
+
+#else
+
+    FileWatcher::FileWatcher() = default;
+    FileWatcher::~FileWatcher() = default;
+
+    void FileWatcher::watch(const std::string& path) {
+        const std::string file = normalizePath(path);
+        std::error_code error;
+        m_writeTimes[file] = std::filesystem::last_write_time(file, error);
+        m_files.insert(file);
+    }
+
+    std::vector<std::string> FileWatcher::poll() {
+        std::vector<std::string> changed;
+        for (auto& [file, writeTime] : m_writeTimes) {
+            std::error_code error;
+            const auto current = std::filesystem::last_write_time(file, error);
+            if (!error && current != writeTime) {
+                writeTime = current;
+                changed.push_back(file);
+            }
+        }
+        return changed;
+    }
+
+#endif
+
+} // namespace pgrender
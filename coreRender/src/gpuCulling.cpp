@@ -0,0 +1,278 @@
+#include "PGRenderCore/gpuCulling.h"
+#include "PGRenderCore/context.h"
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+
+namespace pgrender {
+
+    namespace {
+
+        // Bloque de parámetros del shader (layout std140)
+        struct CullUniforms {
+            float viewProjection[16];
+            float hiZViewProjection[16];
+            float frustumPlanes[6][4];
+            float hiZSize[2];
+            uint32_t instanceCount;
+            uint32_t occlusionEnabled;
+            uint32_t hiZMipCount;
+            uint32_t padding[3];
+        };
+        static_assert(sizeof(CullUniforms) == 256, "CullUniforms must match the std140 layout");
+        static_assert(sizeof(GpuCulling::InstanceBounds) == 32, "InstanceBounds must match the std430 layout");
+        static_assert(sizeof(DrawIndexedIndirectCommand) == 20, "DrawIndexedIndirectCommand must be tightly packed");
+
+        constexpr uint32_t kGroupSize = 64;
+
+        // GLSL 4.50: el culling no necesita nada de 4.6, y drawIndexedIndirectCount recurre a
+        // GL_ARB_indirect_parameters en contextos 4.5
+        const char* kCullingShader = R"(#version 450
+layout(local_size_x = 64) in;
+
+struct InstanceBounds {
+    vec4 sphere;
+    uint indexCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint instanceId;
+};
+
+struct DrawCommand {
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint firstInstance;
+};
+
+layout(std430, binding = 0) readonly buffer Instances { InstanceBounds instances[]; };
+layout(std430, binding = 1) writeonly buffer Commands { DrawCommand commands[]; };
+layout(std430, binding = 2) buffer DrawCount { uint drawCount; };
+
+layout(std140, binding = 0) uniform CullParams {
+    mat4 viewProjection;
+    mat4 hiZViewProjection;
+    vec4 frustumPlanes[6];
+    vec2 hiZSize;
+    uint instanceCount;
+    uint occlusionEnabled;
+    uint hiZMipCount;
+};
+
+layout(binding = 0) uniform sampler2D hiZ;
+
+bool isOccluded(vec3 center, float radius) {
+    vec2 minUV = vec2(1.0);
+    vec2 maxUV = vec2(0.0);
+    float nearestDepth = 1.0;
+
+    for (int i = 0; i < 8; ++i) {
+        vec3 corner = center + radius * vec3((i & 1) != 0 ? 1.0 : -1.0,
+                                             (i & 2) != 0 ? 1.0 : -1.0,
+                                             (i & 4) != 0 ? 1.0 : -1.0);
+        vec4 clip = hiZViewProjection * vec4(corner, 1.0);
+        if (clip.w <= 0.0) {
+            return false; // Cruza el plano cercano: se considera visible
+        }
+        vec3 ndc = clip.xyz / clip.w;
+        vec2 uv = ndc.xy * 0.5 + 0.5;
+        minUV = min(minUV, uv);
+        maxUV = max(maxUV, uv);
+        nearestDepth = min(nearestDepth, ndc.z * 0.5 + 0.5);
+    }
+
+    minUV = clamp(minUV, vec2(0.0), vec2(1.0));
+    maxUV = clamp(maxUV, vec2(0.0), vec2(1.0));
+
+    // Nivel en el que el rectángulo ocupa como mucho 2x2 texels
+    vec2 extent = (maxUV - minUV) * hiZSize;
+    float level = ceil(log2(max(max(extent.x, extent.y), 1.0)));
+    int mip = int(clamp(level, 0.0, float(hiZMipCount - 1u)));
+
+    ivec2 levelSize = textureSize(hiZ, mip);
+    ivec2 p0 = clamp(ivec2(minUV * vec2(levelSize)), ivec2(0), levelSize - 1);
+    ivec2 p1 = clamp(ivec2(maxUV * vec2(levelSize)), ivec2(0), levelSize - 1);
+
+    float farthest = max(max(texelFetch(hiZ, p0, mip).r, texelFetch(hiZ, ivec2(p1.x, p0.y), mip).r),
+                         max(texelFetch(hiZ, ivec2(p0.x, p1.y), mip).r, texelFetch(hiZ, p1, mip).r));
+
+    return nearestDepth > farthest;
+}
+
+void main() {
+    uint index = gl_GlobalInvocationID.x;
+    if (index >= instanceCount) {
+        return;
+    }
+
+    InstanceBounds instance = instances[index];
+    vec3 center = instance.sphere.xyz;
+    float radius = instance.sphere.w;
+
+    for (int i = 0; i < 6; ++i) {
+        if (dot(frustumPlanes[i].xyz, center) + frustumPlanes[i].w < -radius) {
+            return;
+        }
+    }
+
+    if (occlusionEnabled != 0u && isOccluded(center, radius)) {
+        return;
+    }
+
+    uint slot = atomicAdd(drawCount, 1u);
+    commands[slot] = DrawCommand(instance.indexCount, 1u, instance.firstIndex,
+                                 instance.vertexOffset, instance.instanceId);
+}
+)";
+
+    } // namespace
+
+    GpuCulling::GpuCulling(Context& context, const Desc& desc)
+        : m_context(context), m_desc(desc)
+    {
+        if (desc.maxInstances == 0) {
+            throw std::invalid_argument("GPU culling needs a non-zero instance capacity");
+        }
+
+        BufferObject::Desc instanceDesc;
+        instanceDesc.type = BufferType::ShaderStorage;
+        instanceDesc.usage = BufferUsage::Dynamic;
+        instanceDesc.size = sizeof(InstanceBounds) * desc.maxInstances;
+        instanceDesc.debugName = "GpuCulling.Instances";
+        m_instanceBuffer = context.createBufferObject(instanceDesc);
+
+        BufferObject::Desc commandDesc;
+        commandDesc.type = BufferType::Indirect;
+        commandDesc.usage = BufferUsage::Static;
+        commandDesc.size = sizeof(DrawIndexedIndirectCommand) * desc.maxInstances;
+        commandDesc.debugName = "GpuCulling.Commands";
+        m_commandBuffer = context.createBufferObject(commandDesc);
+
+        BufferObject::Desc countDesc;
+        countDesc.type = BufferType::Indirect;
+        countDesc.usage = BufferUsage::Dynamic;
+        countDesc.size = sizeof(uint32_t);
+        countDesc.debugName = "GpuCulling.DrawCount";
+        m_drawCountBuffer = context.createBufferObject(countDesc);
+
+        BufferObject::Desc paramsDesc;
+        paramsDesc.type = BufferType::Uniform;
+        paramsDesc.usage = BufferUsage::Dynamic;
+        paramsDesc.size = sizeof(CullUniforms);
+        paramsDesc.debugName = "GpuCulling.Params";
+        m_paramsBuffer = context.createBufferObject(paramsDesc);
+
+        Program::Desc programDesc;
+        programDesc.stages.push_back({ ShaderStage::Compute, kCullingShader });
+        programDesc.debugName = "GpuCulling";
+        auto program = context.createProgram(programDesc);
+        if (!program->compile()) {
+            throw std::runtime_error("Failed to compile GPU culling shader");
+        }
+
+        Pipeline::Desc pipelineDesc;
+        pipelineDesc.program = program;
+        pipelineDesc.debugName = "GpuCulling";
+        m_pipeline = context.createPipeline(pipelineDesc);
+    }
+
+    void GpuCulling::updateInstances(const InstanceBounds* instances, uint32_t count, uint32_t firstInstance) {
+        if (count == 0) {
+            return;
+        }
+        if (!instances) {
+            throw std::invalid_argument("Instance data is null");
+        }
+        if (static_cast<uint64_t>(firstInstance) + count > m_desc.maxInstances) {
+            throw std::out_of_range("Instance range exceeds GPU culling capacity");
+        }
+
+        m_instanceBuffer->update(instances, sizeof(InstanceBounds) * count, sizeof(InstanceBounds) * firstInstance);
+    }
+
+    void GpuCulling::cull(const CullParams& params) {
+        if (params.instanceCount > m_desc.maxInstances) {
+            throw std::out_of_range("Instance count exceeds GPU culling capacity");
+        }
+
+        CullUniforms uniforms{};
+        for (int column = 0; column < 4; ++column) {
+            for (int row = 0; row < 4; ++row) {
+                uniforms.viewProjection[column * 4 + row] = params.viewProjection[column][row];
+                uniforms.hiZViewProjection[column * 4 + row] = params.hiZViewProjection[column][row];
+            }
+        }
+
+        glm::vec4 planes[6];
+        extractFrustumPlanes(params.viewProjection, planes);
+        for (int i = 0; i < 6; ++i) {
+            for (int c = 0; c < 4; ++c) {
+                uniforms.frustumPlanes[i][c] = planes[i][c];
+            }
+        }
+
+        uniforms.instanceCount = params.instanceCount;
+        if (params.hiZ) {
+            const auto& hiZDesc = params.hiZ->getDesc();
+            if (hiZDesc.format != Texture::Format::R32F) {
+                throw std::invalid_argument("Hi-Z pyramid must be an R32F texture");
+            }
+            uniforms.occlusionEnabled = 1;
+            uniforms.hiZSize[0] = static_cast<float>(hiZDesc.width);
+            uniforms.hiZSize[1] = static_cast<float>(hiZDesc.height);
+            uniforms.hiZMipCount = std::max<uint32_t>(hiZDesc.mipLevels, 1);
+        }
+
+        const uint32_t zero = 0;
+        m_drawCountBuffer->update(&zero, sizeof(zero));
+        m_paramsBuffer->update(&uniforms, sizeof(uniforms));
+        m_lastInstanceCount = params.instanceCount;
+
+        if (params.instanceCount == 0) {
+            return;
+        }
+
+        m_context.bindPipeline(m_pipeline);
+        const BufferRange storageBuffers[] = { { m_instanceBuffer }, { m_commandBuffer }, { m_drawCountBuffer } };
+        m_context.bindShaderStorageBuffers(0, storageBuffers);
+        m_context.bindUniformBuffer(m_paramsBuffer, 0);
+        if (params.hiZ) {
+            m_context.bindTexture(params.hiZ, 0);
+        }
+
+        m_context.dispatch((params.instanceCount + kGroupSize - 1) / kGroupSize);
+
+        // Los comandos y el contador se leen como parámetros de dibujo indirecto
+        m_context.memoryBarrier(BarrierFlags::Command | BarrierFlags::ShaderStorage);
+    }
+
+    void GpuCulling::draw() {
+        if (m_lastInstanceCount == 0) {
+            return;
+        }
+
+        m_context.drawIndexedIndirectCount(m_commandBuffer, 0, m_drawCountBuffer, 0, m_lastInstanceCount);
+    }
+
+    void GpuCulling::extractFrustumPlanes(const glm::mat4& m, glm::vec4 planes[6]) {
+        // Gribb-Hartmann: combinaciones de la fila 3 con las filas 0, 1 y 2 (glm es column-major)
+        for (int axis = 0; axis < 3; ++axis) {
+            for (int side = 0; side < 2; ++side) {
+                const float sign = side == 0 ? 1.0f : -1.0f;
+                glm::vec4& plane = planes[axis * 2 + side];
+                for (int c = 0; c < 4; ++c) {
+                    plane[c] = m[c][3] + sign * m[c][axis];
+                }
+
+                const float length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+                if (length > 0.0f) {
+                    for (int c = 0; c < 4; ++c) {
+                        plane[c] /= length;
+                    }
+                }
+            }
+        }
+    }
+
+} // namespace pgrender
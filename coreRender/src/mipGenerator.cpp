@@ -0,0 +1,384 @@
+#include "PGRenderCore/mipGenerator.h"
+#include "PGRenderCore/threadPool.h"
+#include <stdexcept>
+#include <algorithm>
+#include <functional>
+#include <array>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define PGRENDER_MIPGEN_SSE 1
+#include <xmmintrin.h>
+#else
+#define PGRENDER_MIPGEN_SSE 0
+#endif
+
+namespace pgrender {
+
+    namespace {
+
+        using Filter = MipGenerator::Filter;
+
+        constexpr uint32_t kRowsPerTask = 8;
+        constexpr float kPi = 3.14159265358979323846f;
+
+        // Imagen RGBA en coma flotante (lineal si Options::srgb)
+        struct Image {
+            uint32_t width = 0;
+            uint32_t height = 0;
+            std::vector<float> texels;
+        };
+
+        // Pesos de los texels de origen que contribuyen a un texel destino
+        struct Taps {
+            int first = 0;
+            std::vector<float> weights;
+        };
+
+        // ===== sRGB =====
+
+        float srgbToLinear(float value) {
+            return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+
+        const std::array<float, 256>& srgbDecodeTable() {
+            static const std::array<float, 256> table = [] {
+                std::array<float, 256> values{};
+                for (int i = 0; i < 256; ++i) {
+                    values[i] = srgbToLinear(i / 255.0f);
+                }
+                return values;
+            }();
+            return table;
+        }
+
+        // Valor lineal en el punto medio entre cada par de códigos sRGB consecutivos:
+        // la codificación elige el código más cercano en espacio sRGB sin evaluar pow()
+        const std::array<float, 255>& srgbEncodeThresholds() {
+            static const std::array<float, 255> table = [] {
+                std::array<float, 255> values{};
+                for (int i = 0; i < 255; ++i) {
+                    values[i] = srgbToLinear((i + 0.5f) / 255.0f);
+                }
+                return values;
+            }();
+            return table;
+        }
+
+        uint8_t encodeSrgb(float linear) {
+            const auto& thresholds = srgbEncodeThresholds();
+            return static_cast<uint8_t>(std::upper_bound(thresholds.begin(), thresholds.end(), linear) - thresholds.begin());
+        }
+
+        uint8_t encodeUnorm(float value) {
+            return static_cast<uint8_t>(std::floor(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f));
+        }
+
+        // ===== FILTROS =====
+
+        float sinc(float x) {
+            if (x == 0.0f) {
+                return 1.0f;
+            }
+            const float px = kPi * x;
+            return std::sin(px) / px;
+        }
+
+        float besselI0(float x) {
+            float sum = 1.0f;
+            float term = 1.0f;
+            const float halfX = x * 0.5f;
+            for (int k = 1; k < 32 && term > sum * 1e-8f; ++k) {
+                term *= (halfX / k) * (halfX / k);
+                sum += term;
+            }
+            return sum;
+        }
+
+        float filterSupport(Filter filter) {
+            return filter == Filter::Box ? 0.5f : 3.0f;
+        }
+
+        float evaluateFilter(Filter filter, float x) {
+            x = std::fabs(x);
+            switch (filter) {
+            case Filter::Box:
+                return x <= 0.5f ? 1.0f : 0.0f;
+            case Filter::Lanczos:
+                return x < 3.0f ? sinc(x) * sinc(x / 3.0f) : 0.0f;
+            default: {
+                // Kaiser: ancho 3, alpha 4
+                constexpr float kWidth = 3.0f;
+                constexpr float kAlpha = 4.0f;
+                if (x >= kWidth) {
+                    return 0.0f;
+                }
+                const float t = x / kWidth;
+                return sinc(x) * besselI0(kAlpha * std::sqrt(1.0f - t * t)) / besselI0(kAlpha);
+            }
+            }
+        }
+
+        // Pesos normalizados de cada texel destino; el filtro se escala al tamaño del texel destino
+        std::vector<Taps> computeTaps(uint32_t sourceSize, uint32_t targetSize, Filter filter) {
+            const float scale = static_cast<float>(sourceSize) / static_cast<float>(targetSize);
+            const float radius = filterSupport(filter) * scale;
+
+            std::vector<Taps> result(targetSize);
+            for (uint32_t d = 0; d < targetSize; ++d) {
+                const float center = (d + 0.5f) * scale;
+                const int first = static_cast<int>(std::floor(center - radius));
+                const int last = static_cast<int>(std::ceil(center + radius));
+
+                Taps& taps = result[d];
+                float sum = 0.0f;
+                for (int i = first; i <= last; ++i) {
+                    const float weight = evaluateFilter(filter, (i + 0.5f - center) / scale);
+                    if (weight == 0.0f && taps.weights.empty()) {
+                        continue;
+                    }
+                    if (taps.weights.empty()) {
+                        taps.first = i;
+                    }
+                    taps.weights.push_back(weight);
+                    sum += weight;
+                }
+                while (!taps.weights.empty() && taps.weights.back() == 0.0f) {
+                    taps.weights.pop_back();
+                }
+                for (float& weight : taps.weights) {
+                    weight /= sum;
+                }
+            }
+            return result;
+        }
+
+        // ===== CONVOLUCIÓN =====
+
+        // Acumula los texels line[i * stride] ponderados por taps (índices fijados al borde).
+        // Ambas rutas suman en el mismo orden, por lo que dan el mismo resultado.
+        using AccumulateFn = void (*)(const float* line, size_t stride, uint32_t length, const Taps& taps, float* out);
+
+        void accumulateScalar(const float* line, size_t stride, uint32_t length, const Taps& taps, float* out) {
+            float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            const int last = static_cast<int>(length) - 1;
+            for (size_t t = 0; t < taps.weights.size(); ++t) {
+                const int index = std::clamp(taps.first + static_cast<int>(t), 0, last);
+                const float* texel = line + static_cast<size_t>(index) * stride;
+                const float weight = taps.weights[t];
+                for (int c = 0; c < 4; ++c) {
+                    sum[c] = sum[c] + weight * texel[c];
+                }
+            }
+            std::copy(sum, sum + 4, out);
+        }
+
+#if PGRENDER_MIPGEN_SSE
+        void accumulateSse(const float* line, size_t stride, uint32_t length, const Taps& taps, float* out) {
+            __m128 sum = _mm_setzero_ps();
+            const int last = static_cast<int>(length) - 1;
+            for (size_t t = 0; t < taps.weights.size(); ++t) {
+                const int index = std::clamp(taps.first + static_cast<int>(t), 0, last);
+                const __m128 texel = _mm_loadu_ps(line + static_cast<size_t>(index) * stride);
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(taps.weights[t]), texel));
+            }
+            _mm_storeu_ps(out, sum);
+        }
+#endif
+
+        void runRows(uint32_t rows, ThreadPool* threadPool, const std::function<void(size_t, size_t)>& body) {
+            if (threadPool) {
+                threadPool->parallelFor(rows, kRowsPerTask, body);
+            }
+            else {
+                body(0, rows);
+            }
+        }
+
+        Image downsample(const Image& source, Filter filter, AccumulateFn accumulate, ThreadPool* threadPool) {
+            Image target;
+            target.width = std::max(source.width / 2, 1u);
+            target.height = std::max(source.height / 2, 1u);
+            target.texels.resize(static_cast<size_t>(target.width) * target.height * 4);
+
+            const std::vector<Taps> horizontal = computeTaps(source.width, target.width, filter);
+            const std::vector<Taps> vertical = computeTaps(source.height, target.height, filter);
+
+            // Pasada horizontal: source.height filas de target.width texels
+            std::vector<float> intermediate(static_cast<size_t>(target.width) * source.height * 4);
+            runRows(source.height, threadPool, [&](size_t begin, size_t end) {
+                for (size_t y = begin; y < end; ++y) {
+                    const float* row = source.texels.data() + y * source.width * 4;
+                    for (uint32_t x = 0; x < target.width; ++x) {
+                        accumulate(row, 4, source.width, horizontal[x], intermediate.data() + (y * target.width + x) * 4);
+                    }
+                }
+            });
+
+            // Pasada vertical; los lóbulos negativos pueden salirse de [0, 1]
+            runRows(target.height, threadPool, [&](size_t begin, size_t end) {
+                const size_t stride = static_cast<size_t>(target.width) * 4;
+                for (size_t y = begin; y < end; ++y) {
+                    for (uint32_t x = 0; x < target.width; ++x) {
+                        float* out = target.texels.data() + (y * target.width + x) * 4;
+                        accumulate(intermediate.data() + x * 4, stride, source.height, vertical[y], out);
+                        for (int c = 0; c < 4; ++c) {
+                            out[c] = std::clamp(out[c], 0.0f, 1.0f);
+                        }
+                    }
+                }
+            });
+
+            return target;
+        }
+
+        // ===== COBERTURA DE ALFA =====
+
+        float alphaCoverage(const Image& image, float scale, float cutoff) {
+            size_t covered = 0;
+            const size_t count = static_cast<size_t>(image.width) * image.height;
+            for (size_t i = 0; i < count; ++i) {
+                if (std::min(image.texels[i * 4 + 3] * scale, 1.0f) >= cutoff) {
+                    ++covered;
+                }
+            }
+            return static_cast<float>(covered) / static_cast<float>(count);
+        }
+
+        // Escala de alfa con la que el nivel alcanza la cobertura deseada (búsqueda binaria)
+        float findAlphaScale(const Image& image, float targetCoverage, float cutoff) {
+            float low = 0.0f;
+            float high = 4.0f;
+            for (int iteration = 0; iteration < 24; ++iteration) {
+                const float middle = 0.5f * (low + high);
+                if (alphaCoverage(image, middle, cutoff) < targetCoverage) {
+                    low = middle;
+                }
+                else {
+                    high = middle;
+                }
+            }
+            return high;
+        }
+
+        MipGenerator::Level quantize(const Image& image, bool srgb, float alphaScale, ThreadPool* threadPool) {
+            MipGenerator::Level level;
+            level.width = image.width;
+            level.height = image.height;
+            level.rgba.resize(image.texels.size());
+
+            runRows(image.height, threadPool, [&](size_t begin, size_t end) {
+                for (size_t i = begin * image.width * 4; i < end * image.width * 4; i += 4) {
+                    for (int c = 0; c < 3; ++c) {
+                        level.rgba[i + c] = srgb ? encodeSrgb(image.texels[i + c]) : encodeUnorm(image.texels[i + c]);
+                    }
+                    level.rgba[i + 3] = encodeUnorm(image.texels[i + 3] * alphaScale);
+                }
+            });
+            return level;
+        }
+
+    } // namespace
+
+    uint32_t MipGenerator::fullChainLength(uint32_t width, uint32_t height) {
+        uint32_t largest = std::max(width, height);
+        uint32_t levels = 1;
+        while (largest > 1) {
+            largest >>= 1;
+            ++levels;
+        }
+        return levels;
+    }
+
+    std::vector<MipGenerator::Level> MipGenerator::generate(const uint8_t* rgba, uint32_t width, uint32_t height,
+        uint32_t levelCount, const Options& options) {
+        if (!rgba || width == 0 || height == 0) {
+            throw std::invalid_argument("Cannot generate mipmaps for an empty image");
+        }
+
+        const uint32_t fullChain = fullChainLength(width, height);
+        levelCount = levelCount == 0 ? fullChain : std::min(levelCount, fullChain);
+
+        AccumulateFn accumulate = accumulateScalar;
+#if PGRENDER_MIPGEN_SSE
+        if (options.useSimd) {
+            accumulate = accumulateSse;
+        }
+#endif
+
+        std::vector<Level> levels;
+        levels.reserve(levelCount);
+        levels.push_back({ width, height, std::vector<uint8_t>(rgba, rgba + static_cast<size_t>(width) * height * 4) });
+        if (levelCount == 1) {
+            return levels;
+        }
+
+        Image image;
+        image.width = width;
+        image.height = height;
+        image.texels.resize(static_cast<size_t>(width) * height * 4);
+        const auto& srgbTable = srgbDecodeTable();
+        for (size_t i = 0; i < image.texels.size(); i += 4) {
+            for (int c = 0; c < 3; ++c) {
+                image.texels[i + c] = options.srgb ? srgbTable[rgba[i + c]] : rgba[i + c] / 255.0f;
+            }
+            image.texels[i + 3] = rgba[i + 3] / 255.0f;
+        }
+
+        const float targetCoverage = options.preserveAlphaCoverage
+            ? alphaCoverage(image, 1.0f, options.alphaCutoff) : 0.0f;
+
+        for (uint32_t mip = 1; mip < levelCount; ++mip) {
+            // La cadena continúa con el nivel sin escalar: la corrección de cobertura no se acumula
+            image = downsample(image, options.filter, accumulate, options.threadPool);
+            const float alphaScale = options.preserveAlphaCoverage
+                ? findAlphaScale(image, targetCoverage, options.alphaCutoff) : 1.0f;
+            levels.push_back(quantize(image, options.srgb, alphaScale, options.threadPool));
+        }
+
+        return levels;
+    }
+
+    std::future<std::vector<MipGenerator::Level>> MipGenerator::generateAsync(std::vector<uint8_t> rgba,
+        uint32_t width, uint32_t height, uint32_t levelCount, const Options& options) {
+        if (!options.threadPool) {
+            throw std::invalid_argument("Asynchronous mip generation needs a thread pool");
+        }
+        if (rgba.size() < static_cast<size_t>(width) * height * 4) {
+            throw std::invalid_argument("Image data is smaller than width * height * 4");
+        }
+
+        auto task = std::make_shared<std::packaged_task<std::vector<Level>()>>(
+            [image = std::move(rgba), width, height, levelCount, options]() {
+                return generate(image.data(), width, height, levelCount, options);
+            });
+        std::future<std::vector<Level>> result = task->get_future();
+        options.threadPool->submit([task] { (*task)(); });
+        return result;
+    }
+
+    void MipGenerator::upload(Texture& texture, const std::vector<Level>& levels, uint32_t arrayLayer,
+        const TextureEncoder::Options& encoderOptions) {
+        const auto& desc = texture.getDesc();
+        const bool encode = TextureEncoder::canEncode(desc.format);
+        if (desc.format != Texture::Format::RGBA8 && desc.format != Texture::Format::SRGB8_A8 && !encode) {
+            throw std::invalid_argument("Generated mip levels can only be uploaded to RGBA8, SRGB8_A8 or BC textures");
+        }
+
+        const uint32_t count = std::min<uint32_t>(static_cast<uint32_t>(levels.size()), desc.mipLevels);
+        for (uint32_t mip = texture.getResidentBaseLevel(); mip < count; ++mip) {
+            const Level& level = levels[mip];
+            if (level.width != std::max(desc.width >> mip, 1u) || level.height != std::max(desc.height >> mip, 1u)) {
+                throw std::invalid_argument("Mip level size does not match the texture");
+            }
+
+            if (encode) {
+                TextureEncoder::upload(texture, level.rgba.data(), mip, arrayLayer, encoderOptions);
+            }
+            else {
+                texture.update(level.rgba.data(), level.rgba.size(), mip, arrayLayer);
+            }
+        }
+    }
+
+} // namespace pgrender
@@ -0,0 +1,150 @@
+#include "PGRenderCore/programReflection.h"
+#include "PGRenderCore/vertexLayout.h"
+#include <stdexcept>
+#include <algorithm>
+#include <sstream>
+
+namespace pgrender {
+
+    namespace {
+
+        // Ordena por hash y rechaza colisiones entre nombres distintos
+        template <typename T>
+        void sortByHash(std::vector<T>& entries, const char* kind) {
+            std::sort(entries.begin(), entries.end(),
+                [](const T& a, const T& b) { return a.hash < b.hash; });
+            for (size_t i = 1; i < entries.size(); ++i) {
+                if (entries[i].hash == entries[i - 1].hash && entries[i].name != entries[i - 1].name) {
+                    throw std::runtime_error(std::string(kind) + " name hash collision: '" +
+                        entries[i - 1].name + "' and '" + entries[i].name + "'");
+                }
+            }
+        }
+
+        template <typename T>
+        const T* findByHash(const std::vector<T>& entries, NameHash hash) {
+            auto it = std::lower_bound(entries.begin(), entries.end(), hash,
+                [](const T& entry, NameHash value) { return entry.hash < value; });
+            return it != entries.end() && it->hash == hash ? &*it : nullptr;
+        }
+
+        const char* toString(ProgramReflection::BaseType type) {
+            switch (type) {
+            case ProgramReflection::BaseType::Float: return "float";
+            case ProgramReflection::BaseType::Double: return "double";
+            case ProgramReflection::BaseType::Int: return "int";
+            case ProgramReflection::BaseType::UInt: return "uint";
+            case ProgramReflection::BaseType::Bool: return "bool";
+            default: return "unknown";
+            }
+        }
+
+        // Tipo con el que llega el atributo al shader (ver VertexArrayGL: los enteros usan AttribIFormat)
+        ProgramReflection::BaseType shaderTypeOf(VertexAttributeType type) {
+            switch (type) {
+            case VertexAttributeType::Float:
+            case VertexAttributeType::Float2:
+            case VertexAttributeType::Float3:
+            case VertexAttributeType::Float4:
+            case VertexAttributeType::Half2:
+            case VertexAttributeType::Half4:
+                return ProgramReflection::BaseType::Float;
+            case VertexAttributeType::Int:
+            case VertexAttributeType::Int2:
+            case VertexAttributeType::Int3:
+            case VertexAttributeType::Int4:
+            case VertexAttributeType::Byte4:
+            case VertexAttributeType::Short2:
+            case VertexAttributeType::Short4:
+                return ProgramReflection::BaseType::Int;
+            default:
+                return ProgramReflection::BaseType::UInt;
+            }
+        }
+
+    } // namespace
+
+    const ProgramReflection::Uniform* ProgramReflection::Block::findMember(NameHash memberHash) const {
+        for (const auto& member : members) {
+            if (member.hash == memberHash) {
+                return &member;
+            }
+        }
+        return nullptr;
+    }
+
+    ProgramReflection::ProgramReflection(std::vector<Uniform> uniforms, std::vector<Block> uniformBlocks,
+        std::vector<Block> storageBlocks, std::vector<VertexInput> vertexInputs)
+        : m_uniforms(std::move(uniforms)),
+        m_uniformBlocks(std::move(uniformBlocks)),
+        m_storageBlocks(std::move(storageBlocks)),
+        m_vertexInputs(std::move(vertexInputs))
+    {
+        sortByHash(m_uniforms, "Uniform");
+        sortByHash(m_uniformBlocks, "Uniform block");
+        sortByHash(m_storageBlocks, "Storage block");
+        sortByHash(m_vertexInputs, "Vertex input");
+
+        for (auto* blocks : { &m_uniformBlocks, &m_storageBlocks }) {
+            for (auto& block : *blocks) {
+                std::sort(block.members.begin(), block.members.end(),
+                    [](const Uniform& a, const Uniform& b) { return a.offset < b.offset; });
+            }
+        }
+    }
+
+    bool ProgramReflection::empty() const {
+        return m_uniforms.empty() && m_uniformBlocks.empty() && m_storageBlocks.empty() && m_vertexInputs.empty();
+    }
+
+    const ProgramReflection::Uniform* ProgramReflection::findUniform(NameHash hash) const {
+        return findByHash(m_uniforms, hash);
+    }
+
+    const ProgramReflection::Block* ProgramReflection::findUniformBlock(NameHash hash) const {
+        return findByHash(m_uniformBlocks, hash);
+    }
+
+    const ProgramReflection::Block* ProgramReflection::findStorageBlock(NameHash hash) const {
+        return findByHash(m_storageBlocks, hash);
+    }
+
+    const ProgramReflection::VertexInput* ProgramReflection::findVertexInput(NameHash hash) const {
+        return findByHash(m_vertexInputs, hash);
+    }
+
+    int32_t ProgramReflection::getUniformLocation(NameHash hash) const {
+        const Uniform* uniform = findUniform(hash);
+        return uniform ? uniform->location : -1;
+    }
+
+    void ProgramReflection::validateVertexLayout(const VertexLayout& layout) const {
+        std::ostringstream errors;
+        const auto& attributes = layout.getAttributes();
+
+        for (const auto& input : m_vertexInputs) {
+            for (uint32_t i = 0; i < input.locationCount; ++i) {
+                const uint32_t location = input.location + i;
+                auto it = std::find_if(attributes.begin(), attributes.end(),
+                    [location](const VertexAttribute& attribute) { return attribute.location == location; });
+
+                if (it == attributes.end()) {
+                    errors << "\n  '" << input.name << "' (location " << location << ") has no vertex attribute";
+                    continue;
+                }
+
+                const BaseType provided = shaderTypeOf(it->type);
+                if (provided != input.baseType) {
+                    errors << "\n  '" << input.name << "' (location " << location << ") expects "
+                        << toString(input.baseType) << " but the layout provides " << toString(provided);
+                }
+            }
+        }
+
+        const std::string message = errors.str();
+        if (!message.empty()) {
+            throw std::invalid_argument("Vertex layout does not match the program inputs:" + message);
+        }
+    }
+
+} // namespace pgrender
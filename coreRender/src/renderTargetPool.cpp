@@ -0,0 +1,196 @@
+#include "PGRenderCore/renderTargetPool.h"
+#include "PGRenderCore/context.h"
+#include <stdexcept>
+#include <functional>
+
+namespace pgrender {
+
+    namespace {
+
+        void hashCombine(size_t& seed, size_t value) {
+            seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+
+    } // namespace
+
+    RenderTargetPool::RenderTargetPool(Context& context, uint32_t maxUnusedFrames, uint32_t sizeGranularity)
+        : m_context(context), m_maxUnusedFrames(maxUnusedFrames), m_sizeGranularity(sizeGranularity)
+    {
+        if (m_sizeGranularity == 0) {
+            throw std::invalid_argument("Render target size granularity must be at least 1");
+        }
+    }
+
+    uint32_t RenderTargetPool::roundSize(uint32_t size) const {
+        return (size + m_sizeGranularity - 1) / m_sizeGranularity * m_sizeGranularity;
+    }
+
+    std::shared_ptr<RenderTarget> RenderTargetPool::acquire(const Key& requested) {
+        if (requested.width == 0 || requested.height == 0) {
+            throw std::invalid_argument("Render target size cannot be zero");
+        }
+        if (requested.colorFormats.empty() && !requested.hasDepthStencil) {
+            throw std::invalid_argument("Render target needs at least one attachment");
+        }
+        if (requested.sampleCount == 0) {
+            throw std::invalid_argument("Render target sample count must be at least 1");
+        }
+
+        Key key = requested;
+        key.width = roundSize(requested.width);
+        key.height = roundSize(requested.height);
+
+        auto it = m_entries.find(key);
+        if (it != m_entries.end()) {
+            for (auto& entry : it->second) {
+                if (!entry.inUse) {
+                    entry.inUse = true;
+                    entry.lastUsedFrame = m_frame;
+                    m_statistics.hits++;
+                    m_statistics.inUseTargets++;
+                    m_statistics.freeMemoryBytes -= entry.memoryBytes;
+                    return entry.renderTarget;
+                }
+            }
+        }
+
+        // El bucket se crea sólo si la creación no lanza
+        Entry entry;
+        entry.renderTarget = createRenderTarget(key);
+        entry.memoryBytes = estimateMemory(key);
+        entry.lastUsedFrame = m_frame;
+        entry.inUse = true;
+        m_entries.try_emplace(key).first->second.push_back(entry);
+
+        m_statistics.misses++;
+        m_statistics.totalTargets++;
+        m_statistics.inUseTargets++;
+        m_statistics.totalMemoryBytes += entry.memoryBytes;
+        return entry.renderTarget;
+    }
+
+    void RenderTargetPool::release(const std::shared_ptr<RenderTarget>& renderTarget) {
+        if (!renderTarget) return;
+
+        auto it = m_entries.find(makeKey(*renderTarget));
+        if (it != m_entries.end()) {
+            for (auto& entry : it->second) {
+                if (entry.renderTarget == renderTarget) {
+                    if (!entry.inUse) {
+                        throw std::runtime_error("Render target released twice");
+                    }
+                    entry.inUse = false;
+                    entry.lastUsedFrame = m_frame;
+                    m_statistics.inUseTargets--;
+                    m_statistics.freeMemoryBytes += entry.memoryBytes;
+                    return;
+                }
+            }
+        }
+
+        throw std::invalid_argument("Render target does not belong to this pool");
+    }
+
+    void RenderTargetPool::nextFrame() {
+        m_frame++;
+
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            auto& bucket = it->second;
+            std::erase_if(bucket, [this](const Entry& entry) {
+                bool expired = !entry.inUse && m_frame - entry.lastUsedFrame > m_maxUnusedFrames;
+                if (expired) {
+                    m_statistics.evictions++;
+                    m_statistics.totalTargets--;
+                    m_statistics.totalMemoryBytes -= entry.memoryBytes;
+                    m_statistics.freeMemoryBytes -= entry.memoryBytes;
+                }
+                return expired;
+                });
+
+            it = bucket.empty() ? m_entries.erase(it) : std::next(it);
+        }
+    }
+
+    void RenderTargetPool::trim() {
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            auto& bucket = it->second;
+            std::erase_if(bucket, [this](const Entry& entry) {
+                if (entry.inUse) return false;
+                m_statistics.totalTargets--;
+                m_statistics.totalMemoryBytes -= entry.memoryBytes;
+                m_statistics.freeMemoryBytes -= entry.memoryBytes;
+                return true;
+                });
+
+            it = bucket.empty() ? m_entries.erase(it) : std::next(it);
+        }
+    }
+
+    size_t RenderTargetPool::estimateMemory(const Key& key) {
+        size_t pixels = static_cast<size_t>(key.width) * key.height * key.sampleCount;
+        size_t bytes = 0;
+        for (auto format : key.colorFormats) {
+            bytes += pixels * Texture::getBytesPerPixel(format);
+        }
+        if (key.hasDepthStencil) {
+            bytes += pixels * Texture::getBytesPerPixel(key.depthStencilFormat);
+        }
+        return bytes;
+    }
+
+    std::shared_ptr<RenderTarget> RenderTargetPool::createRenderTarget(const Key& key) {
+        auto makeTexture = [&](Texture::Format format) {
+            Texture::Desc texDesc{};
+            texDesc.type = key.sampleCount > 1 ? Texture::Type::Texture2DMultisample : Texture::Type::Texture2D;
+            texDesc.width = key.width;
+            texDesc.height = key.height;
+            texDesc.depth = 1;
+            texDesc.mipLevels = 1;
+            texDesc.format = format;
+            texDesc.sampleCount = key.sampleCount;
+            return m_context.createTexture(texDesc);
+            };
+
+        RenderTarget::Desc desc;
+        desc.width = key.width;
+        desc.height = key.height;
+        desc.sampleCount = key.sampleCount;
+        for (auto format : key.colorFormats) {
+            desc.colorAttachments.push_back(makeTexture(format));
+        }
+        if (key.hasDepthStencil) {
+            desc.depthStencilAttachment = makeTexture(key.depthStencilFormat);
+        }
+        return m_context.createRenderTarget(desc);
+    }
+
+    RenderTargetPool::Key RenderTargetPool::makeKey(const RenderTarget& renderTarget) {
+        Key key;
+        key.width = renderTarget.getWidth();
+        key.height = renderTarget.getHeight();
+        key.sampleCount = renderTarget.getSampleCount();
+        for (uint32_t i = 0; i < renderTarget.getColorAttachmentCount(); ++i) {
+            key.colorFormats.push_back(renderTarget.getColorAttachment(i)->getDesc().format);
+        }
+        if (auto depth = renderTarget.getDepthStencilAttachment()) {
+            key.hasDepthStencil = true;
+            key.depthStencilFormat = depth->getDesc().format;
+        }
+        return key;
+    }
+
+    size_t RenderTargetPool::KeyHasher::operator()(const Key& key) const {
+        size_t seed = std::hash<uint32_t>{}(key.width);
+        hashCombine(seed, std::hash<uint32_t>{}(key.height));
+        hashCombine(seed, std::hash<uint32_t>{}(key.sampleCount));
+        for (auto format : key.colorFormats) {
+            hashCombine(seed, std::hash<int>{}(static_cast<int>(format)));
+        }
+        hashCombine(seed, key.hasDepthStencil ? 1 : 0);
+        if (key.hasDepthStencil) {
+            hashCombine(seed, std::hash<int>{}(static_cast<int>(key.depthStencilFormat)));
+        }
+        return seed;
+    }
+
+} // namespace pgrender
@@ -0,0 +1,67 @@
+#include "PGRenderCore/shader.h"
+#include <stdexcept>
+#include <cstring>
+
+namespace pgrender {
+
+    namespace {
+        constexpr uint32_t kSpirvMagic = 0x07230203u;
+
+        uint32_t byteSwap(uint32_t value) {
+            return (value >> 24) | ((value >> 8) & 0xFF00u) | ((value << 8) & 0xFF0000u) | (value << 24);
+        }
+    }
+
+    uint64_t hashContent(const void* data, size_t size, uint64_t seed) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        uint64_t hash = seed;
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    uint64_t ShaderSource::contentHash() const {
+        const uint8_t stageId = static_cast<uint8_t>(stage);
+        uint64_t hash = hashContent(&stageId, 1);
+        if (!isSpirv()) {
+            return hashContent(source.data(), source.size(), hash);
+        }
+
+        // Palabras en little endian para que el hash no dependa de la máquina
+        auto hashWord = [&hash](uint32_t word) {
+            const uint8_t bytes[4] = { uint8_t(word), uint8_t(word >> 8), uint8_t(word >> 16), uint8_t(word >> 24) };
+            hash = hashContent(bytes, 4, hash);
+        };
+        for (uint32_t word : spirv) {
+            hashWord(word);
+        }
+        hash = hashContent(entryPoint.c_str(), entryPoint.size() + 1, hash);
+        for (const auto& constant : specializationConstants) {
+            hashWord(constant.id);
+            hashWord(constant.value);
+        }
+        return hash;
+    }
+
+    std::vector<uint32_t> ShaderSource::spirvFromBytes(const void* data, size_t size) {
+        if (size == 0 || size % sizeof(uint32_t) != 0) {
+            throw std::invalid_argument("SPIR-V module size must be a non-zero multiple of 4 bytes");
+        }
+
+        std::vector<uint32_t> words(size / sizeof(uint32_t));
+        std::memcpy(words.data(), data, size);
+
+        if (words[0] == byteSwap(kSpirvMagic)) {
+            for (auto& word : words) {
+                word = byteSwap(word);
+            }
+        }
+        else if (words[0] != kSpirvMagic) {
+            throw std::invalid_argument("Data is not a SPIR-V module (bad magic number)");
+        }
+        return words;
+    }
+
+} // namespace pgrender
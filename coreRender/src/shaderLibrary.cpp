@@ -0,0 +1,581 @@
+#include "PGRenderCore/shaderLibrary.h"
+#include "PGRenderCore/context.h"
+#include <stdexcept>
+#include <algorithm>
+#include <thread>
+
+namespace pgrender {
+
+    namespace {
+
+        using VariantKey = ShaderLibrary::VariantKey;
+
+        VariantKey fieldMask(uint32_t bits) {
+            return bits >= 64 ? ~VariantKey(0) : ((VariantKey(1) << bits) - 1);
+        }
+
+        uint32_t bitsFor(const ShaderLibrary::Keyword& keyword) {
+            if (keyword.values.empty()) {
+                return 1;
+            }
+            uint32_t bits = 0;
+            while ((size_t(1) << bits) < keyword.values.size()) {
+                ++bits;
+            }
+            return bits;
+        }
+
+        bool isIdentifierChar(char c) {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        }
+
+        // Busca name como identificador completo (no como parte de otro)
+        bool containsIdentifier(const std::string& source, const std::string& name) {
+            if (name.empty()) {
+                return false;
+            }
+            for (size_t pos = source.find(name); pos != std::string::npos; pos = source.find(name, pos + 1)) {
+                const size_t end = pos + name.size();
+                if ((pos == 0 || !isIdentifierChar(source[pos - 1])) &&
+                    (end == source.size() || !isIdentifierChar(source[end]))) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool isReferenced(const ShaderLibrary::Keyword& keyword, const std::vector<ShaderSource>& stages) {
+            return std::any_of(stages.begin(), stages.end(), [&keyword](const ShaderSource& stage) {
+                return containsIdentifier(stage.source, keyword.name) ||
+                    std::any_of(keyword.values.begin(), keyword.values.end(),
+                        [&stage](const std::string& value) { return containsIdentifier(stage.source, value); });
+            });
+        }
+
+        // Hash del programa completo: combina el de cada etapa
+        uint64_t hashStages(const std::vector<ShaderSource>& stages) {
+            uint64_t hash = hashContent(nullptr, 0);
+            for (const auto& stage : stages) {
+                const uint64_t stageHash = stage.contentHash();
+                hash = hashContent(&stageHash, sizeof(stageHash), hash);
+            }
+            return hash;
+        }
+
+    } // namespace
+
+    ShaderLibrary::ShaderLibrary(Context& context)
+        : m_context(context)
+    {
+    }
+
+    // ===== REGISTRO =====
+
+    ShaderLibrary::ShaderId ShaderLibrary::add(const ShaderDesc& desc) {
+        if (find(desc.name) != InvalidShader) {
+            throw std::invalid_argument("Shader '" + desc.name + "' is already registered");
+        }
+
+        Shader shader;
+        shader.desc = desc;
+        shader.desc.stageFiles.resize(desc.stages.size());
+        for (const auto& stage : desc.stages) {
+            shader.sources.push_back(stage.source);
+        }
+        expandStages(shader, false);
+
+        uint32_t shift = 0;
+        for (size_t i = 0; i < desc.keywords.size(); ++i) {
+            const Keyword& keyword = desc.keywords[i];
+            for (size_t j = 0; j < i; ++j) {
+                if (desc.keywords[j].name == keyword.name) {
+                    throw std::invalid_argument("Shader '" + desc.name + "' declares keyword '" + keyword.name + "' twice");
+                }
+            }
+
+            KeywordSlot slot;
+            slot.shift = shift;
+            slot.bits = bitsFor(keyword);
+            if (shift + slot.bits > 64) {
+                throw std::invalid_argument("Keywords of shader '" + desc.name + "' need more than 64 bits");
+            }
+
+            shader.validMask |= slot.bits > 0 ? fieldMask(slot.bits) << shift : 0;
+            shift += slot.bits;
+            shader.slots.push_back(slot);
+        }
+        updateKeywordUsage(shader);
+
+        normalizeKey(shader, desc.fallbackKey);
+
+        m_shaders.push_back(std::move(shader));
+        ++m_statistics.shaders;
+        return static_cast<ShaderId>(m_shaders.size() - 1);
+    }
+
+    ShaderLibrary::ShaderId ShaderLibrary::find(std::string_view name) const {
+        for (size_t i = 0; i < m_shaders.size(); ++i) {
+            if (m_shaders[i].desc.name == name) {
+                return static_cast<ShaderId>(i);
+            }
+        }
+        return InvalidShader;
+    }
+
+    ShaderLibrary::VariantKey ShaderLibrary::keyword(ShaderId shaderId, std::string_view name, std::string_view value) const {
+        const Shader& shader = getShader(shaderId);
+        for (size_t i = 0; i < shader.desc.keywords.size(); ++i) {
+            const Keyword& keyword = shader.desc.keywords[i];
+            if (keyword.name != name) {
+                continue;
+            }
+            if (keyword.values.empty()) {
+                return VariantKey(1) << shader.slots[i].shift;
+            }
+
+            auto it = std::find(keyword.values.begin(), keyword.values.end(), value);
+            if (it == keyword.values.end()) {
+                throw std::invalid_argument("Keyword '" + keyword.name + "' has no value '" + std::string(value) + "'");
+            }
+            return static_cast<VariantKey>(it - keyword.values.begin()) << shader.slots[i].shift;
+        }
+        throw std::invalid_argument("Shader '" + shader.desc.name + "' has no keyword '" + std::string(name) + "'");
+    }
+
+    // ===== VARIANTES =====
+
+    std::shared_ptr<Program> ShaderLibrary::getVariant(ShaderId shaderId, VariantKey key) {
+        Shader& shader = getShader(shaderId);
+        auto entry = requestVariant(shader, normalizeKey(shader, key));
+        if (poll(*entry) && entry->status == Program::CompileStatus::Ready) {
+            return entry->program;
+        }
+        return getFallback(shader);
+    }
+
+    Program::CompileStatus ShaderLibrary::getVariantStatus(ShaderId shaderId, VariantKey key) const {
+        const Shader& shader = getShader(shaderId);
+        auto it = shader.variants.find(normalizeKey(shader, key));
+        return it != shader.variants.end() ? it->second->status : Program::CompileStatus::NotCompiled;
+    }
+
+    void ShaderLibrary::prefetch(ShaderId shaderId, VariantKey key) {
+        Shader& shader = getShader(shaderId);
+        requestVariant(shader, normalizeKey(shader, key));
+    }
+
+    void ShaderLibrary::update() {
+        m_pending.erase(std::remove_if(m_pending.begin(), m_pending.end(),
+            [this](const std::shared_ptr<CompiledProgram>& entry) { return poll(*entry); }),
+            m_pending.end());
+
+        if (m_watcher) {
+            // Un include común puede afectar a varios shaders: cada uno se recarga una vez
+            std::vector<bool> changed(m_shaders.size(), false);
+            for (const auto& file : m_watcher->poll()) {
+                m_preprocessor.invalidate(file);
+                for (size_t i = 0; i < m_shaders.size(); ++i) {
+                    const auto& watched = m_shaders[i].watchedFiles;
+                    if (std::find(watched.begin(), watched.end(), file) != watched.end()) {
+                        changed[i] = true;
+                    }
+                }
+            }
+            for (size_t i = 0; i < m_shaders.size(); ++i) {
+                if (changed[i]) {
+                    reloadShader(static_cast<ShaderId>(i));
+                }
+            }
+            pollReloads();
+        }
+    }
+
+    // ===== RECARGA EN CALIENTE =====
+
+    void ShaderLibrary::enableHotReload(ReloadCallback callback) {
+        m_reloadCallback = std::move(callback);
+        if (m_watcher) {
+            return;
+        }
+
+        m_watcher = std::make_unique<FileWatcher>();
+        for (const auto& shader : m_shaders) {
+            for (const auto& file : shader.watchedFiles) {
+                m_watcher->watch(file);
+            }
+        }
+    }
+
+    void ShaderLibrary::reloadShader(ShaderId shaderId) {
+        Shader& shader = m_shaders[shaderId];
+        const auto previousStages = shader.desc.stages;
+        try {
+            expandStages(shader, true);
+        }
+        catch (const std::runtime_error& error) {
+            // El fichero puede no existir momentáneamente mientras el editor lo guarda
+            shader.desc.stages = previousStages;
+            ++m_statistics.reloadsFailed;
+            if (m_reloadCallback) {
+                m_reloadCallback(shader.desc.name, false, error.what());
+            }
+            return;
+        }
+        updateKeywordUsage(shader);
+
+        // Las claves con keywords que ya no aparecen en el código no volverán a pedirse así
+        for (auto it = shader.variants.begin(); it != shader.variants.end();) {
+            if ((it->first & ~shader.usedMask) != 0) {
+                it = shader.variants.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+
+        // Las recargas pendientes del shader quedan obsoletas con el código nuevo
+        m_reloading.erase(std::remove_if(m_reloading.begin(), m_reloading.end(),
+            [shaderId](const Reload& reload) { return reload.shader == shaderId; }),
+            m_reloading.end());
+
+        // Sólo se recompilan las variantes ya pedidas; las demás usarán el código nuevo al pedirlas.
+        // Las claves que comparten programa se recargan juntas con una sola compilación.
+        const size_t firstReload = m_reloading.size();
+        for (const auto& [key, entry] : shader.variants) {
+            auto reload = std::find_if(m_reloading.begin() + firstReload, m_reloading.end(),
+                [&entry](const Reload& pending) { return pending.entry == entry; });
+            if (reload != m_reloading.end()) {
+                reload->keys.push_back(key);
+                continue;
+            }
+
+            Reload started;
+            started.shader = shaderId;
+            started.entry = entry;
+            started.keys.push_back(key);
+            if (isSharedWithOtherShaders(shaderId, entry)) {
+                started.target = std::make_shared<CompiledProgram>();
+                started.target->debugName = entry->debugName;
+            }
+            else {
+                started.target = entry;
+            }
+
+            Program::Desc programDesc = buildProgramDesc(shader, key);
+            programDesc.debugName = started.target->debugName.c_str();
+            started.replacement = m_context.createProgram(programDesc);
+            started.replacement->beginCompile();    // Si falla, pollReloads informa del error
+            m_reloading.push_back(std::move(started));
+        }
+    }
+
+    bool ShaderLibrary::isSharedWithOtherShaders(ShaderId shaderId, const std::shared_ptr<CompiledProgram>& entry) const {
+        for (size_t i = 0; i < m_shaders.size(); ++i) {
+            if (i == shaderId) {
+                continue;
+            }
+            for (const auto& [key, other] : m_shaders[i].variants) {
+                if (other == entry) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void ShaderLibrary::pollReloads() {
+        for (auto it = m_reloading.begin(); it != m_reloading.end();) {
+            Reload& reload = *it;
+            const Program::CompileStatus status = reload.replacement->pollCompileStatus();
+            if (status == Program::CompileStatus::Pending) {
+                ++it;
+                continue;
+            }
+
+            Shader& shader = m_shaders[reload.shader];
+            if (status == Program::CompileStatus::Ready) {
+                CompiledProgram& target = *reload.target;
+                if (reload.target == reload.entry) {
+                    // Los pipelines comparten target.program: pasan a usar el programa nuevo
+                    target.program->adopt(*reload.replacement);
+                    if (target.status == Program::CompileStatus::Pending) {
+                        --m_statistics.programsPending;
+                    }
+                    else if (target.status == Program::CompileStatus::Failed) {
+                        --m_statistics.programsFailed;
+                    }
+
+                    auto previous = m_programsBySource.find(target.sourceHash);
+                    if (previous != m_programsBySource.end() && previous->second == reload.target) {
+                        m_programsBySource.erase(previous);
+                    }
+                }
+                else {
+                    // El programa compartido sigue con el código que usan los demás shaders
+                    target.program = reload.replacement;
+                    for (VariantKey key : reload.keys) {
+                        auto variant = shader.variants.find(key);
+                        if (variant != shader.variants.end() && variant->second == reload.entry) {
+                            variant->second = reload.target;
+                        }
+                    }
+                }
+                target.status = Program::CompileStatus::Ready;
+                target.stages = target.program->getDesc().stages;
+                target.sourceHash = hashStages(target.stages);
+                m_programsBySource.try_emplace(target.sourceHash, reload.target);
+
+                ++m_statistics.programsReloaded;
+                if (m_reloadCallback) {
+                    m_reloadCallback(shader.desc.name, true, {});
+                }
+            }
+            else {
+                ++m_statistics.reloadsFailed;
+                if (m_reloadCallback) {
+                    m_reloadCallback(shader.desc.name, false, reload.replacement->getLastError());
+                }
+            }
+
+            it = m_reloading.erase(it);
+        }
+    }
+
+    std::vector<std::string> ShaderLibrary::getDefines(ShaderId shaderId, VariantKey key) const {
+        const Shader& shader = getShader(shaderId);
+        return definesFor(shader, normalizeKey(shader, key));
+    }
+
+    std::string ShaderLibrary::buildVariantSource(const std::string& source, const std::vector<std::string>& defines) {
+        if (defines.empty()) {
+            return source;
+        }
+
+        // GLSL exige que #version sea la primera directiva: los defines van justo detrás
+        size_t insertAt = 0;
+        uint32_t nextLine = 1;
+        size_t lineStart = 0;
+        for (uint32_t line = 1; lineStart < source.size(); ++line) {
+            const size_t lineEnd = source.find('\n', lineStart);
+            const size_t first = source.find_first_not_of(" \t", lineStart);
+            if (first != std::string::npos && (lineEnd == std::string::npos || first < lineEnd) &&
+                source.compare(first, 8, "#version") == 0) {
+                insertAt = lineEnd == std::string::npos ? source.size() : lineEnd + 1;
+                nextLine = line + 1;
+                break;
+            }
+            if (lineEnd == std::string::npos) {
+                break;
+            }
+            lineStart = lineEnd + 1;
+        }
+
+        std::string result = source.substr(0, insertAt);
+        if (!result.empty() && result.back() != '\n') {
+            result += '\n';
+        }
+        for (const auto& define : defines) {
+            result += "#define " + define + " 1\n";
+        }
+        // Los errores del driver siguen apuntando a las líneas del fichero original
+        result += "#line " + std::to_string(nextLine) + "\n";
+        result += source.substr(insertAt);
+        return result;
+    }
+
+    // ===== PRIVADOS =====
+
+    ShaderLibrary::Shader& ShaderLibrary::getShader(ShaderId shaderId) {
+        if (shaderId >= m_shaders.size()) {
+            throw std::out_of_range("Invalid shader id");
+        }
+        return m_shaders[shaderId];
+    }
+
+    const ShaderLibrary::Shader& ShaderLibrary::getShader(ShaderId shaderId) const {
+        if (shaderId >= m_shaders.size()) {
+            throw std::out_of_range("Invalid shader id");
+        }
+        return m_shaders[shaderId];
+    }
+
+    ShaderLibrary::VariantKey ShaderLibrary::normalizeKey(const Shader& shader, VariantKey key) const {
+        if ((key & ~shader.validMask) != 0) {
+            throw std::invalid_argument("Variant key has bits outside the keywords of shader '" + shader.desc.name + "'");
+        }
+        for (size_t i = 0; i < shader.slots.size(); ++i) {
+            const Keyword& keyword = shader.desc.keywords[i];
+            const VariantKey value = (key >> shader.slots[i].shift) & fieldMask(shader.slots[i].bits);
+            if (!keyword.values.empty() && value >= keyword.values.size()) {
+                throw std::invalid_argument("Variant key selects an invalid value of keyword '" + keyword.name + "'");
+            }
+        }
+        // Las keywords que no aparecen en el código no cambian el programa
+        return key & shader.usedMask;
+    }
+
+    void ShaderLibrary::expandStages(Shader& shader, bool fromFiles) {
+        std::vector<std::string> files;
+        auto addFile = [&files](const std::string& file) {
+            const std::string path = FileWatcher::normalizePath(file);
+            if (std::find(files.begin(), files.end(), path) == files.end()) {
+                files.push_back(path);
+            }
+        };
+
+        for (size_t i = 0; i < shader.desc.stages.size(); ++i) {
+            ShaderSource& stage = shader.desc.stages[i];
+            const std::string& path = shader.desc.stageFiles[i];
+            if (stage.isSpirv()) {
+                if (!path.empty()) {
+                    addFile(path);
+                }
+                continue;
+            }
+
+            // Al recargar manda el fichero; al registrar, la fuente dada si no está vacía
+            const auto result = !path.empty() && (fromFiles || shader.sources[i].empty())
+                ? m_preprocessor.processFile(path)
+                : m_preprocessor.process(shader.sources[i], path);
+            stage.source = result.source;
+            for (const auto& file : result.files) {
+                if (!file.empty() && !m_preprocessor.isVirtualFile(file)) {
+                    addFile(file);
+                }
+            }
+        }
+
+        shader.watchedFiles = std::move(files);
+        if (m_watcher) {
+            for (const auto& file : shader.watchedFiles) {
+                m_watcher->watch(file);
+            }
+        }
+    }
+
+    void ShaderLibrary::updateKeywordUsage(Shader& shader) {
+        shader.usedMask = 0;
+        for (size_t i = 0; i < shader.slots.size(); ++i) {
+            KeywordSlot& slot = shader.slots[i];
+            slot.used = isReferenced(shader.desc.keywords[i], shader.desc.stages);
+            if (slot.used && slot.bits > 0) {
+                shader.usedMask |= fieldMask(slot.bits) << slot.shift;
+            }
+        }
+    }
+
+    Program::Desc ShaderLibrary::buildProgramDesc(const Shader& shader, VariantKey key) const {
+        const auto defines = definesFor(shader, key);
+        Program::Desc programDesc;
+        programDesc.stages = shader.desc.stages;
+        for (auto& stage : programDesc.stages) {
+            // Las etapas SPIR-V ya están preprocesadas; sus variantes usan constantes de especialización
+            if (!stage.isSpirv()) {
+                stage.source = buildVariantSource(stage.source, defines);
+            }
+        }
+        return programDesc;
+    }
+
+    std::vector<std::string> ShaderLibrary::definesFor(const Shader& shader, VariantKey key) const {
+        std::vector<std::string> defines;
+        for (size_t i = 0; i < shader.slots.size(); ++i) {
+            const KeywordSlot& slot = shader.slots[i];
+            if (!slot.used) {
+                continue;
+            }
+
+            const Keyword& keyword = shader.desc.keywords[i];
+            const VariantKey value = (key >> slot.shift) & fieldMask(slot.bits);
+            if (keyword.values.empty()) {
+                if (value != 0) {
+                    defines.push_back(keyword.name);
+                }
+            }
+            else if (!keyword.values[value].empty()) {
+                defines.push_back(keyword.values[value]);
+            }
+        }
+        return defines;
+    }
+
+    std::shared_ptr<ShaderLibrary::CompiledProgram> ShaderLibrary::requestVariant(Shader& shader, VariantKey key) {
+        auto it = shader.variants.find(key);
+        if (it != shader.variants.end()) {
+            return it->second;
+        }
+        ++m_statistics.variantsRequested;
+
+        Program::Desc programDesc = buildProgramDesc(shader, key);
+
+        // Variantes con el mismo código comparten programa
+        const uint64_t sourceHash = hashStages(programDesc.stages);
+        // El hash sólo descarta candidatos: compartir un programa exige el mismo código
+        auto shared = m_programsBySource.find(sourceHash);
+        if (shared != m_programsBySource.end() && shared->second->stages == programDesc.stages) {
+            ++m_statistics.programsShared;
+            shader.variants.emplace(key, shared->second);
+            return shared->second;
+        }
+
+        const auto defines = definesFor(shader, key);
+        auto entry = std::make_shared<CompiledProgram>();
+        entry->sourceHash = sourceHash;
+        entry->stages = programDesc.stages;
+        entry->debugName = shader.desc.name;
+        for (size_t i = 0; i < defines.size(); ++i) {
+            entry->debugName += (i == 0 ? "[" : ",") + defines[i];
+        }
+        if (!defines.empty()) {
+            entry->debugName += "]";
+        }
+        programDesc.debugName = entry->debugName.c_str();
+
+        entry->program = m_context.createProgram(programDesc);
+        ++m_statistics.programsCompiled;
+        if (entry->program->beginCompile()) {
+            entry->status = Program::CompileStatus::Pending;
+            ++m_statistics.programsPending;
+            m_pending.push_back(entry);
+        }
+        else {
+            entry->status = Program::CompileStatus::Failed;
+            ++m_statistics.programsFailed;
+        }
+
+        // Si otro código tiene el mismo hash se conserva el primero y este no se comparte
+        m_programsBySource.try_emplace(sourceHash, entry);
+        shader.variants.emplace(key, entry);
+        return entry;
+    }
+
+    const std::shared_ptr<Program>& ShaderLibrary::getFallback(Shader& shader) {
+        auto entry = requestVariant(shader, normalizeKey(shader, shader.desc.fallbackKey));
+        // La variante de reserva se espera: sólo bloquea la primera vez que se usa el shader
+        while (!poll(*entry)) {
+            std::this_thread::yield();
+        }
+        if (entry->status != Program::CompileStatus::Ready) {
+            throw std::runtime_error("Fallback variant of shader '" + shader.desc.name + "' failed to compile");
+        }
+        return entry->program;
+    }
+
+    bool ShaderLibrary::poll(CompiledProgram& entry) {
+        if (entry.status != Program::CompileStatus::Pending) {
+            return true;
+        }
+
+        entry.status = entry.program->pollCompileStatus();
+        if (entry.status == Program::CompileStatus::Pending) {
+            return false;
+        }
+
+        --m_statistics.programsPending;
+        if (entry.status == Program::CompileStatus::Failed) {
+            ++m_statistics.programsFailed;
+        }
+        return true;
+    }
+
+} // namespace pgrender
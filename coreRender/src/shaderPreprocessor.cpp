@@ -0,0 +1,207 @@
+#include "PGRenderCore/shaderPreprocessor.h"
+#include "PGRenderCore/shader.h"
+#include "PGRenderCore/fileWatcher.h"
+#include <stdexcept>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+
+namespace pgrender {
+
+    namespace {
+
+        constexpr size_t kMaxIncludeDepth = 32;
+
+        std::string_view trim(std::string_view text) {
+            const size_t first = text.find_first_not_of(" \t\r");
+            if (first == std::string_view::npos) {
+                return {};
+            }
+            const size_t last = text.find_last_not_of(" \t\r");
+            return text.substr(first, last - first + 1);
+        }
+
+        // Separa "#  nombre resto" en nombre y resto; false si la línea no es una directiva
+        bool parseDirective(std::string_view line, std::string_view& name, std::string_view& rest) {
+            line = trim(line);
+            if (line.empty() || line.front() != '#') {
+                return false;
+            }
+            line = trim(line.substr(1));
+            const size_t end = std::min(line.find_first_of(" \t"), line.size());
+            name = line.substr(0, end);
+            rest = trim(line.substr(end));
+            return true;
+        }
+
+        std::string location(const std::string& file, size_t line) {
+            return (file.empty() ? std::string("<source>") : file) + ":" + std::to_string(line);
+        }
+
+    } // namespace
+
+    void ShaderPreprocessor::addIncludePath(const std::string& directory) {
+        m_includePaths.push_back(directory);
+    }
+
+    void ShaderPreprocessor::addVirtualFile(const std::string& name, std::string source) {
+        m_virtualFiles[name] = std::move(source);
+    }
+
+    ShaderPreprocessor::Result ShaderPreprocessor::process(const std::string& source, const std::string& fileName) {
+        Expansion expansion;
+        expand(expansion, source, fileName);
+        expansion.result.hash = hashContent(expansion.result.source.data(), expansion.result.source.size());
+        return std::move(expansion.result);
+    }
+
+    ShaderPreprocessor::Result ShaderPreprocessor::processFile(const std::string& path) {
+        const std::string key = m_virtualFiles.count(path) != 0 ? path : FileWatcher::normalizePath(path);
+        const std::string* source = load(key);
+        if (!source) {
+            throw std::runtime_error("Cannot read shader file '" + path + "'");
+        }
+        return process(*source, key);
+    }
+
+    void ShaderPreprocessor::invalidate(const std::string& path) {
+        m_fileCache.erase(FileWatcher::normalizePath(path));
+    }
+
+    const std::string* ShaderPreprocessor::load(const std::string& path) {
+        auto virtualFile = m_virtualFiles.find(path);
+        if (virtualFile != m_virtualFiles.end()) {
+            return &virtualFile->second;
+        }
+
+        auto cached = m_fileCache.find(path);
+        if (cached != m_fileCache.end()) {
+            return &cached->second;
+        }
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            return nullptr;
+        }
+        std::ostringstream buffer;
+        buffer << file.rdbuf();
+        // Las referencias a elementos de unordered_map sobreviven a los rehash
+        return &m_fileCache.emplace(path, buffer.str()).first->second;
+    }
+
+    std::string ShaderPreprocessor::resolve(const std::string& name, bool quoted, const std::string& includer) {
+        if (m_virtualFiles.count(name) != 0) {
+            return name;
+        }
+
+        auto exists = [this](const std::string& path) {
+            std::error_code error;
+            return m_fileCache.count(path) != 0 || std::filesystem::is_regular_file(path, error);
+        };
+
+        if (quoted && !includer.empty() && m_virtualFiles.count(includer) == 0) {
+            const std::string candidate = FileWatcher::normalizePath((std::filesystem::path(includer).parent_path() / name).string());
+            if (exists(candidate)) {
+                return candidate;
+            }
+        }
+        for (const auto& directory : m_includePaths) {
+            const std::string candidate = FileWatcher::normalizePath((std::filesystem::path(directory) / name).string());
+            if (exists(candidate)) {
+                return candidate;
+            }
+        }
+        return {};
+    }
+
+    void ShaderPreprocessor::expand(Expansion& expansion, const std::string& source, const std::string& fileName) {
+        if (expansion.stack.size() >= kMaxIncludeDepth) {
+            throw std::runtime_error("Shader #include nesting is too deep in '" + fileName + "'");
+        }
+        expansion.stack.push_back(fileName);
+
+        auto& files = expansion.result.files;
+        auto fileIndex = [&files](const std::string& file) {
+            auto it = std::find(files.begin(), files.end(), file);
+            if (it == files.end()) {
+                files.push_back(file);
+                return files.size() - 1;
+            }
+            return static_cast<size_t>(it - files.begin());
+        };
+        const size_t currentIndex = fileIndex(fileName);
+
+        std::string& out = expansion.result.source;
+        size_t lineNumber = 1;
+        for (size_t lineStart = 0; lineStart < source.size(); ++lineNumber) {
+            size_t lineEnd = source.find('\n', lineStart);
+            const bool hasNewline = lineEnd != std::string::npos;
+            if (!hasNewline) {
+                lineEnd = source.size();
+            }
+            const std::string_view line(source.data() + lineStart, lineEnd - lineStart);
+            lineStart = lineEnd + 1;
+
+            std::string_view directive, rest;
+            if (!parseDirective(line, directive, rest)) {
+                out.append(line.data(), line.size());
+                if (hasNewline) out += '\n';
+                continue;
+            }
+
+            if (directive == "include") {
+                const char close = rest.empty() ? '\0' : (rest.front() == '"' ? '"' : (rest.front() == '<' ? '>' : '\0'));
+                const size_t end = close ? rest.find(close, 1) : std::string_view::npos;
+                if (end == std::string_view::npos) {
+                    throw std::runtime_error("Malformed #include at " + location(fileName, lineNumber));
+                }
+
+                const std::string name(rest.substr(1, end - 1));
+                const std::string path = resolve(name, close == '"', fileName);
+                if (path.empty()) {
+                    throw std::runtime_error("Cannot resolve #include \"" + name + "\" at " + location(fileName, lineNumber));
+                }
+
+                if (std::find(expansion.onceFiles.begin(), expansion.onceFiles.end(), path) != expansion.onceFiles.end()) {
+                    out += '\n';    // Ya incluido (#pragma once): se conserva la numeración
+                    continue;
+                }
+                if (std::find(expansion.stack.begin(), expansion.stack.end(), path) != expansion.stack.end()) {
+                    throw std::runtime_error("Cyclic #include of '" + path + "' at " + location(fileName, lineNumber));
+                }
+
+                const std::string* included = load(path);
+                if (!included) {
+                    throw std::runtime_error("Cannot read #include '" + path + "' at " + location(fileName, lineNumber));
+                }
+
+                out += "#line 1 " + std::to_string(fileIndex(path)) + "\n";
+                expand(expansion, *included, path);
+                if (!out.empty() && out.back() != '\n') {
+                    out += '\n';
+                }
+                out += "#line " + std::to_string(lineNumber + 1) + " " + std::to_string(currentIndex) + "\n";
+                continue;
+            }
+
+            const bool pragmaOnce = directive == "pragma" && rest == "once";
+            const bool includeExtension = directive == "extension" &&
+                (rest.rfind("GL_GOOGLE_include_directive", 0) == 0 || rest.rfind("GL_ARB_shading_language_include", 0) == 0);
+            if (pragmaOnce || includeExtension) {
+                if (pragmaOnce) {
+                    expansion.onceFiles.push_back(fileName);
+                }
+                if (hasNewline) out += '\n';
+                continue;
+            }
+
+            out.append(line.data(), line.size());
+            if (hasNewline) out += '\n';
+        }
+
+        expansion.stack.pop_back();
+    }
+
+} // namespace pgrender
@@ -0,0 +1,320 @@
+#include "PGRenderCore/sparseResidencyManager.h"
+#include "PGRenderCore/context.h"
+#include <stdexcept>
+#include <algorithm>
+
+namespace pgrender {
+
+    namespace {
+
+        uint32_t divideRoundUp(uint32_t value, uint32_t divisor) {
+            return (value + divisor - 1) / divisor;
+        }
+
+    } // namespace
+
+    SparseResidencyManager::SparseResidencyManager(Context& context, const Desc& desc)
+        : m_context(context), m_desc(desc)
+    {
+        if (!desc.texture) {
+            throw std::invalid_argument("Sparse residency manager needs a texture");
+        }
+
+        const auto& texDesc = desc.texture->getDesc();
+        if (!texDesc.sparse || texDesc.type != Texture::Type::Texture2D) {
+            throw std::invalid_argument("Sparse residency manager requires a sparse 2D texture");
+        }
+        if (!desc.pageLoader) {
+            throw std::invalid_argument("Sparse residency manager needs a page loader");
+        }
+
+        m_pageSize = desc.texture->getSparsePageSize();
+        m_mipTailStart = std::min<uint32_t>(desc.texture->getSparseMipTailStart(), texDesc.mipLevels);
+        if (m_pageSize.width == 0 || m_pageSize.height == 0) {
+            throw std::runtime_error("Sparse texture reports an invalid page size");
+        }
+        if (m_mipTailStart > 16) {
+            throw std::invalid_argument("Sparse texture has too many non-tail mip levels for feedback encoding");
+        }
+
+        for (uint32_t mip = 0; mip < m_mipTailStart; ++mip) {
+            Level level;
+            level.pagesX = divideRoundUp(std::max<uint32_t>(texDesc.width >> mip, 1), m_pageSize.width);
+            level.pagesY = divideRoundUp(std::max<uint32_t>(texDesc.height >> mip, 1), m_pageSize.height);
+            level.pages.resize(static_cast<size_t>(level.pagesX) * level.pagesY);
+            m_levels.push_back(std::move(level));
+        }
+
+        // La cola de mips es el último recurso: siempre residente
+        for (uint32_t mip = m_mipTailStart; mip < texDesc.mipLevels; ++mip) {
+            Texture::Region region;
+            region.width = std::max<uint32_t>(texDesc.width >> mip, 1);
+            region.height = std::max<uint32_t>(texDesc.height >> mip, 1);
+            region.mipLevel = mip;
+            desc.texture->commitRegion(region, true);
+            m_desc.pageLoader(*desc.texture, region);
+        }
+
+        const uint32_t mapWidth = m_levels.empty() ? 1 : m_levels[0].pagesX;
+        const uint32_t mapHeight = m_levels.empty() ? 1 : m_levels[0].pagesY;
+        m_residencyData.assign(static_cast<size_t>(mapWidth) * mapHeight, static_cast<float>(m_mipTailStart));
+
+        Texture::Desc mapDesc;
+        mapDesc.type = Texture::Type::Texture2D;
+        mapDesc.width = mapWidth;
+        mapDesc.height = mapHeight;
+        mapDesc.depth = 1;
+        mapDesc.mipLevels = 1;
+        mapDesc.format = Texture::Format::R32F;
+        m_residencyMap = context.createTexture(mapDesc);
+        updateResidencyMap();
+    }
+
+    void SparseResidencyManager::processFeedback(const uint32_t* entries, size_t count) {
+        if (!entries) {
+            return;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            const uint32_t entry = entries[i];
+            if (entry == kEmptyFeedback) {
+                continue;
+            }
+            requestPage(entry >> 28, entry & 0x3FFF, (entry >> 14) & 0x3FFF);
+        }
+    }
+
+    void SparseResidencyManager::processFeedback(const std::shared_ptr<BufferObject>& buffer, size_t count) {
+        if (!buffer) {
+            throw std::invalid_argument("Feedback buffer is null");
+        }
+
+        count = std::min(count, buffer->getSize() / sizeof(uint32_t));
+        if (count == 0) {
+            return;
+        }
+
+        const auto* entries = static_cast<const uint32_t*>(
+            buffer->map(BufferAccessFlags::Read, 0, count * sizeof(uint32_t)));
+        processFeedback(entries, count);
+        buffer->unmap();
+    }
+
+    void SparseResidencyManager::requestPage(uint32_t mipLevel, uint32_t pageX, uint32_t pageY, uint32_t priority) {
+        // Los padres acumulan la prioridad de todos sus hijos: se cargan antes (refinamiento progresivo)
+        for (uint32_t mip = mipLevel; mip < m_mipTailStart; ++mip) {
+            Page* page = findPage(mip, pageX >> (mip - mipLevel), pageY >> (mip - mipLevel));
+            if (!page) {
+                return;
+            }
+            page->priority += priority;
+            page->lastRequestedFrame = m_frame;
+            page->requested = true;
+        }
+    }
+
+    void SparseResidencyManager::update() {
+        struct Candidate {
+            uint32_t mip, x, y, priority;
+        };
+
+        std::vector<Candidate> candidates;
+        for (uint32_t mip = 0; mip < m_mipTailStart; ++mip) {
+            auto& level = m_levels[mip];
+            for (uint32_t y = 0; y < level.pagesY; ++y) {
+                for (uint32_t x = 0; x < level.pagesX; ++x) {
+                    const Page& page = level.pages[static_cast<size_t>(y) * level.pagesX + x];
+                    if (page.requested && !page.resident) {
+                        candidates.push_back({ mip, x, y, page.priority });
+                    }
+                }
+            }
+        }
+
+        // Mayor prioridad primero; a igualdad, mips más gruesos primero
+        std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+            if (a.priority != b.priority) return a.priority > b.priority;
+            return a.mip > b.mip;
+        });
+
+        uint32_t commits = 0;
+        uint32_t pending = 0;
+        for (const auto& candidate : candidates) {
+            if (commits >= m_desc.maxCommitsPerFrame || !parentResident(candidate.mip, candidate.x, candidate.y)) {
+                pending++;
+                continue;
+            }
+            if (m_statistics.residentPages >= m_desc.maxResidentPages && !evictLeastRecentlyUsed()) {
+                pending++;
+                continue;
+            }
+            commitPage(candidate.mip, candidate.x, candidate.y);
+            commits++;
+        }
+        m_statistics.pendingPages = pending;
+
+        // Liberar páginas que llevan demasiado tiempo sin pedirse (de las más finas a las más gruesas)
+        for (uint32_t mip = 0; mip < m_mipTailStart; ++mip) {
+            auto& level = m_levels[mip];
+            for (uint32_t y = 0; y < level.pagesY; ++y) {
+                for (uint32_t x = 0; x < level.pagesX; ++x) {
+                    Page& page = level.pages[static_cast<size_t>(y) * level.pagesX + x];
+                    if (page.resident && m_frame - page.lastRequestedFrame > m_desc.maxUnusedFrames &&
+                        !hasResidentChildren(mip, x, y)) {
+                        evictPage(mip, x, y);
+                    }
+                    page.priority = 0;
+                    page.requested = false;
+                }
+            }
+        }
+
+        updateResidencyMap();
+        m_frame++;
+    }
+
+    bool SparseResidencyManager::isPageResident(uint32_t mipLevel, uint32_t pageX, uint32_t pageY) const {
+        if (mipLevel >= m_mipTailStart) {
+            return true;
+        }
+        const Page* page = findPage(mipLevel, pageX, pageY);
+        return page && page->resident;
+    }
+
+    uint32_t SparseResidencyManager::getPageCountX(uint32_t mipLevel) const {
+        return mipLevel < m_levels.size() ? m_levels[mipLevel].pagesX : 1;
+    }
+
+    uint32_t SparseResidencyManager::getPageCountY(uint32_t mipLevel) const {
+        return mipLevel < m_levels.size() ? m_levels[mipLevel].pagesY : 1;
+    }
+
+    SparseResidencyManager::Page* SparseResidencyManager::findPage(uint32_t mipLevel, uint32_t pageX, uint32_t pageY) {
+        return const_cast<Page*>(static_cast<const SparseResidencyManager*>(this)->findPage(mipLevel, pageX, pageY));
+    }
+
+    const SparseResidencyManager::Page* SparseResidencyManager::findPage(uint32_t mipLevel, uint32_t pageX, uint32_t pageY) const {
+        if (mipLevel >= m_levels.size()) {
+            return nullptr;
+        }
+        const auto& level = m_levels[mipLevel];
+        if (pageX >= level.pagesX || pageY >= level.pagesY) {
+            return nullptr;
+        }
+        return &level.pages[static_cast<size_t>(pageY) * level.pagesX + pageX];
+    }
+
+    Texture::Region SparseResidencyManager::pageRegion(uint32_t mipLevel, uint32_t pageX, uint32_t pageY) const {
+        const auto& texDesc = m_desc.texture->getDesc();
+        const uint32_t levelWidth = std::max<uint32_t>(texDesc.width >> mipLevel, 1);
+        const uint32_t levelHeight = std::max<uint32_t>(texDesc.height >> mipLevel, 1);
+
+        Texture::Region region;
+        region.x = pageX * m_pageSize.width;
+        region.y = pageY * m_pageSize.height;
+        region.width = std::min(m_pageSize.width, levelWidth - region.x);
+        region.height = std::min(m_pageSize.height, levelHeight - region.y);
+        region.mipLevel = mipLevel;
+        return region;
+    }
+
+    bool SparseResidencyManager::parentResident(uint32_t mipLevel, uint32_t pageX, uint32_t pageY) const {
+        return isPageResident(mipLevel + 1, pageX >> 1, pageY >> 1);
+    }
+
+    bool SparseResidencyManager::hasResidentChildren(uint32_t mipLevel, uint32_t pageX, uint32_t pageY) const {
+        if (mipLevel == 0) {
+            return false;
+        }
+        for (uint32_t dy = 0; dy < 2; ++dy) {
+            for (uint32_t dx = 0; dx < 2; ++dx) {
+                const Page* child = findPage(mipLevel - 1, pageX * 2 + dx, pageY * 2 + dy);
+                if (child && child->resident) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void SparseResidencyManager::commitPage(uint32_t mipLevel, uint32_t pageX, uint32_t pageY) {
+        const Texture::Region region = pageRegion(mipLevel, pageX, pageY);
+        m_desc.texture->commitRegion(region, true);
+        m_desc.pageLoader(*m_desc.texture, region);
+
+        findPage(mipLevel, pageX, pageY)->resident = true;
+        m_statistics.residentPages++;
+        m_statistics.commits++;
+        m_residencyDirty = true;
+    }
+
+    void SparseResidencyManager::evictPage(uint32_t mipLevel, uint32_t pageX, uint32_t pageY) {
+        m_desc.texture->commitRegion(pageRegion(mipLevel, pageX, pageY), false);
+
+        findPage(mipLevel, pageX, pageY)->resident = false;
+        m_statistics.residentPages--;
+        m_statistics.evictions++;
+        m_residencyDirty = true;
+    }
+
+    bool SparseResidencyManager::evictLeastRecentlyUsed() {
+        // Sólo hojas (sin hijos residentes) que no se hayan pedido en este frame
+        const Page* victim = nullptr;
+        uint32_t victimMip = 0, victimX = 0, victimY = 0;
+
+        for (uint32_t mip = 0; mip < m_mipTailStart; ++mip) {
+            const auto& level = m_levels[mip];
+            for (uint32_t y = 0; y < level.pagesY; ++y) {
+                for (uint32_t x = 0; x < level.pagesX; ++x) {
+                    const Page& page = level.pages[static_cast<size_t>(y) * level.pagesX + x];
+                    if (!page.resident || page.requested) {
+                        continue;
+                    }
+                    if (victim && page.lastRequestedFrame >= victim->lastRequestedFrame) {
+                        continue;
+                    }
+                    if (hasResidentChildren(mip, x, y)) {
+                        continue;
+                    }
+                    victim = &page;
+                    victimMip = mip;
+                    victimX = x;
+                    victimY = y;
+                }
+            }
+        }
+
+        if (!victim) {
+            return false;
+        }
+
+        evictPage(victimMip, victimX, victimY);
+        return true;
+    }
+
+    void SparseResidencyManager::updateResidencyMap() {
+        if (!m_residencyDirty) {
+            return;
+        }
+
+        const uint32_t mapWidth = m_residencyMap->getDesc().width;
+        const uint32_t mapHeight = m_residencyMap->getDesc().height;
+
+        for (uint32_t cy = 0; cy < mapHeight; ++cy) {
+            for (uint32_t cx = 0; cx < mapWidth; ++cx) {
+                uint32_t finest = m_mipTailStart;
+                while (finest > 0 && isPageResident(finest - 1, cx >> (finest - 1), cy >> (finest - 1))) {
+                    finest--;
+                }
+                m_residencyData[static_cast<size_t>(cy) * mapWidth + cx] = static_cast<float>(finest);
+            }
+        }
+
+        Texture::Region region;
+        region.width = mapWidth;
+        region.height = mapHeight;
+        m_residencyMap->updateRegion(region, m_residencyData.data(), m_residencyData.size() * sizeof(float));
+        m_residencyDirty = false;
+    }
+
+} // namespace pgrender
@@ -0,0 +1,67 @@
+#include "PGRenderCore/texture.h"
+#include "PGRenderCore/formatInfo.h"
+#include <stdexcept>
+#include <algorithm>
+
+namespace pgrender {
+
+    uint32_t Texture::getBytesPerPixel(Format format) {
+        const FormatInfo& info = getFormatInfo(format);
+        if (info.isCompressed()) {
+            throw std::invalid_argument("Compressed formats have no per-pixel size");
+        }
+        return info.blockSizeBytes;
+    }
+
+    bool Texture::isCompressedFormat(Format format) {
+        return getFormatInfo(format).isCompressed();
+    }
+
+    uint32_t Texture::getBlockWidth(Format format) {
+        return getFormatInfo(format).blockWidth;
+    }
+
+    uint32_t Texture::getBlockHeight(Format format) {
+        return getFormatInfo(format).blockHeight;
+    }
+
+    uint32_t Texture::getBlockSizeBytes(Format format) {
+        return getFormatInfo(format).blockSizeBytes;
+    }
+
+    size_t Texture::getRowPitch(Format format, uint32_t width) {
+        const uint32_t blockWidth = getBlockWidth(format);
+        const size_t blocks = (std::max<uint32_t>(width, 1) + blockWidth - 1) / blockWidth;
+        return blocks * getBlockSizeBytes(format);
+    }
+
+    size_t Texture::getImageSize(Format format, uint32_t width, uint32_t height, uint32_t depth) {
+        const uint32_t blockHeight = getBlockHeight(format);
+        const size_t rows = (std::max<uint32_t>(height, 1) + blockHeight - 1) / blockHeight;
+        return getRowPitch(format, width) * rows * std::max<uint32_t>(depth, 1);
+    }
+
+    size_t Texture::getLevelSizeBytes(const Desc& desc, uint32_t mipLevel) {
+        const uint32_t width = std::max<uint32_t>(desc.width >> mipLevel, 1);
+        const uint32_t height = desc.type == Type::Texture1D ? 1 : std::max<uint32_t>(desc.height >> mipLevel, 1);
+
+        uint32_t layers = getLayerCount(desc);
+        switch (desc.type) {
+        case Type::Texture3D: layers = std::max<uint32_t>(desc.depth >> mipLevel, 1); break;
+        case Type::Texture2DMultisample: layers = std::max<uint32_t>(desc.sampleCount, 1); break;
+        default: break;
+        }
+
+        return getImageSize(desc.format, width, height, layers);
+    }
+
+    uint32_t Texture::getLayerCount(const Desc& desc) {
+        switch (desc.type) {
+        case Type::TextureCube: return 6;
+        case Type::Texture2DArray: return std::max<uint32_t>(desc.arrayLayers, 1);
+        case Type::TextureCubeArray: return std::max<uint32_t>(desc.arrayLayers, 1) * 6;
+        default: return 1;
+        }
+    }
+
+} // namespace pgrender
@@ -0,0 +1,808 @@
+#include "PGRenderCore/textureEncoder.h"
+#include "PGRenderCore/threadPool.h"
+#include <stdexcept>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <functional>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define PGRENDER_ENCODER_SSE41 1
+#include <smmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define PGRENDER_TARGET_SSE41
+#else
+// Sólo las funciones marcadas se compilan con SSE4.1; el resto del binario no lo exige
+#define PGRENDER_TARGET_SSE41 __attribute__((target("sse4.1")))
+#endif
+#else
+#define PGRENDER_ENCODER_SSE41 0
+#endif
+
+namespace pgrender {
+
+    namespace {
+
+        using Format = Texture::Format;
+        using Quality = TextureEncoder::Quality;
+
+        constexpr uint32_t kBlockPixels = 16;
+        constexpr uint32_t kRowsPerTask = 4;    // Filas de bloques por tarea del pool
+
+        // Texels de un bloque 4x4 separados por canal (0..255)
+        struct BlockPixels {
+            float c[4][kBlockPixels];
+        };
+
+        using Palette = float[16][4];
+
+        using SelectIndicesFn = void (*)(const BlockPixels& pixels, const Palette& palette, uint32_t paletteSize,
+            uint32_t channels, uint8_t* indices, float* errors);
+
+        // ===== BÚSQUEDA DE ÍNDICES =====
+
+        // Empates: gana el índice menor. Ambas rutas evalúan las mismas operaciones en el
+        // mismo orden, por lo que producen índices y errores idénticos.
+        void selectIndicesScalar(const BlockPixels& pixels, const Palette& palette, uint32_t paletteSize,
+            uint32_t channels, uint8_t* indices, float* errors) {
+            for (uint32_t i = 0; i < kBlockPixels; ++i) {
+                float best = std::numeric_limits<float>::infinity();
+                uint8_t bestIndex = 0;
+                for (uint32_t k = 0; k < paletteSize; ++k) {
+                    float distance = 0.0f;
+                    for (uint32_t c = 0; c < channels; ++c) {
+                        const float diff = pixels.c[c][i] - palette[k][c];
+                        distance = distance + diff * diff;
+                    }
+                    if (distance < best) {
+                        best = distance;
+                        bestIndex = static_cast<uint8_t>(k);
+                    }
+                }
+                indices[i] = bestIndex;
+                errors[i] = best;
+            }
+        }
+
+#if PGRENDER_ENCODER_SSE41
+        PGRENDER_TARGET_SSE41
+        void selectIndicesSse41(const BlockPixels& pixels, const Palette& palette, uint32_t paletteSize,
+            uint32_t channels, uint8_t* indices, float* errors) {
+            // Cuatro texels por iteración, un canal por registro
+            for (uint32_t i = 0; i < kBlockPixels; i += 4) {
+                __m128 texels[4];
+                for (uint32_t c = 0; c < channels; ++c) {
+                    texels[c] = _mm_loadu_ps(&pixels.c[c][i]);
+                }
+
+                __m128 best = _mm_set1_ps(std::numeric_limits<float>::infinity());
+                __m128 bestIndex = _mm_setzero_ps();
+                for (uint32_t k = 0; k < paletteSize; ++k) {
+                    __m128 distance = _mm_setzero_ps();
+                    for (uint32_t c = 0; c < channels; ++c) {
+                        const __m128 diff = _mm_sub_ps(texels[c], _mm_set1_ps(palette[k][c]));
+                        distance = _mm_add_ps(distance, _mm_mul_ps(diff, diff));
+                    }
+                    const __m128 closer = _mm_cmplt_ps(distance, best);
+                    best = _mm_blendv_ps(best, distance, closer);
+                    bestIndex = _mm_blendv_ps(bestIndex, _mm_set1_ps(static_cast<float>(k)), closer);
+                }
+
+                alignas(16) int32_t lanes[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_cvttps_epi32(bestIndex));
+                _mm_storeu_ps(errors + i, best);
+                for (uint32_t lane = 0; lane < 4; ++lane) {
+                    indices[i + lane] = static_cast<uint8_t>(lanes[lane]);
+                }
+            }
+        }
+#endif
+
+        float selectIndices(SelectIndicesFn select, const BlockPixels& pixels, const Palette& palette,
+            uint32_t paletteSize, uint32_t channels, uint8_t* indices) {
+            float errors[kBlockPixels];
+            select(pixels, palette, paletteSize, channels, indices, errors);
+            float total = 0.0f;
+            for (float error : errors) {
+                total += error;
+            }
+            return total;
+        }
+
+        // ===== ENDPOINTS =====
+
+        float clampUnorm8(float value) {
+            return std::clamp(value, 0.0f, 255.0f);
+        }
+
+        int roundToInt(float value) {
+            return static_cast<int>(std::floor(value + 0.5f));
+        }
+
+        void loadBlock(const uint8_t* rgba, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY,
+            BlockPixels& pixels) {
+            for (uint32_t y = 0; y < 4; ++y) {
+                const uint32_t sy = std::min(blockY * 4 + y, height - 1);
+                for (uint32_t x = 0; x < 4; ++x) {
+                    const uint32_t sx = std::min(blockX * 4 + x, width - 1);
+                    const uint8_t* texel = rgba + (static_cast<size_t>(sy) * width + sx) * 4;
+                    for (uint32_t c = 0; c < 4; ++c) {
+                        pixels.c[c][y * 4 + x] = texel[c];
+                    }
+                }
+            }
+        }
+
+        // Extremos de la recta que mejor aproxima los texels
+        void computeEndpoints(const BlockPixels& pixels, uint32_t channels, Quality quality, float e0[4], float e1[4]) {
+            float minimum[4], maximum[4];
+            for (uint32_t c = 0; c < channels; ++c) {
+                minimum[c] = *std::min_element(pixels.c[c], pixels.c[c] + kBlockPixels);
+                maximum[c] = *std::max_element(pixels.c[c], pixels.c[c] + kBlockPixels);
+            }
+
+            if (quality == Quality::Fast || channels == 1) {
+                // Caja envolvente con un pequeño margen hacia dentro
+                for (uint32_t c = 0; c < channels; ++c) {
+                    const float inset = (maximum[c] - minimum[c]) / 16.0f;
+                    e0[c] = minimum[c] + inset;
+                    e1[c] = maximum[c] - inset;
+                }
+                return;
+            }
+
+            float mean[4] = {};
+            for (uint32_t c = 0; c < channels; ++c) {
+                for (uint32_t i = 0; i < kBlockPixels; ++i) {
+                    mean[c] += pixels.c[c][i];
+                }
+                mean[c] /= kBlockPixels;
+            }
+
+            float covariance[4][4] = {};
+            for (uint32_t i = 0; i < kBlockPixels; ++i) {
+                for (uint32_t a = 0; a < channels; ++a) {
+                    for (uint32_t b = a; b < channels; ++b) {
+                        covariance[a][b] += (pixels.c[a][i] - mean[a]) * (pixels.c[b][i] - mean[b]);
+                    }
+                }
+            }
+            for (uint32_t a = 0; a < channels; ++a) {
+                for (uint32_t b = 0; b < a; ++b) {
+                    covariance[a][b] = covariance[b][a];
+                }
+            }
+
+            // Eje principal por iteración de potencias
+            float axis[4];
+            for (uint32_t c = 0; c < channels; ++c) {
+                axis[c] = maximum[c] - minimum[c];
+            }
+            for (int iteration = 0; iteration < 8; ++iteration) {
+                float next[4] = {};
+                float length = 0.0f;
+                for (uint32_t a = 0; a < channels; ++a) {
+                    for (uint32_t b = 0; b < channels; ++b) {
+                        next[a] += covariance[a][b] * axis[b];
+                    }
+                    length += next[a] * next[a];
+                }
+                if (length < 1e-12f) {
+                    break;
+                }
+                const float invLength = 1.0f / std::sqrt(length);
+                for (uint32_t c = 0; c < channels; ++c) {
+                    axis[c] = next[c] * invLength;
+                }
+            }
+
+            float tMin = std::numeric_limits<float>::max();
+            float tMax = std::numeric_limits<float>::lowest();
+            for (uint32_t i = 0; i < kBlockPixels; ++i) {
+                float t = 0.0f;
+                for (uint32_t c = 0; c < channels; ++c) {
+                    t += (pixels.c[c][i] - mean[c]) * axis[c];
+                }
+                tMin = std::min(tMin, t);
+                tMax = std::max(tMax, t);
+            }
+            for (uint32_t c = 0; c < channels; ++c) {
+                e0[c] = clampUnorm8(mean[c] + axis[c] * tMin);
+                e1[c] = clampUnorm8(mean[c] + axis[c] * tMax);
+            }
+        }
+
+        // Mínimos cuadrados: endpoints que minimizan el error con los índices dados.
+        // weights[k] es la posición de la entrada k de la paleta entre e0 (0) y e1 (1).
+        bool refineEndpoints(const BlockPixels& pixels, uint32_t channels, const uint8_t* indices,
+            const float* weights, float e0[4], float e1[4]) {
+            float alpha2 = 0.0f, beta2 = 0.0f, alphaBeta = 0.0f;
+            float alphaX[4] = {}, betaX[4] = {};
+            for (uint32_t i = 0; i < kBlockPixels; ++i) {
+                const float beta = weights[indices[i]];
+                const float alpha = 1.0f - beta;
+                alpha2 += alpha * alpha;
+                beta2 += beta * beta;
+                alphaBeta += alpha * beta;
+                for (uint32_t c = 0; c < channels; ++c) {
+                    alphaX[c] += alpha * pixels.c[c][i];
+                    betaX[c] += beta * pixels.c[c][i];
+                }
+            }
+
+            const float determinant = alpha2 * beta2 - alphaBeta * alphaBeta;
+            if (std::fabs(determinant) < 1e-6f) {
+                return false;
+            }
+            for (uint32_t c = 0; c < channels; ++c) {
+                e0[c] = clampUnorm8((alphaX[c] * beta2 - betaX[c] * alphaBeta) / determinant);
+                e1[c] = clampUnorm8((betaX[c] * alpha2 - alphaX[c] * alphaBeta) / determinant);
+            }
+            return true;
+        }
+
+        int refinementIterations(Quality quality) {
+            switch (quality) {
+            case Quality::Fast: return 0;
+            case Quality::Normal: return 1;
+            default: return 4;
+            }
+        }
+
+        void writeLE16(uint8_t* out, uint16_t value) {
+            out[0] = static_cast<uint8_t>(value);
+            out[1] = static_cast<uint8_t>(value >> 8);
+        }
+
+        uint16_t readLE16(const uint8_t* in) {
+            return static_cast<uint16_t>(in[0] | (in[1] << 8));
+        }
+
+        // ===== BC1 =====
+
+        uint16_t packRGB565(const float color[4]) {
+            const int r = roundToInt(clampUnorm8(color[0]) * 31.0f / 255.0f);
+            const int g = roundToInt(clampUnorm8(color[1]) * 63.0f / 255.0f);
+            const int b = roundToInt(clampUnorm8(color[2]) * 31.0f / 255.0f);
+            return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+        }
+
+        void unpackRGB565(uint16_t value, int color[4]) {
+            const int r = (value >> 11) & 31;
+            const int g = (value >> 5) & 63;
+            const int b = value & 31;
+            color[0] = (r << 3) | (r >> 2);
+            color[1] = (g << 2) | (g >> 4);
+            color[2] = (b << 3) | (b >> 2);
+            color[3] = 255;
+        }
+
+        // Paleta tal y como la reconstruye decode()
+        void bc1Palette(uint16_t c0, uint16_t c1, int palette[4][4]) {
+            unpackRGB565(c0, palette[0]);
+            unpackRGB565(c1, palette[1]);
+            for (int c = 0; c < 3; ++c) {
+                if (c0 > c1) {
+                    palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+                    palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+                }
+                else {
+                    palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+                    palette[3][c] = 0;
+                }
+            }
+            palette[2][3] = 255;
+            palette[3][3] = c0 > c1 ? 255 : 0;
+        }
+
+        void encodeBC1Block(const BlockPixels& pixels, Quality quality, SelectIndicesFn select, uint8_t* out) {
+            // Orden de la paleta en modo 4 colores: e0, e1, 1/3, 2/3
+            static const float kWeights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+
+            float e0[4], e1[4];
+            computeEndpoints(pixels, 3, quality, e1, e0);
+
+            float bestError = std::numeric_limits<float>::infinity();
+            uint16_t bestC0 = 0, bestC1 = 0;
+            uint8_t bestIndices[kBlockPixels] = {};
+
+            const int iterations = refinementIterations(quality);
+            for (int iteration = 0; iteration <= iterations; ++iteration) {
+                uint16_t c0 = packRGB565(e0);
+                uint16_t c1 = packRGB565(e1);
+                if (c0 < c1) {
+                    // Modo de 4 colores opaco: exige c0 > c1
+                    std::swap(c0, c1);
+                    std::swap(e0, e1);
+                }
+
+                int colors[4][4];
+                bc1Palette(c0, c1, colors);
+                Palette palette;
+                for (int k = 0; k < 4; ++k) {
+                    for (int c = 0; c < 4; ++c) {
+                        palette[k][c] = static_cast<float>(colors[k][c]);
+                    }
+                }
+
+                // Con c0 == c1 el bloque es de 3 colores + transparente: sólo se usa el índice 0
+                uint8_t indices[kBlockPixels];
+                const float error = selectIndices(select, pixels, palette, c0 == c1 ? 1 : 4, 3, indices);
+                if (error < bestError) {
+                    bestError = error;
+                    bestC0 = c0;
+                    bestC1 = c1;
+                    std::copy(indices, indices + kBlockPixels, bestIndices);
+                }
+
+                if (iteration == iterations || c0 == c1 || !refineEndpoints(pixels, 3, indices, kWeights, e0, e1)) {
+                    break;
+                }
+            }
+
+            uint32_t packedIndices = 0;
+            for (uint32_t i = 0; i < kBlockPixels; ++i) {
+                packedIndices |= static_cast<uint32_t>(bestIndices[i]) << (2 * i);
+            }
+            writeLE16(out, bestC0);
+            writeLE16(out + 2, bestC1);
+            writeLE16(out + 4, static_cast<uint16_t>(packedIndices));
+            writeLE16(out + 6, static_cast<uint16_t>(packedIndices >> 16));
+        }
+
+        void decodeBC1Block(const uint8_t* in, uint8_t texels[kBlockPixels][4]) {
+            const uint16_t c0 = readLE16(in);
+            const uint16_t c1 = readLE16(in + 2);
+            const uint32_t packedIndices = readLE16(in + 4) | (static_cast<uint32_t>(readLE16(in + 6)) << 16);
+
+            int palette[4][4];
+            bc1Palette(c0, c1, palette);
+            for (uint32_t i = 0; i < kBlockPixels; ++i) {
+                const uint32_t index = (packedIndices >> (2 * i)) & 3;
+                for (int c = 0; c < 4; ++c) {
+                    texels[i][c] = static_cast<uint8_t>(palette[index][c]);
+                }
+            }
+        }
+
+        // ===== BC4 =====
+
+        void bc4Palette(int r0, int r1, int palette[8]) {
+            palette[0] = r0;
+            palette[1] = r1;
+            if (r0 > r1) {
+                for (int i = 2; i < 8; ++i) {
+                    palette[i] = ((8 - i) * r0 + (i - 1) * r1 + 3) / 7;
+                }
+            }
+            else {
+                for (int i = 2; i < 6; ++i) {
+                    palette[i] = ((6 - i) * r0 + (i - 1) * r1 + 2) / 5;
+                }
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+        }
+
+        // Bloque de un canal (pixels.c[0])
+        void encodeBC4Block(const BlockPixels& pixels, Quality quality, SelectIndicesFn select, uint8_t* out) {
+            // Modo de 8 valores: r0, r1 y 6 interpolados en pasos de 1/7
+            static const float kWeights[8] = { 0.0f, 1.0f, 1.0f / 7, 2.0f / 7, 3.0f / 7, 4.0f / 7, 5.0f / 7, 6.0f / 7 };
+
+            const int minimum = roundToInt(*std::min_element(pixels.c[0], pixels.c[0] + kBlockPixels));
+            const int maximum = roundToInt(*std::max_element(pixels.c[0], pixels.c[0] + kBlockPixels));
+
+            float bestError = std::numeric_limits<float>::infinity();
+            int bestR0 = maximum, bestR1 = minimum;
+            uint8_t bestIndices[kBlockPixels] = {};
+
+            auto evaluate = [&](int r0, int r1, uint8_t* indices) {
+                int values[8];
+                bc4Palette(r0, r1, values);
+                Palette palette;
+                for (int k = 0; k < 8; ++k) {
+                    palette[k][0] = static_cast<float>(values[k]);
+                }
+                const float error = selectIndices(select, pixels, palette, 8, 1, indices);
+                if (error < bestError) {
+                    bestError = error;
+                    bestR0 = r0;
+                    bestR1 = r1;
+                    std::copy(indices, indices + kBlockPixels, bestIndices);
+                }
+            };
+
+            uint8_t indices[kBlockPixels];
+            evaluate(maximum, minimum, indices);
+            if (quality != Quality::Fast && maximum != minimum) {
+                float e0[4] = { static_cast<float>(maximum) }, e1[4] = { static_cast<float>(minimum) };
+                const int iterations = refinementIterations(quality);
+                for (int iteration = 0; iteration < iterations; ++iteration) {
+                    if (!refineEndpoints(pixels, 1, indices, kWeights, e0, e1)) {
+                        break;
+                    }
+                    const int r0 = roundToInt(e0[0]);
+                    const int r1 = roundToInt(e1[0]);
+                    if (r0 <= r1) {
+                        break;
+                    }
+                    evaluate(r0, r1, indices);
+                }
+
+                if (quality == Quality::High) {
+                    // Pequeña búsqueda alrededor del rango del bloque
+                    for (int d0 = 0; d0 <= 2; ++d0) {
+                        for (int d1 = 0; d1 <= 2; ++d1) {
+                            const int r0 = maximum - d0;
+                            const int r1 = minimum + d1;
+                            if (r0 > r1) {
+                                evaluate(r0, r1, indices);
+                            }
+                        }
+                    }
+                }
+            }
+
+            uint64_t packedIndices = 0;
+            for (uint32_t i = 0; i < kBlockPixels; ++i) {
+                packedIndices |= static_cast<uint64_t>(bestIndices[i]) << (3 * i);
+            }
+            out[0] = static_cast<uint8_t>(bestR0);
+            out[1] = static_cast<uint8_t>(bestR1);
+            for (int b = 0; b < 6; ++b) {
+                out[2 + b] = static_cast<uint8_t>(packedIndices >> (8 * b));
+            }
+        }
+
+        void decodeBC4Block(const uint8_t* in, uint8_t values[kBlockPixels]) {
+            int palette[8];
+            bc4Palette(in[0], in[1], palette);
+            uint64_t packedIndices = 0;
+            for (int b = 0; b < 6; ++b) {
+                packedIndices |= static_cast<uint64_t>(in[2 + b]) << (8 * b);
+            }
+            for (uint32_t i = 0; i < kBlockPixels; ++i) {
+                values[i] = static_cast<uint8_t>(palette[(packedIndices >> (3 * i)) & 7]);
+            }
+        }
+
+        // ===== BC7 (modo 6) =====
+
+        constexpr int kBC7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+        struct BitWriter {
+            uint8_t* out;
+            uint32_t position = 0;
+
+            void write(uint32_t value, uint32_t bits) {
+                for (uint32_t i = 0; i < bits; ++i, ++position) {
+                    if ((value >> i) & 1) {
+                        out[position >> 3] |= static_cast<uint8_t>(1u << (position & 7));
+                    }
+                }
+            }
+        };
+
+        struct BitReader {
+            const uint8_t* in;
+            uint32_t position = 0;
+
+            uint32_t read(uint32_t bits) {
+                uint32_t value = 0;
+                for (uint32_t i = 0; i < bits; ++i, ++position) {
+                    value |= static_cast<uint32_t>((in[position >> 3] >> (position & 7)) & 1) << i;
+                }
+                return value;
+            }
+        };
+
+        // Endpoint de 7 bits por canal + p-bit compartido = 8 bits
+        void quantizeBC7Endpoint(const float endpoint[4], uint32_t pBit, uint8_t quantized[4], int reconstructed[4]) {
+            for (int c = 0; c < 4; ++c) {
+                const int q = std::clamp(roundToInt((endpoint[c] - static_cast<float>(pBit)) / 2.0f), 0, 127);
+                quantized[c] = static_cast<uint8_t>(q);
+                reconstructed[c] = (q << 1) | static_cast<int>(pBit);
+            }
+        }
+
+        uint32_t bestBC7PBit(const float endpoint[4]) {
+            float errors[2];
+            for (uint32_t pBit = 0; pBit < 2; ++pBit) {
+                uint8_t quantized[4];
+                int reconstructed[4];
+                quantizeBC7Endpoint(endpoint, pBit, quantized, reconstructed);
+                errors[pBit] = 0.0f;
+                for (int c = 0; c < 4; ++c) {
+                    const float diff = static_cast<float>(reconstructed[c]) - endpoint[c];
+                    errors[pBit] += diff * diff;
+                }
+            }
+            return errors[1] < errors[0] ? 1 : 0;
+        }
+
+        int interpolateBC7(int e0, int e1, int weight) {
+            return ((64 - weight) * e0 + weight * e1 + 32) >> 6;
+        }
+
+        void encodeBC7Block(const BlockPixels& pixels, Quality quality, SelectIndicesFn select, uint8_t* out) {
+            static const float kWeights[16] = {
+                0 / 64.0f, 4 / 64.0f, 9 / 64.0f, 13 / 64.0f, 17 / 64.0f, 21 / 64.0f, 26 / 64.0f, 30 / 64.0f,
+                34 / 64.0f, 38 / 64.0f, 43 / 64.0f, 47 / 64.0f, 51 / 64.0f, 55 / 64.0f, 60 / 64.0f, 64 / 64.0f
+            };
+
+            float e0[4], e1[4];
+            computeEndpoints(pixels, 4, quality, e0, e1);
+
+            float bestError = std::numeric_limits<float>::infinity();
+            uint8_t bestQ0[4] = {}, bestQ1[4] = {};
+            uint32_t bestP0 = 0, bestP1 = 0;
+            uint8_t bestIndices[kBlockPixels] = {};
+
+            const int iterations = refinementIterations(quality);
+            for (int iteration = 0; iteration <= iterations; ++iteration) {
+                float iterationError = std::numeric_limits<float>::infinity();
+                uint8_t iterationIndices[kBlockPixels] = {};
+
+                const uint32_t p0 = bestBC7PBit(e0);
+                const uint32_t p1 = bestBC7PBit(e1);
+                for (uint32_t combination = 0; combination < 4; ++combination) {
+                    uint32_t pBit0 = combination & 1;
+                    uint32_t pBit1 = combination >> 1;
+                    if (quality != Quality::High && (pBit0 != p0 || pBit1 != p1)) {
+                        continue;
+                    }
+
+                    uint8_t q0[4], q1[4];
+                    int r0[4], r1[4];
+                    quantizeBC7Endpoint(e0, pBit0, q0, r0);
+                    quantizeBC7Endpoint(e1, pBit1, q1, r1);
+
+                    Palette palette;
+                    for (int k = 0; k < 16; ++k) {
+                        for (int c = 0; c < 4; ++c) {
+                            palette[k][c] = static_cast<float>(interpolateBC7(r0[c], r1[c], kBC7Weights4[k]));
+                        }
+                    }
+
+                    uint8_t indices[kBlockPixels];
+                    const float error = selectIndices(select, pixels, palette, 16, 4, indices);
+                    if (error < iterationError) {
+                        iterationError = error;
+                        std::copy(indices, indices + kBlockPixels, iterationIndices);
+                    }
+                    if (error < bestError) {
+                        bestError = error;
+                        std::copy(q0, q0 + 4, bestQ0);
+                        std::copy(q1, q1 + 4, bestQ1);
+                        bestP0 = pBit0;
+                        bestP1 = pBit1;
+                        std::copy(indices, indices + kBlockPixels, bestIndices);
+                    }
+                }
+
+                if (iteration == iterations || !refineEndpoints(pixels, 4, iterationIndices, kWeights, e0, e1)) {
+                    break;
+                }
+            }
+
+            // El índice del texel 0 se guarda con 3 bits: su bit alto debe ser 0
+            if (bestIndices[0] >= 8) {
+                std::swap(bestQ0, bestQ1);
+                std::swap(bestP0, bestP1);
+                for (auto& index : bestIndices) {
+                    index = static_cast<uint8_t>(15 - index);
+                }
+            }
+
+            std::fill(out, out + 16, uint8_t(0));
+            BitWriter writer{ out };
+            writer.write(1u << 6, 7);
+            for (int c = 0; c < 4; ++c) {
+                writer.write(bestQ0[c], 7);
+                writer.write(bestQ1[c], 7);
+            }
+            writer.write(bestP0, 1);
+            writer.write(bestP1, 1);
+            writer.write(bestIndices[0], 3);
+            for (uint32_t i = 1; i < kBlockPixels; ++i) {
+                writer.write(bestIndices[i], 4);
+            }
+        }
+
+        void decodeBC7Block(const uint8_t* in, uint8_t texels[kBlockPixels][4]) {
+            BitReader reader{ in };
+            if (reader.read(7) != (1u << 6)) {
+                throw std::runtime_error("Only BC7 mode 6 blocks can be decoded");
+            }
+
+            int e0[4], e1[4];
+            for (int c = 0; c < 4; ++c) {
+                e0[c] = static_cast<int>(reader.read(7)) << 1;
+                e1[c] = static_cast<int>(reader.read(7)) << 1;
+            }
+            const int p0 = static_cast<int>(reader.read(1));
+            const int p1 = static_cast<int>(reader.read(1));
+            for (int c = 0; c < 4; ++c) {
+                e0[c] |= p0;
+                e1[c] |= p1;
+            }
+
+            for (uint32_t i = 0; i < kBlockPixels; ++i) {
+                const uint32_t index = reader.read(i == 0 ? 3 : 4);
+                for (int c = 0; c < 4; ++c) {
+                    texels[i][c] = static_cast<uint8_t>(interpolateBC7(e0[c], e1[c], kBC7Weights4[index]));
+                }
+            }
+        }
+
+        SelectIndicesFn chooseSelectIndices(bool useSimd) {
+#if PGRENDER_ENCODER_SSE41
+            if (useSimd && TextureEncoder::isSimdSupported()) {
+                return selectIndicesSse41;
+            }
+#else
+            (void)useSimd;
+#endif
+            return selectIndicesScalar;
+        }
+
+        void runRows(uint32_t blockRows, ThreadPool* threadPool, const std::function<void(size_t, size_t)>& encodeRows) {
+            if (threadPool) {
+                threadPool->parallelFor(blockRows, kRowsPerTask, encodeRows);
+            }
+            else {
+                encodeRows(0, blockRows);
+            }
+        }
+
+    } // namespace
+
+    bool TextureEncoder::canEncode(Texture::Format format) {
+        switch (format) {
+        case Format::BC1:
+        case Format::BC1_SRGB:
+        case Format::BC4:
+        case Format::BC5:
+        case Format::BC7:
+        case Format::BC7_SRGB:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool TextureEncoder::isSimdSupported() {
+#if PGRENDER_ENCODER_SSE41
+        static const bool supported = [] {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 1);
+            return (info[2] & (1 << 19)) != 0;
+#else
+            return __builtin_cpu_supports("sse4.1") != 0;
+#endif
+        }();
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+    std::vector<uint8_t> TextureEncoder::encode(const uint8_t* rgba, uint32_t width, uint32_t height,
+        Texture::Format format, const Options& options) {
+        if (!canEncode(format)) {
+            throw std::invalid_argument("Texture format cannot be encoded on the CPU");
+        }
+        if (!rgba || width == 0 || height == 0) {
+            throw std::invalid_argument("Cannot encode an empty image");
+        }
+
+        const uint32_t blocksX = (width + 3) / 4;
+        const uint32_t blocksY = (height + 3) / 4;
+        const uint32_t blockBytes = Texture::getBlockSizeBytes(format);
+        std::vector<uint8_t> blocks(static_cast<size_t>(blocksX) * blocksY * blockBytes);
+
+        const SelectIndicesFn select = chooseSelectIndices(options.useSimd);
+        const Quality quality = options.quality;
+
+        runRows(blocksY, options.threadPool, [&](size_t begin, size_t end) {
+            BlockPixels pixels;
+            BlockPixels channel;
+            for (size_t by = begin; by < end; ++by) {
+                for (uint32_t bx = 0; bx < blocksX; ++bx) {
+                    uint8_t* out = blocks.data() + (by * blocksX + bx) * blockBytes;
+                    loadBlock(rgba, width, height, bx, static_cast<uint32_t>(by), pixels);
+
+                    switch (format) {
+                    case Format::BC1:
+                    case Format::BC1_SRGB:
+                        encodeBC1Block(pixels, quality, select, out);
+                        break;
+                    case Format::BC4:
+                        encodeBC4Block(pixels, quality, select, out);
+                        break;
+                    case Format::BC5:
+                        // Dos bloques BC4: R y después G
+                        encodeBC4Block(pixels, quality, select, out);
+                        std::copy(pixels.c[1], pixels.c[1] + kBlockPixels, channel.c[0]);
+                        encodeBC4Block(channel, quality, select, out + 8);
+                        break;
+                    default:
+                        encodeBC7Block(pixels, quality, select, out);
+                        break;
+                    }
+                }
+            }
+        });
+
+        return blocks;
+    }
+
+    std::vector<uint8_t> TextureEncoder::decode(const uint8_t* blocks, uint32_t width, uint32_t height,
+        Texture::Format format) {
+        if (!canEncode(format)) {
+            throw std::invalid_argument("Texture format cannot be decoded on the CPU");
+        }
+        if (!blocks || width == 0 || height == 0) {
+            throw std::invalid_argument("Cannot decode an empty image");
+        }
+
+        const uint32_t blocksX = (width + 3) / 4;
+        const uint32_t blocksY = (height + 3) / 4;
+        const uint32_t blockBytes = Texture::getBlockSizeBytes(format);
+        std::vector<uint8_t> rgba(static_cast<size_t>(width) * height * 4);
+
+        for (uint32_t by = 0; by < blocksY; ++by) {
+            for (uint32_t bx = 0; bx < blocksX; ++bx) {
+                const uint8_t* in = blocks + (static_cast<size_t>(by) * blocksX + bx) * blockBytes;
+
+                uint8_t texels[kBlockPixels][4] = {};
+                switch (format) {
+                case Format::BC1:
+                case Format::BC1_SRGB:
+                    decodeBC1Block(in, texels);
+                    break;
+                case Format::BC4:
+                case Format::BC5: {
+                    uint8_t red[kBlockPixels], green[kBlockPixels] = {};
+                    decodeBC4Block(in, red);
+                    if (format == Format::BC5) {
+                        decodeBC4Block(in + 8, green);
+                    }
+                    for (uint32_t i = 0; i < kBlockPixels; ++i) {
+                        texels[i][0] = red[i];
+                        texels[i][1] = format == Format::BC5 ? green[i] : red[i];
+                        texels[i][2] = format == Format::BC5 ? 0 : red[i];
+                        texels[i][3] = 255;
+                    }
+                    break;
+                }
+                default:
+                    decodeBC7Block(in, texels);
+                    break;
+                }
+
+                for (uint32_t y = 0; y < 4 && by * 4 + y < height; ++y) {
+                    for (uint32_t x = 0; x < 4 && bx * 4 + x < width; ++x) {
+                        uint8_t* texel = rgba.data() + ((static_cast<size_t>(by) * 4 + y) * width + bx * 4 + x) * 4;
+                        std::copy(texels[y * 4 + x], texels[y * 4 + x] + 4, texel);
+                    }
+                }
+            }
+        }
+
+        return rgba;
+    }
+
+    void TextureEncoder::upload(Texture& texture, const uint8_t* rgba, uint32_t mipLevel, uint32_t arrayLayer,
+        const Options& options) {
+        const auto& desc = texture.getDesc();
+        const uint32_t width = std::max(desc.width >> mipLevel, 1u);
+        const uint32_t height = std::max(desc.height >> mipLevel, 1u);
+
+        const std::vector<uint8_t> blocks = encode(rgba, width, height, desc.format, options);
+        texture.update(blocks.data(), blocks.size(), mipLevel, arrayLayer);
+    }
+
+} // namespace pgrender
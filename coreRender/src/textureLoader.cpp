@@ -0,0 +1,416 @@
+#include "PGRenderCore/textureLoader.h"
+#include "PGRenderCore/context.h"
+#include <stdexcept>
+#include <algorithm>
+#include <optional>
+#include <fstream>
+#include <cstring>
+
+namespace pgrender {
+
+    namespace {
+
+        using Format = Texture::Format;
+
+        // ===== DDS =====
+
+        constexpr size_t kDDSHeaderSize = 4 + 124;     // "DDS " + DDS_HEADER
+        constexpr size_t kDDSHeaderDX10Size = 20;
+
+        constexpr uint32_t kPixelFormatAlphaPixels = 0x1;
+        constexpr uint32_t kPixelFormatFourCC = 0x4;
+        constexpr uint32_t kPixelFormatRGB = 0x40;
+        constexpr uint32_t kPixelFormatLuminance = 0x20000;
+
+        constexpr uint32_t kCaps2Cubemap = 0x200;
+        constexpr uint32_t kCaps2Volume = 0x200000;
+
+        constexpr uint32_t kDX10MiscTextureCube = 0x4;
+        constexpr uint32_t kDX10DimensionTexture1D = 2;
+        constexpr uint32_t kDX10DimensionTexture3D = 4;
+
+        // ===== KTX2 =====
+
+        constexpr uint8_t kKTX2Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+        constexpr size_t kKTX2HeaderSize = 80;        // Identificador + cabecera + índice
+        constexpr size_t kKTX2LevelIndexSize = 24;    // byteOffset, byteLength, uncompressedByteLength
+
+        // Límites de las cabeceras: con ellos los tamaños de los niveles caben en size_t
+        constexpr uint32_t kMaxTextureSize = 16384;
+        constexpr uint32_t kMax3DTextureSize = 2048;
+        constexpr uint32_t kMaxTextureLayers = 2048;  // Capas por cara en arrays de cubemaps
+
+        constexpr uint32_t makeFourCC(char a, char b, char c, char d) {
+            return static_cast<uint32_t>(static_cast<uint8_t>(a)) |
+                (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8) |
+                (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16) |
+                (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+        }
+
+        // Los dos contenedores son little-endian
+        uint32_t read32(const uint8_t* p) {
+            return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+                (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+        }
+
+        uint64_t read64(const uint8_t* p) {
+            return static_cast<uint64_t>(read32(p)) | (static_cast<uint64_t>(read32(p + 4)) << 32);
+        }
+
+        std::optional<Format> formatFromFourCC(uint32_t fourCC) {
+            switch (fourCC) {
+            case makeFourCC('D', 'X', 'T', '1'): return Format::BC1;
+            case makeFourCC('D', 'X', 'T', '5'): return Format::BC3;
+            case makeFourCC('A', 'T', 'I', '1'):
+            case makeFourCC('B', 'C', '4', 'U'): return Format::BC4;
+            case makeFourCC('A', 'T', 'I', '2'):
+            case makeFourCC('B', 'C', '5', 'U'): return Format::BC5;
+            // Códigos D3DFORMAT de los formatos en coma flotante
+            case 111: return Format::R16F;
+            case 112: return Format::RG16F;
+            case 113: return Format::RGBA16F;
+            case 114: return Format::R32F;
+            case 115: return Format::RG32F;
+            case 116: return Format::RGBA32F;
+            default: return std::nullopt;
+            }
+        }
+
+        std::optional<Format> formatFromDXGI(uint32_t dxgiFormat, bool& swapRedBlue) {
+            switch (dxgiFormat) {
+            case 2: return Format::RGBA32F;
+            case 6: return Format::RGB32F;
+            case 10: return Format::RGBA16F;
+            case 16: return Format::RG32F;
+            case 24: return Format::RGB10_A2;
+            case 26: return Format::R11G11B10F;
+            case 28: return Format::RGBA8;
+            case 29: return Format::SRGB8_A8;
+            case 34: return Format::RG16F;
+            case 36: return Format::RG16UI;
+            case 40: return Format::Depth32F;
+            case 41: return Format::R32F;
+            case 42: return Format::R32UI;
+            case 49: return Format::RG8;
+            case 54: return Format::R16F;
+            case 55: return Format::Depth16;
+            case 61: return Format::R8;
+            case 71: return Format::BC1;
+            case 72: return Format::BC1_SRGB;
+            case 77: return Format::BC3;
+            case 78: return Format::BC3_SRGB;
+            case 80: return Format::BC4;
+            case 83: return Format::BC5;
+            case 87: swapRedBlue = true; return Format::RGBA8;
+            case 91: swapRedBlue = true; return Format::SRGB8_A8;
+            case 95: return Format::BC6H_UF16;
+            case 96: return Format::BC6H_SF16;
+            case 98: return Format::BC7;
+            case 99: return Format::BC7_SRGB;
+            default: return std::nullopt;
+            }
+        }
+
+        std::optional<Format> formatFromMasks(uint32_t bitCount, uint32_t rMask, uint32_t gMask, uint32_t bMask,
+            bool& swapRedBlue) {
+            if (bitCount == 32 && gMask == 0x0000FF00) {
+                if (rMask == 0x000000FF && bMask == 0x00FF0000) return Format::RGBA8;
+                if (rMask == 0x00FF0000 && bMask == 0x000000FF) {
+                    swapRedBlue = true;
+                    return Format::RGBA8;
+                }
+            }
+            if (bitCount == 32 && rMask == 0x000003FF && gMask == 0x000FFC00 && bMask == 0x3FF00000) {
+                return Format::RGB10_A2;
+            }
+            if (bitCount == 8 && rMask == 0xFF) return Format::R8;
+            if (bitCount == 16 && rMask == 0xFF && gMask == 0xFF00) return Format::RG8;
+            return std::nullopt;
+        }
+
+        std::optional<Format> formatFromVkFormat(uint32_t vkFormat) {
+            switch (vkFormat) {
+            case 9: return Format::R8;
+            case 16: return Format::RG8;
+            case 23: return Format::RGB8;
+            // 29 (VK_FORMAT_R8G8B8_SRGB) no tiene formato equivalente: como RGB8 se perdería la conversión sRGB
+            case 37: return Format::RGBA8;
+            case 43: return Format::SRGB8_A8;
+            case 64: return Format::RGB10_A2;
+            case 76: return Format::R16F;
+            case 81: return Format::RG16UI;
+            case 83: return Format::RG16F;
+            case 90: return Format::RGB16F;
+            case 97: return Format::RGBA16F;
+            case 98: return Format::R32UI;
+            case 100: return Format::R32F;
+            case 103: return Format::RG32F;
+            case 106: return Format::RGB32F;
+            case 109: return Format::RGBA32F;
+            case 122: return Format::R11G11B10F;
+            case 124: return Format::Depth16;
+            case 126: return Format::Depth32F;
+            case 131:
+            case 133: return Format::BC1;
+            case 132:
+            case 134: return Format::BC1_SRGB;
+            case 137: return Format::BC3;
+            case 138: return Format::BC3_SRGB;
+            case 139: return Format::BC4;
+            case 141: return Format::BC5;
+            case 143: return Format::BC6H_UF16;
+            case 144: return Format::BC6H_SF16;
+            case 145: return Format::BC7;
+            case 146: return Format::BC7_SRGB;
+            case 147: return Format::ETC2_RGB8;
+            case 148: return Format::ETC2_RGB8_SRGB;
+            case 151: return Format::ETC2_RGBA8;
+            case 152: return Format::ETC2_RGBA8_SRGB;
+            case 157: return Format::ASTC_4x4;
+            case 158: return Format::ASTC_4x4_SRGB;
+            case 165: return Format::ASTC_6x6;
+            case 166: return Format::ASTC_6x6_SRGB;
+            case 171: return Format::ASTC_8x8;
+            case 172: return Format::ASTC_8x8_SRGB;
+            default: return std::nullopt;
+            }
+        }
+
+        uint16_t clampMipLevels(const Texture::Desc& desc, uint32_t mipLevels) {
+            uint32_t largest = std::max({ desc.width, desc.height, desc.depth, 1u });
+            uint32_t fullChain = 1;
+            while (largest > 1) {
+                largest >>= 1;
+                ++fullChain;
+            }
+            return static_cast<uint16_t>(std::clamp(mipLevels, 1u, fullChain));
+        }
+
+        size_t levelSizeBytes(const Texture::Desc& desc, uint32_t mipLevel) {
+            const uint32_t depth = desc.type == Texture::Type::Texture3D ? std::max(desc.depth >> mipLevel, 1u) : 1u;
+            return Texture::getImageSize(desc.format,
+                std::max(desc.width >> mipLevel, 1u), std::max(desc.height >> mipLevel, 1u), depth);
+        }
+
+        void checkDesc(const Texture::Desc& desc) {
+            if (desc.width == 0 || desc.height == 0 || desc.depth == 0) {
+                throw std::runtime_error("Texture file has an empty image");
+            }
+            if (desc.width > kMaxTextureSize || desc.height > kMaxTextureSize || desc.depth > kMax3DTextureSize ||
+                desc.arrayLayers > kMaxTextureLayers || Texture::getLayerCount(desc) > kMaxTextureLayers) {
+                throw std::runtime_error("Texture file dimensions exceed the supported limits");
+            }
+            if (Texture::isCompressedFormat(desc.format) && desc.type == Texture::Type::Texture1D) {
+                throw std::runtime_error("Compressed 1D textures are not supported");
+            }
+        }
+
+    } // namespace
+
+    TextureLoader::TextureData TextureLoader::loadFromFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            throw std::runtime_error("Cannot open texture file: " + path);
+        }
+
+        const std::streamsize size = file.tellg();
+        std::vector<uint8_t> contents(static_cast<size_t>(std::max<std::streamsize>(size, 0)));
+        file.seekg(0, std::ios::beg);
+        if (!file.read(reinterpret_cast<char*>(contents.data()), size)) {
+            throw std::runtime_error("Cannot read texture file: " + path);
+        }
+
+        return loadFromMemory(contents.data(), contents.size());
+    }
+
+    TextureLoader::TextureData TextureLoader::loadFromMemory(const void* data, size_t size) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        if (bytes && size >= 4 && std::memcmp(bytes, "DDS ", 4) == 0) {
+            return loadDDS(data, size);
+        }
+        if (bytes && size >= sizeof(kKTX2Identifier) && std::memcmp(bytes, kKTX2Identifier, sizeof(kKTX2Identifier)) == 0) {
+            return loadKTX2(data, size);
+        }
+        throw std::runtime_error("Unknown texture container (expected DDS or KTX2)");
+    }
+
+    TextureLoader::TextureData TextureLoader::loadDDS(const void* data, size_t size) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        if (!bytes || size < kDDSHeaderSize || std::memcmp(bytes, "DDS ", 4) != 0 || read32(bytes + 4) != 124) {
+            throw std::runtime_error("Invalid DDS header");
+        }
+
+        // Offsets relativos a DDS_HEADER
+        const uint8_t* header = bytes + 4;
+        const uint32_t height = read32(header + 8);
+        const uint32_t width = read32(header + 12);
+        const uint32_t depth = read32(header + 20);
+        const uint32_t mipCount = read32(header + 24);
+        const uint32_t pixelFlags = read32(header + 76);
+        const uint32_t fourCC = read32(header + 80);
+        const uint32_t caps2 = read32(header + 108);
+
+        bool cube = (caps2 & kCaps2Cubemap) != 0;
+        bool volume = (caps2 & kCaps2Volume) != 0;
+        bool oneDimensional = false;
+        bool swapRedBlue = false;
+        uint32_t arraySize = 1;
+        size_t dataOffset = kDDSHeaderSize;
+        std::optional<Format> format;
+
+        if ((pixelFlags & kPixelFormatFourCC) && fourCC == makeFourCC('D', 'X', '1', '0')) {
+            if (size < kDDSHeaderSize + kDDSHeaderDX10Size) {
+                throw std::runtime_error("Truncated DDS DX10 header");
+            }
+            const uint8_t* dx10 = bytes + kDDSHeaderSize;
+            format = formatFromDXGI(read32(dx10), swapRedBlue);
+            const uint32_t dimension = read32(dx10 + 4);
+            cube = (read32(dx10 + 8) & kDX10MiscTextureCube) != 0;
+            volume = dimension == kDX10DimensionTexture3D;
+            oneDimensional = dimension == kDX10DimensionTexture1D;
+            arraySize = std::max(read32(dx10 + 12), 1u);
+            dataOffset += kDDSHeaderDX10Size;
+        }
+        else if (pixelFlags & kPixelFormatFourCC) {
+            format = formatFromFourCC(fourCC);
+        }
+        else if (pixelFlags & (kPixelFormatRGB | kPixelFormatLuminance | kPixelFormatAlphaPixels)) {
+            format = formatFromMasks(read32(header + 84), read32(header + 88), read32(header + 92),
+                read32(header + 96), swapRedBlue);
+        }
+
+        if (!format) {
+            throw std::runtime_error("Unsupported DDS pixel format");
+        }
+
+        TextureData result;
+        Texture::Desc& desc = result.desc;
+        if (arraySize > 1 && (volume || oneDimensional)) {
+            throw std::runtime_error("DDS 1D and 3D texture arrays are not supported");
+        }
+
+        desc.type = cube ? (arraySize > 1 ? Texture::Type::TextureCubeArray : Texture::Type::TextureCube)
+            : arraySize > 1 ? Texture::Type::Texture2DArray
+            : volume ? Texture::Type::Texture3D
+            : oneDimensional ? Texture::Type::Texture1D
+            : Texture::Type::Texture2D;
+        desc.width = width;
+        desc.height = oneDimensional ? 1 : height;
+        desc.depth = volume ? depth : 1;
+        desc.arrayLayers = arraySize;
+        desc.format = *format;
+        checkDesc(desc);
+        desc.mipLevels = clampMipLevels(desc, mipCount);
+
+        // DDS guarda la cadena de mips completa de cada cara, una cara tras otra (y un elemento del array tras otro)
+        const uint32_t layers = Texture::getLayerCount(desc);
+        size_t offset = dataOffset;
+        for (uint32_t layer = 0; layer < layers; ++layer) {
+            for (uint32_t mip = 0; mip < desc.mipLevels; ++mip) {
+                const size_t levelSize = levelSizeBytes(desc, mip);
+                if (levelSize > size - offset) {
+                    throw std::runtime_error("Truncated DDS image data");
+                }
+                result.subresources.push_back({ mip, layer, offset - dataOffset, levelSize });
+                offset += levelSize;
+            }
+        }
+        result.bytes.assign(bytes + dataOffset, bytes + offset);
+
+        if (swapRedBlue) {
+            // BGRA -> RGBA
+            for (size_t i = 0; i + 3 < result.bytes.size(); i += 4) {
+                std::swap(result.bytes[i], result.bytes[i + 2]);
+            }
+        }
+
+        return result;
+    }
+
+    TextureLoader::TextureData TextureLoader::loadKTX2(const void* data, size_t size) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        if (!bytes || size < kKTX2HeaderSize || std::memcmp(bytes, kKTX2Identifier, sizeof(kKTX2Identifier)) != 0) {
+            throw std::runtime_error("Invalid KTX2 header");
+        }
+
+        const uint32_t vkFormat = read32(bytes + 12);
+        const uint32_t width = read32(bytes + 20);
+        const uint32_t height = read32(bytes + 24);
+        const uint32_t depth = read32(bytes + 28);
+        const uint32_t layerCount = read32(bytes + 32);
+        const uint32_t faceCount = read32(bytes + 36);
+        const uint32_t levelCount = read32(bytes + 40);
+        const uint32_t supercompression = read32(bytes + 44);
+
+        if (supercompression != 0) {
+            throw std::runtime_error("Supercompressed KTX2 files are not supported");
+        }
+        if (faceCount != 1 && faceCount != 6) {
+            throw std::runtime_error("Invalid KTX2 face count");
+        }
+
+        const std::optional<Format> format = formatFromVkFormat(vkFormat);
+        if (!format) {
+            throw std::runtime_error("Unsupported KTX2 vkFormat");
+        }
+
+        TextureData result;
+        Texture::Desc& desc = result.desc;
+        if (layerCount > 0 && (depth > 0 || height == 0)) {
+            throw std::runtime_error("KTX2 1D and 3D texture arrays are not supported");
+        }
+
+        desc.type = faceCount == 6 ? (layerCount > 0 ? Texture::Type::TextureCubeArray : Texture::Type::TextureCube)
+            : layerCount > 0 ? Texture::Type::Texture2DArray
+            : depth > 0 ? Texture::Type::Texture3D
+            : height == 0 ? Texture::Type::Texture1D
+            : Texture::Type::Texture2D;
+        desc.width = width;
+        desc.height = std::max(height, 1u);
+        desc.depth = std::max(depth, 1u);
+        desc.arrayLayers = std::max(layerCount, 1u);
+        desc.format = *format;
+        checkDesc(desc);
+        // levelCount == 0 indica que el fichero sólo trae el nivel base
+        desc.mipLevels = clampMipLevels(desc, levelCount);
+
+        if (kKTX2HeaderSize + desc.mipLevels * kKTX2LevelIndexSize > size) {
+            throw std::runtime_error("Truncated KTX2 level index");
+        }
+
+        // Cada nivel tiene su propio offset y contiene todas sus capas y caras consecutivas
+        for (uint32_t mip = 0; mip < desc.mipLevels; ++mip) {
+            const uint8_t* levelIndex = bytes + kKTX2HeaderSize + mip * kKTX2LevelIndexSize;
+            const uint64_t byteOffset = read64(levelIndex);
+            const uint64_t byteLength = read64(levelIndex + 8);
+            const size_t faceSize = levelSizeBytes(desc, mip);
+            const uint32_t layers = Texture::getLayerCount(desc);
+
+            if (byteOffset > size || byteLength > size - byteOffset || faceSize > byteLength / layers) {
+                throw std::runtime_error("Truncated KTX2 image data");
+            }
+
+            for (uint32_t layer = 0; layer < layers; ++layer) {
+                const uint8_t* source = bytes + byteOffset + layer * faceSize;
+                result.subresources.push_back({ mip, layer, result.bytes.size(), faceSize });
+                result.bytes.insert(result.bytes.end(), source, source + faceSize);
+            }
+        }
+
+        return result;
+    }
+
+    std::shared_ptr<Texture> TextureLoader::createTexture(Context& context, const TextureData& data) {
+        if (!context.isFormatSupported(data.desc.format)) {
+            throw std::runtime_error("Texture format is not supported by this device");
+        }
+
+        auto texture = context.createTexture(data.desc);
+        for (const auto& subresource : data.subresources) {
+            texture->update(data.bytes.data() + subresource.offset, subresource.size,
+                subresource.mipLevel, subresource.layer);
+        }
+        return texture;
+    }
+
+} // namespace pgrender
@@ -0,0 +1,261 @@
+#include "PGRenderCore/textureStreamer.h"
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+
+namespace pgrender {
+
+    TextureStreamer::TextureStreamer(const Desc& desc)
+        : m_desc(desc)
+    {
+    }
+
+    void TextureStreamer::add(const std::shared_ptr<Texture>& texture, MipLoader loader) {
+        if (!texture) {
+            throw std::invalid_argument("Cannot stream a null texture");
+        }
+        if (!loader) {
+            throw std::invalid_argument("Texture streaming needs a mip loader");
+        }
+        if (findEntry(texture.get())) {
+            return;
+        }
+        if (texture->hasBindlessHandles()) {
+            throw std::invalid_argument("Cannot stream a texture with bindless handles");
+        }
+
+        const auto& desc = texture->getDesc();
+        const uint32_t mipLevels = std::max<uint32_t>(desc.mipLevels, 1);
+
+        Entry entry;
+        entry.texture = texture;
+        entry.loader = std::move(loader);
+        entry.coarsestLevel = mipLevels - 1;
+
+        if (desc.sparse) {
+            // La cola de mips se asigna como un bloque: se carga completa y no se libera
+            const uint32_t tailStart = std::min(texture->getSparseMipTailStart(), mipLevels - 1);
+            entry.coarsestLevel = tailStart;
+            for (uint32_t mip = tailStart; mip < mipLevels; ++mip) {
+                Texture::Region region;
+                region.width = std::max<uint32_t>(desc.width >> mip, 1);
+                region.height = std::max<uint32_t>(desc.height >> mip, 1);
+                region.depth = desc.type == Texture::Type::Texture3D ? std::max<uint32_t>(desc.depth >> mip, 1) : Texture::getLayerCount(desc);
+                region.mipLevel = mip;
+                texture->commitRegion(region, true);
+                entry.loader(*texture, mip);
+                entry.residentBytes += Texture::getLevelSizeBytes(desc, mip);
+            }
+            texture->setResidentBaseLevel(entry.coarsestLevel);
+        }
+        else {
+            for (uint32_t mip = entry.coarsestLevel; mip < mipLevels; ++mip) {
+                entry.residentBytes += Texture::getLevelSizeBytes(desc, mip);
+            }
+            texture->setResidentBaseLevel(entry.coarsestLevel);
+            entry.loader(*texture, entry.coarsestLevel);
+        }
+
+        entry.baseLevel = entry.coarsestLevel;
+
+        m_statistics.residentBytes += entry.residentBytes;
+        m_statistics.levelsLoaded += mipLevels - entry.coarsestLevel;
+        m_statistics.textures++;
+        m_entries.push_back(std::move(entry));
+    }
+
+    void TextureStreamer::remove(const std::shared_ptr<Texture>& texture) {
+        auto it = std::find_if(m_entries.begin(), m_entries.end(),
+            [&](const Entry& entry) { return entry.texture == texture; });
+        if (it == m_entries.end()) {
+            return;
+        }
+
+        if (!isFrozen(*it)) {
+            setLodBias(*it, 0.0f);
+        }
+        m_statistics.residentBytes -= it->residentBytes;
+        m_statistics.textures--;
+        m_entries.erase(it);
+    }
+
+    void TextureStreamer::setScreenSize(const std::shared_ptr<Texture>& texture, float screenSize) {
+        Entry* entry = findEntry(texture.get());
+        if (!entry) {
+            throw std::invalid_argument("Texture is not managed by the streamer");
+        }
+        entry->screenSize = std::max(screenSize, 0.0f);
+    }
+
+    uint32_t TextureStreamer::desiredBaseLevel(const Texture::Desc& desc, float screenSize) {
+        const uint32_t coarsest = std::max<uint32_t>(desc.mipLevels, 1) - 1;
+        if (screenSize <= 0.0f) {
+            return coarsest;
+        }
+
+        const float size = static_cast<float>(std::max(desc.width, desc.height));
+        const float level = std::floor(std::log2(std::max(size / screenSize, 1.0f)));
+        return std::min(static_cast<uint32_t>(level), coarsest);
+    }
+
+    void TextureStreamer::update() {
+        // Avanzar las transiciones de los niveles cargados en frames anteriores
+        if (m_desc.lodFadeFrames > 0) {
+            const float step = 1.0f / static_cast<float>(m_desc.lodFadeFrames);
+            for (auto& entry : m_entries) {
+                if (entry.lodBias > 0.0f && !isFrozen(entry)) {
+                    setLodBias(entry, std::max(entry.lodBias - step, 0.0f));
+                }
+            }
+        }
+
+        // Texturas que necesitan más detalle, de mayor a menor tamaño en pantalla
+        std::vector<Entry*> requests;
+        uint32_t pending = 0;
+        for (auto& entry : m_entries) {
+            const uint32_t desired = std::min(desiredBaseLevel(entry.texture->getDesc(), entry.screenSize), entry.coarsestLevel);
+            if (desired >= entry.baseLevel) {
+                continue;
+            }
+            if (isFrozen(entry)) {
+                pending++;
+            }
+            else {
+                requests.push_back(&entry);
+            }
+        }
+        std::sort(requests.begin(), requests.end(), [](const Entry* a, const Entry* b) {
+            return a->screenSize > b->screenSize;
+        });
+
+        // Un nivel por textura y frame: primero los mips gruesos de todas
+        uint32_t loaded = 0;
+        for (Entry* entry : requests) {
+            const size_t cost = Texture::getLevelSizeBytes(entry->texture->getDesc(), entry->baseLevel - 1);
+            if (loaded >= m_desc.maxLevelsPerFrame || !makeRoom(cost, entry)) {
+                pending++;
+                continue;
+            }
+            loadLevel(*entry);
+            loaded++;
+            const uint32_t desired = std::min(desiredBaseLevel(entry->texture->getDesc(), entry->screenSize), entry->coarsestLevel);
+            if (desired < entry->baseLevel) {
+                pending++;
+            }
+        }
+        m_statistics.pendingTextures = pending;
+
+        // Si el presupuesto se ha reducido, liberar hasta volver a cumplirlo
+        if (m_statistics.residentBytes > m_desc.memoryBudgetBytes) {
+            makeRoom(0, nullptr);
+        }
+    }
+
+    TextureStreamer::Entry* TextureStreamer::findEntry(const Texture* texture) {
+        for (auto& entry : m_entries) {
+            if (entry.texture.get() == texture) {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    void TextureStreamer::loadLevel(Entry& entry) {
+        Texture& texture = *entry.texture;
+        const auto& desc = texture.getDesc();
+        const uint32_t mip = entry.baseLevel - 1;
+
+        if (desc.sparse) {
+            Texture::Region region;
+            region.width = std::max<uint32_t>(desc.width >> mip, 1);
+            region.height = std::max<uint32_t>(desc.height >> mip, 1);
+            region.depth = desc.type == Texture::Type::Texture3D ? std::max<uint32_t>(desc.depth >> mip, 1) : Texture::getLayerCount(desc);
+            region.mipLevel = mip;
+            texture.commitRegion(region, true);
+            entry.loader(texture, mip);
+            texture.setResidentBaseLevel(mip);
+        }
+        else {
+            // Reasigna conservando los niveles existentes; el nuevo nivel se sube después
+            texture.setResidentBaseLevel(mip);
+            entry.loader(texture, mip);
+        }
+
+        const size_t bytes = Texture::getLevelSizeBytes(desc, mip);
+        entry.baseLevel = mip;
+        entry.residentBytes += bytes;
+        m_statistics.residentBytes += bytes;
+        m_statistics.levelsLoaded++;
+
+        // El nivel nuevo aparece muestreando todavía como el anterior
+        if (m_desc.lodFadeFrames > 0) {
+            setLodBias(entry, 1.0f);
+        }
+    }
+
+    void TextureStreamer::evictLevel(Entry& entry) {
+        Texture& texture = *entry.texture;
+        const auto& desc = texture.getDesc();
+        const uint32_t mip = entry.baseLevel;
+
+        // Dejar de muestrear el nivel antes de liberar su memoria
+        texture.setResidentBaseLevel(mip + 1);
+        if (desc.sparse) {
+            Texture::Region region;
+            region.width = std::max<uint32_t>(desc.width >> mip, 1);
+            region.height = std::max<uint32_t>(desc.height >> mip, 1);
+            region.depth = desc.type == Texture::Type::Texture3D ? std::max<uint32_t>(desc.depth >> mip, 1) : Texture::getLayerCount(desc);
+            region.mipLevel = mip;
+            texture.commitRegion(region, false);
+        }
+
+        const size_t bytes = Texture::getLevelSizeBytes(desc, mip);
+        entry.baseLevel = mip + 1;
+        entry.residentBytes -= bytes;
+        m_statistics.residentBytes -= bytes;
+        m_statistics.levelsEvicted++;
+
+        // Sin el nivel no hay transición que completar
+        setLodBias(entry, 0.0f);
+    }
+
+    void TextureStreamer::setLodBias(Entry& entry, float bias) {
+        if (entry.lodBias != bias) {
+            entry.lodBias = bias;
+            entry.texture->setLodBias(bias);
+        }
+    }
+
+    bool TextureStreamer::makeRoom(size_t bytes, const Entry* requester) {
+        while (m_statistics.residentBytes + bytes > m_desc.memoryBudgetBytes) {
+            // Víctima: primero niveles más finos de lo necesario, después la textura menos prioritaria
+            Entry* victim = nullptr;
+            bool victimExcess = false;
+            for (auto& entry : m_entries) {
+                if (&entry == requester || entry.baseLevel >= entry.coarsestLevel || isFrozen(entry)) {
+                    continue;
+                }
+
+                const uint32_t desired = desiredBaseLevel(entry.texture->getDesc(), entry.screenSize);
+                const bool excess = entry.baseLevel < desired;
+                // Sólo se quita detalle útil a texturas menos prioritarias que la que lo pide
+                if (!excess && requester && entry.screenSize >= requester->screenSize) {
+                    continue;
+                }
+
+                if (!victim || (excess && !victimExcess) ||
+                    (excess == victimExcess && entry.screenSize < victim->screenSize)) {
+                    victim = &entry;
+                    victimExcess = excess;
+                }
+            }
+
+            if (!victim) {
+                return false;
+            }
+            evictLevel(*victim);
+        }
+        return true;
+    }
+
+} // namespace pgrender
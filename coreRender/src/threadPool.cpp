@@ -0,0 +1,125 @@
+#include "PGRenderCore/threadPool.h"
+#include <atomic>
+#include <exception>
+#include <algorithm>
+#include <memory>
+
+namespace pgrender {
+
+    ThreadPool::ThreadPool(uint32_t threadCount) {
+        if (threadCount == 0) {
+            const uint32_t cores = std::thread::hardware_concurrency();
+            threadCount = std::max<uint32_t>(cores > 1 ? cores - 1 : 1, 1);
+        }
+
+        m_workers.reserve(threadCount);
+        for (uint32_t i = 0; i < threadCount; ++i) {
+            m_workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_condition.notify_all();
+        for (auto& worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    std::future<void> ThreadPool::submit(std::function<void()> task) {
+        auto packaged = std::make_shared<std::packaged_task<void()>>(std::move(task));
+        std::future<void> result = packaged->get_future();
+        enqueue([packaged] { (*packaged)(); });
+        return result;
+    }
+
+    void ThreadPool::parallelFor(size_t count, size_t grainSize,
+        const std::function<void(size_t begin, size_t end)>& body) {
+        if (count == 0) {
+            return;
+        }
+        grainSize = std::max<size_t>(grainSize, 1);
+        const size_t chunkCount = (count + grainSize - 1) / grainSize;
+
+        if (chunkCount == 1) {
+            body(0, count);
+            return;
+        }
+
+        // Estado compartido: las tareas auxiliares pueden arrancar cuando el bucle ya ha terminado
+        struct State {
+            std::atomic<size_t> nextChunk{ 0 };
+            size_t completedChunks = 0;
+            std::exception_ptr error;
+            std::mutex mutex;
+            std::condition_variable done;
+        };
+        auto state = std::make_shared<State>();
+
+        auto runChunks = [state, count, grainSize, chunkCount, &body]() {
+            for (;;) {
+                const size_t chunk = state->nextChunk.fetch_add(1);
+                if (chunk >= chunkCount) {
+                    return;
+                }
+                const size_t begin = chunk * grainSize;
+                std::exception_ptr error;
+                try {
+                    body(begin, std::min(begin + grainSize, count));
+                }
+                catch (...) {
+                    error = std::current_exception();
+                }
+
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (error && !state->error) {
+                    state->error = error;
+                }
+                if (++state->completedChunks == chunkCount) {
+                    state->done.notify_all();
+                }
+            }
+        };
+
+        // body sólo se usa mientras quedan trozos, y el llamante no vuelve hasta completarlos
+        const size_t helpers = std::min<size_t>(m_workers.size(), chunkCount - 1);
+        for (size_t i = 0; i < helpers; ++i) {
+            enqueue(runChunks);
+        }
+        runChunks();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->done.wait(lock, [&] { return state->completedChunks == chunkCount; });
+        if (state->error) {
+            std::rethrow_exception(state->error);
+        }
+    }
+
+    void ThreadPool::enqueue(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.push_back(std::move(task));
+        }
+        m_condition.notify_one();
+    }
+
+    void ThreadPool::workerLoop() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+                if (m_stopping && m_tasks.empty()) {
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+} // namespace pgrender
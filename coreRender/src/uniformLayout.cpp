@@ -0,0 +1,173 @@
+#include "PGRenderCore/uniformLayout.h"
+#include <stdexcept>
+#include <cstring>
+#include <sstream>
+
+namespace pgrender {
+
+    namespace {
+
+        const char* toString(ProgramReflection::BaseType type) {
+            switch (type) {
+            case ProgramReflection::BaseType::Float: return "float";
+            case ProgramReflection::BaseType::Double: return "double";
+            case ProgramReflection::BaseType::Int: return "int";
+            case ProgramReflection::BaseType::UInt: return "uint";
+            case ProgramReflection::BaseType::Bool: return "bool";
+            default: return "unknown";
+            }
+        }
+
+        std::string describeType(const ProgramReflection::Uniform& member) {
+            std::string type = toString(member.baseType);
+            if (member.columns > 1) {
+                type += " mat" + std::to_string(member.columns) + "x" + std::to_string(member.rows);
+            }
+            else if (member.rows > 1) {
+                type += " vec" + std::to_string(member.rows);
+            }
+            if (member.arraySize > 1) {
+                type += "[" + std::to_string(member.arraySize) + "]";
+            }
+            return type;
+        }
+
+        // En los bloques, bool ocupa 4 bytes: se escribe con int o uint
+        bool isCompatible(ProgramReflection::BaseType member, ProgramReflection::BaseType value) {
+            return member == value || (member == ProgramReflection::BaseType::Bool &&
+                (value == ProgramReflection::BaseType::Int || value == ProgramReflection::BaseType::UInt));
+        }
+
+    } // namespace
+
+    void validateUniformBlock(const ProgramReflection::Block& expected, const ProgramReflection::Block& actual) {
+        std::ostringstream errors;
+
+        for (const auto& member : expected.members) {
+            const ProgramReflection::Uniform* linked = actual.findMember(member.hash);
+            if (!linked) {
+                errors << "\n  '" << member.name << "' is not a member of the block";
+                continue;
+            }
+            if (linked->baseType != member.baseType || linked->columns != member.columns ||
+                linked->rows != member.rows || linked->arraySize != member.arraySize) {
+                errors << "\n  '" << member.name << "' is " << describeType(*linked) << " but expected " << describeType(member);
+                continue;
+            }
+            if (linked->offset != member.offset) {
+                errors << "\n  '" << member.name << "' is at offset " << linked->offset << " but expected " << member.offset;
+            }
+            if (member.arraySize > 1 && linked->arrayStride != member.arrayStride) {
+                errors << "\n  '" << member.name << "' has array stride " << linked->arrayStride << " but expected " << member.arrayStride;
+            }
+            if (member.columns > 1 && (linked->matrixStride != member.matrixStride || linked->rowMajor != member.rowMajor)) {
+                errors << "\n  '" << member.name << "' has a different matrix layout";
+            }
+        }
+
+        // Un miembro sin describir quedaría sin inicializar en cada subida
+        for (const auto& member : actual.members) {
+            if (!expected.findMember(member.hash)) {
+                errors << "\n  '" << member.name << "' is not described";
+            }
+        }
+
+        const std::string message = errors.str();
+        if (!message.empty()) {
+            throw std::invalid_argument("Uniform block '" + actual.name + "' does not match the expected layout:" + message);
+        }
+    }
+
+    // ===== UNIFORM WRITER =====
+
+    UniformWriter::UniformWriter(const ProgramReflection::Block& layout, void* data)
+        : m_layout(&layout), m_data(data)
+    {}
+
+    void UniformWriter::set(NameHash member, float value, uint32_t arrayIndex) {
+        write(member, ProgramReflection::BaseType::Float, 1, 1, &value, 1, arrayIndex);
+    }
+
+    void UniformWriter::set(NameHash member, int32_t value, uint32_t arrayIndex) {
+        write(member, ProgramReflection::BaseType::Int, 1, 1, &value, 1, arrayIndex);
+    }
+
+    void UniformWriter::set(NameHash member, uint32_t value, uint32_t arrayIndex) {
+        write(member, ProgramReflection::BaseType::UInt, 1, 1, &value, 1, arrayIndex);
+    }
+
+    void UniformWriter::set(NameHash member, const glm::vec2& value, uint32_t arrayIndex) {
+        write(member, ProgramReflection::BaseType::Float, 1, 2, &value[0], 1, arrayIndex);
+    }
+
+    void UniformWriter::set(NameHash member, const glm::vec3& value, uint32_t arrayIndex) {
+        write(member, ProgramReflection::BaseType::Float, 1, 3, &value[0], 1, arrayIndex);
+    }
+
+    void UniformWriter::set(NameHash member, const glm::vec4& value, uint32_t arrayIndex) {
+        write(member, ProgramReflection::BaseType::Float, 1, 4, &value[0], 1, arrayIndex);
+    }
+
+    void UniformWriter::set(NameHash member, const glm::mat3& value, uint32_t arrayIndex) {
+        write(member, ProgramReflection::BaseType::Float, 3, 3, &value[0][0], 1, arrayIndex);
+    }
+
+    void UniformWriter::set(NameHash member, const glm::mat4& value, uint32_t arrayIndex) {
+        write(member, ProgramReflection::BaseType::Float, 4, 4, &value[0][0], 1, arrayIndex);
+    }
+
+    void UniformWriter::set(NameHash member, const glm::vec4* values, uint32_t count, uint32_t firstIndex) {
+        write(member, ProgramReflection::BaseType::Float, 1, 4, &values[0][0], count, firstIndex);
+    }
+
+    void UniformWriter::set(NameHash member, const glm::mat4* values, uint32_t count, uint32_t firstIndex) {
+        write(member, ProgramReflection::BaseType::Float, 4, 4, &values[0][0][0], count, firstIndex);
+    }
+
+    void UniformWriter::setRaw(const void* data, size_t size, size_t offset) {
+        if (!valid()) {
+            throw std::logic_error("UniformWriter has no block");
+        }
+        if (m_layout->dataSize != 0 && offset + size > m_layout->dataSize) {
+            throw std::invalid_argument("Raw write exceeds uniform block '" + m_layout->name + "'");
+        }
+        std::memcpy(static_cast<uint8_t*>(m_data) + offset, data, size);
+    }
+
+    void UniformWriter::write(NameHash memberHash, ProgramReflection::BaseType baseType, uint32_t columns, uint32_t rows,
+        const void* values, uint32_t count, uint32_t firstIndex) {
+        if (!valid()) {
+            throw std::logic_error("UniformWriter has no block");
+        }
+
+        const ProgramReflection::Uniform* member = m_layout->findMember(memberHash);
+        if (!member) {
+            throw std::invalid_argument("Uniform block '" + m_layout->name + "' has no such member");
+        }
+        if (!isCompatible(member->baseType, baseType) || member->columns != columns || member->rows != rows) {
+            throw std::invalid_argument("Uniform '" + member->name + "' is " + describeType(*member) + " and cannot be set with this type");
+        }
+        if (firstIndex + count > member->arraySize) {
+            throw std::invalid_argument("Uniform '" + member->name + "' has only " + std::to_string(member->arraySize) + " elements");
+        }
+
+        // Origen compacto (como glm); destino con los strides del layout
+        const uint32_t component = 4;
+        const auto* source = static_cast<const uint8_t*>(values);
+        for (uint32_t element = 0; element < count; ++element) {
+            uint8_t* destination = static_cast<uint8_t*>(m_data) + member->offset + (firstIndex + element) * member->arrayStride;
+            for (uint32_t column = 0; column < columns; ++column) {
+                if (member->rowMajor) {
+                    for (uint32_t row = 0; row < rows; ++row) {
+                        std::memcpy(destination + row * member->matrixStride + column * component, source + row * component, component);
+                    }
+                }
+                else {
+                    std::memcpy(destination + column * member->matrixStride, source, rows * component);
+                }
+                source += rows * component;
+            }
+        }
+    }
+
+} // namespace pgrender
@@ -0,0 +1,107 @@
+#include "PGRenderCore/uniformStager.h"
+#include "PGRenderCore/context.h"
+#include <stdexcept>
+#include <algorithm>
+#include <cstring>
+
+namespace pgrender {
+
+    namespace {
+
+        size_t alignUp(size_t value, size_t alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+    } // namespace
+
+    UniformStager::UniformStager(Context& context, const Desc& desc)
+        : m_context(context), m_desc(desc)
+    {
+        if (desc.frameCapacity == 0 || desc.framesInFlight == 0) {
+            throw std::invalid_argument("UniformStager needs a non-zero capacity and frame count");
+        }
+
+        // Cada región empieza alineada para que los offsets relativos basten
+        m_alignment = std::max<size_t>(context.getUniformBufferOffsetAlignment(), 1);
+        m_desc.frameCapacity = alignUp(desc.frameCapacity, m_alignment);
+        m_staging.resize(m_desc.frameCapacity);
+
+        BufferObject::Desc bufferDesc;
+        bufferDesc.type = BufferType::Uniform;
+        bufferDesc.usage = BufferUsage::Stream;
+        bufferDesc.size = m_desc.frameCapacity * m_desc.framesInFlight;
+        bufferDesc.debugName = desc.debugName;
+        m_buffer = context.createBufferObject(bufferDesc);
+    }
+
+    void UniformStager::beginFrame() {
+        m_frame = (m_frame + 1) % m_desc.framesInFlight;
+        m_cursor = 0;
+        m_uploaded = 0;
+        m_statistics = Statistics();
+    }
+
+    UniformStager::Allocation UniformStager::allocate(const ProgramReflection::Block& layout) {
+        if (layout.dataSize == 0) {
+            throw std::invalid_argument("Uniform block '" + layout.name + "' has no fixed size");
+        }
+
+        const size_t offset = reserve(layout.dataSize);
+        std::memset(m_staging.data() + offset, 0, layout.dataSize);
+
+        Allocation allocation;
+        allocation.writer = UniformWriter(layout, m_staging.data() + offset);
+        allocation.offset = frameBase() + offset;
+        allocation.size = layout.dataSize;
+        return allocation;
+    }
+
+    UniformStager::Allocation UniformStager::push(const void* data, size_t size) {
+        if (size == 0) {
+            throw std::invalid_argument("Cannot push an empty uniform block");
+        }
+
+        const size_t offset = reserve(size);
+        std::memcpy(m_staging.data() + offset, data, size);
+
+        Allocation allocation;
+        allocation.offset = frameBase() + offset;
+        allocation.size = size;
+        return allocation;
+    }
+
+    void UniformStager::upload() {
+        if (m_cursor == m_uploaded) {
+            return;
+        }
+        m_buffer->update(m_staging.data() + m_uploaded, m_cursor - m_uploaded, frameBase() + m_uploaded);
+        m_uploaded = m_cursor;
+        ++m_statistics.uploads;
+    }
+
+    void UniformStager::bind(uint32_t firstBinding, std::span<const Allocation> allocations) {
+        upload();
+
+        m_ranges.clear();
+        for (const auto& allocation : allocations) {
+            m_ranges.push_back({ m_buffer, allocation.offset, allocation.size });
+        }
+        m_context.bindUniformBuffers(firstBinding, m_ranges);
+        ++m_statistics.bindCalls;
+    }
+
+    size_t UniformStager::reserve(size_t size) {
+        const size_t offset = alignUp(m_cursor, m_alignment);
+        if (offset + size > m_desc.frameCapacity) {
+            throw std::runtime_error("UniformStager frame capacity exceeded (" +
+                std::to_string(m_desc.frameCapacity) + " bytes)");
+        }
+
+        // El relleno de alineación se sube junto con los bloques: un único tramo contiguo
+        m_cursor = offset + size;
+        ++m_statistics.blocks;
+        m_statistics.bytes = m_cursor;
+        return offset;
+    }
+
+} // namespace pgrender
@@ -1,14 +1,20 @@
 #pragma once
 #include <PGRenderCore/bufferObject.h>
+#include <PGRenderCoreGL/deferredReleaseGL.h>
 #include <cstdint>
 
 namespace pgrender {
 
-    using BufferHandle = uint32_t;
+    // Nombre del objeto buffer de OpenGL
+    using BufferNameGL = uint32_t;
 
     class BufferObjectGL : public BufferObject {
     public:
-        explicit BufferObjectGL(const BufferObject::Desc& desc);
+        /**
+         * @param deferredRelease Cola del contexto donde se entrega el buffer GL al destruirlo o
+         * recrearlo; vacía para borrarlo en el acto.
+         */
+        explicit BufferObjectGL(const BufferObject::Desc& desc, std::weak_ptr<DeferredReleaseGL> deferredRelease = {});
         ~BufferObjectGL() override;
 
         BackendType getBackendType() const override { return BackendType::OpenGL; }
@@ -27,16 +33,17 @@ namespace pgrender {
             size_t size) override;
         void resize(size_t newSize, const void* data = nullptr) override;
 
-        BufferHandle nativeBufferId() const { return m_bufferId; }
+        BufferNameGL nativeBufferId() const { return m_bufferId; }
 
     private:
         BufferObject::Desc m_desc;
-        BufferHandle m_bufferId;
+        BufferNameGL m_bufferId;
         size_t m_size;
         bool m_isMapped;
+        std::weak_ptr<DeferredReleaseGL> m_deferredRelease;
 
-        unsigned int toGLTarget() const;
-        unsigned int toGLUsage() const;
+        void createStorage(const void* data);
+        unsigned int toGLStorageFlags() const;
         unsigned int toGLAccessFlags(BufferAccessFlags flags) const;
     };
 
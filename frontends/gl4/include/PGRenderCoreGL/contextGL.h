@@ -2,8 +2,18 @@
 #include <pgrender/types.h>
 
 #include <PGRenderCore/Context.h>
-#include <unordered_map>
+#include <PGRenderCore/handlePool.h>
+#include <PGRenderCoreGL/bufferObjectGL.h>
+#include <PGRenderCoreGL/textureGL.h>
+#include <PGRenderCoreGL/samplerGL.h>
+#include <PGRenderCoreGL/programPipelineCacheGL.h>
+#include <PGRenderCoreGL/shaderObjectCacheGL.h>
+#include <PGRenderCoreGL/deferredReleaseGL.h>
+#include <memory>
+#include <array>
+#include <vector>
 #include <cstdint>
+#include <cstddef>
 
 namespace pgrender {
 
@@ -25,6 +35,7 @@ namespace pgrender {
 
         void makeCurrent() override;
         void swapBuffers() override;
+        void endFrame() override;
 
         // Fbricas
         std::shared_ptr<BufferObject> createBufferObject(const BufferObject::Desc& desc) override;
@@ -45,6 +56,8 @@ namespace pgrender {
 
         void bindTexture(const std::shared_ptr<Texture>& texture, uint32_t slot = 0) override;
         void bindSampler(const std::shared_ptr<Sampler>& sampler, uint32_t slot = 0) override;
+        void bindTextures(uint32_t firstSlot, std::span<const std::shared_ptr<Texture>> textures) override;
+        void bindSamplers(uint32_t firstSlot, std::span<const std::shared_ptr<Sampler>> samplers) override;
 
         void bindUniformBuffer(const std::shared_ptr<BufferObject>& buffer,
             uint32_t binding,
@@ -56,8 +69,27 @@ namespace pgrender {
             size_t offset = 0,
             size_t size = 0) override;
 
-        std::shared_ptr<BufferObject> getBoundUniformBuffer(uint32_t binding) const override;
-        std::shared_ptr<BufferObject> getBoundShaderStorageBuffer(uint32_t binding) const override;
+        BufferObject* getBoundUniformBuffer(uint32_t binding) const override;
+        BufferObject* getBoundShaderStorageBuffer(uint32_t binding) const override;
+
+        void bindUniformBuffers(uint32_t firstBinding, std::span<const BufferRange> ranges) override;
+        void bindShaderStorageBuffers(uint32_t firstBinding, std::span<const BufferRange> ranges) override;
+        size_t getUniformBufferOffsetAlignment() const override { return m_uniformBufferOffsetAlignment; }
+
+        // Recursos por handle
+        BufferHandle createBufferHandle(const BufferObject::Desc& desc) override;
+        TextureHandle createTextureHandle(const Texture::Desc& desc) override;
+        SamplerHandle createSamplerHandle(const Sampler::Desc& desc) override;
+        bool destroy(BufferHandle buffer) override;
+        bool destroy(TextureHandle texture) override;
+        bool destroy(SamplerHandle sampler) override;
+        BufferObject* getBuffer(BufferHandle buffer) const override;
+        Texture* getTexture(TextureHandle texture) const override;
+        Sampler* getSampler(SamplerHandle sampler) const override;
+        void bindTextures(uint32_t firstSlot, std::span<const TextureHandle> textures) override;
+        void bindSamplers(uint32_t firstSlot, std::span<const SamplerHandle> samplers) override;
+        void bindUniformBuffers(uint32_t firstBinding, std::span<const BufferHandleRange> ranges) override;
+        void bindShaderStorageBuffers(uint32_t firstBinding, std::span<const BufferHandleRange> ranges) override;
 
         // Limpieza
         void clear(ClearFlags flags,
@@ -77,6 +109,39 @@ namespace pgrender {
         void drawIndexedInstanced(uint32_t indexCount, uint32_t instanceCount,
             uint32_t firstIndex = 0, int32_t vertexOffset = 0,
             uint32_t firstInstance = 0) override;
+        void drawIndexedIndirect(const std::shared_ptr<BufferObject>& buffer,
+            size_t offset,
+            uint32_t drawCount,
+            uint32_t stride = 0) override;
+        void drawIndexedIndirectCount(const std::shared_ptr<BufferObject>& buffer,
+            size_t offset,
+            const std::shared_ptr<BufferObject>& countBuffer,
+            size_t countOffset,
+            uint32_t maxDrawCount,
+            uint32_t stride = 0) override;
+
+        // Compute
+        void dispatch(uint32_t groupsX, uint32_t groupsY = 1, uint32_t groupsZ = 1) override;
+        void dispatchIndirect(const std::shared_ptr<BufferObject>& buffer, size_t offset = 0) override;
+        void bindImage(const std::shared_ptr<Texture>& texture,
+            uint32_t unit,
+            ImageAccess access,
+            uint32_t mipLevel = 0,
+            int32_t layer = -1) override;
+        void memoryBarrier(BarrierFlags flags) override;
+
+        // Texturas bindless
+        bool isBindlessTextureSupported() const override;
+
+        // Texturas dispersas
+        bool isSparseTextureSupported() const override;
+
+        // Shaders
+        bool isSpirvSupported() const override;
+
+        // Formatos
+        bool isFormatSupported(Texture::Format format) const override;
+        FormatFeatures getFormatFeatures(Texture::Format format) const override;
 
         // Ray Tracing
         bool isRayTracingSupported() const override;
@@ -89,7 +154,7 @@ namespace pgrender {
         //void bindAccelerationStructure(
         //    const std::shared_ptr<AccelerationStructure>& tlas,
         //    uint32_t binding) override;
-        //std::shared_ptr<AccelerationStructure> getBoundAccelerationStructure(
+        //AccelerationStructure* getBoundAccelerationStructure(
         //    uint32_t binding) const override;
         //void traceRays(const TraceRaysDesc& desc) override;
         void buildAccelerationStructure(
@@ -109,21 +174,94 @@ namespace pgrender {
         void* getNativeContext() const { return m_glContext; }
 
     private:
+        /**
+         * @brief Recurso vinculado a una unidad o binding. No es propietario: cuando el recurso
+         * entrega su objeto GL a m_deferredRelease, invalidateBindings() anula el puntero.
+         * Guarda tambin el nombre GL, que cambia si el recurso se recrea (p.ej. BufferObject::resize).
+         */
+        template <typename T>
+        struct BindingSlot {
+            const T* resource = nullptr;
+            uint32_t name = 0;
+            size_t offset = 0;
+            size_t size = 0;
+
+            bool operator==(const BindingSlot& other) const = default;
+        };
+
+        // GL_NV_ray_tracing no expone un lmite consultable de bindings
+        static constexpr uint32_t kMaxAccelerationStructureBindings = 16;
+
+        // Binds mltiples comunes a las variantes con shared_ptr y con handle: resolve(i)
+        // devuelve el recurso GL (o nullptr) del elemento i, ya validado
+        template <typename Resolve>
+        void bindTextureUnits(uint32_t firstSlot, size_t count, Resolve&& resolve);
+        template <typename Resolve>
+        void bindSamplerUnits(uint32_t firstSlot, size_t count, Resolve&& resolve);
+        template <typename Resolve>
+        void bindBufferRanges(unsigned int target, std::vector<BindingSlot<BufferObject>>& slots,
+            uint32_t firstBinding, size_t count, Resolve&& resolve);
+        void invalidateBindings(DeferredReleaseGL::ObjectType type, uint32_t name);
+
         void* m_nativeWindowHandle;     // Platform-specific window handle
         void* m_nativeDisplayHandle;    // Platform-specific display handle (X11, Wayland)
         void* m_glContext;              // OpenGL context (HGLRC, GLXContext, EGLContext, etc.)
         uint32_t m_vao;
 
-        // Estado de binding
+        // Estado de binding. Las tablas se dimensionan una vez con los lmites del driver
+        // (GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, GL_MAX_*_BUFFER_BINDINGS)
         std::shared_ptr<VertexArray> m_boundVertexArray;
         std::shared_ptr<Pipeline> m_boundPipeline;
-        std::unordered_map<uint32_t, std::shared_ptr<BufferObject>> m_boundUniformBuffers;
-        std::unordered_map<uint32_t, std::shared_ptr<BufferObject>> m_boundShaderStorageBuffers;
+        std::vector<BindingSlot<Texture>> m_boundTextures;
+        std::vector<BindingSlot<Sampler>> m_boundSamplers;
+        std::vector<BindingSlot<BufferObject>> m_boundUniformBuffers;
+        std::vector<BindingSlot<BufferObject>> m_boundShaderStorageBuffers;
+
+        // Memoria temporal de las llamadas multi-bind, del tamao de la tabla mayor
+        std::vector<uint32_t> m_bindNames;
+        std::vector<std::ptrdiff_t> m_bindOffsets;
+        std::vector<std::ptrdiff_t> m_bindSizes;
+
+        // Objetos GL de recursos destruidos, pendientes de que la GPU deje de usarlos
+        std::shared_ptr<DeferredReleaseGL> m_deferredRelease;
+
+        // Recursos creados por handle, guardados por valor
+        HandlePool<BufferHandle, BufferObjectGL> m_bufferPool;
+        HandlePool<TextureHandle, TextureGL> m_texturePool;
+        HandlePool<SamplerHandle, SamplerGL> m_samplerPool;
+
+        // Program pipelines de los pipelines con programas separables
+        std::unique_ptr<ProgramPipelineCacheGL> m_programPipelineCache;
+
+        // Shader objects compartidos entre programas con etapas idnticas
+        std::unique_ptr<ShaderObjectCacheGL> m_shaderObjectCache;
+
+        // Capacidades opcionales
+        bool m_bindlessTextureSupported;
+        bool m_indirectCountSupported;
+        bool m_sparseTextureSupported;
+        bool m_spirvSupported = false;
+
+        // Lmites
+        size_t m_uniformBufferOffsetAlignment = 256;
+
+        // Familias de compresin por bloques (RGTC es core desde GL 3.0)
+        bool m_s3tcSupported = false;
+        bool m_bptcSupported = false;
+        bool m_etc2Supported = false;
+        bool m_astcSupported = false;
+
+        // Usos soportados por formato, consultados al inicializar
+        std::array<FormatFeatures, kFormatCount> m_formatFeatures{};
+        void queryFormatFeatures();
+
+        // Lmites de compute
+        uint32_t m_maxComputeWorkGroupCount[3] = { 0, 0, 0 };
 
         // Ray tracing
         bool m_rayTracingSupported;
 //        std::shared_ptr<RayTracingPipeline> m_boundRayTracingPipeline;
-        std::unordered_map<uint32_t, std::shared_ptr<AccelerationStructure>> m_boundAccelerationStructures;
+        std::vector<BindingSlot<AccelerationStructure>> m_boundAccelerationStructures;
 
         // Clear values
         float m_clearColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
@@ -133,6 +271,8 @@ namespace pgrender {
         // Platform-specific initialization
         void initializeGLContext(const Context::Desc& desc);
         void cleanupGLContext();
+
+        void bindIndirectBuffer(const std::shared_ptr<BufferObject>& buffer, size_t offset, size_t commandSize, uint32_t drawCount, uint32_t stride);
     };
 
 } // namespace pgrender
@@ -0,0 +1,94 @@
+#pragma once
+#include <PGRenderCore/deferredReleaseQueue.h>
+#include <functional>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    /**
+     * @brief Borrado diferido de objetos GL hasta que la GPU termina los comandos que los usan.
+     *
+     * Los buffers, texturas y samplers creados por el contexto no borran su objeto GL al
+     * destruirse: lo entregan aquí. Los lotes y su orden los gestiona DeferredReleaseQueue;
+     * esta clase aporta los fences (glFenceSync) y el borrado de cada tipo de objeto GL.
+     * Mientras tanto el nombre GL no se recicla, de modo que el estado de binding
+     * del contexto puede guardar punteros y nombres no propietarios: el callback de liberación
+     * se invoca al entregar el objeto para que el contexto invalide los bindings que lo usan.
+     */
+    class DeferredReleaseGL : private DeferredReleaseQueue::Backend {
+    public:
+        enum class ObjectType {
+            Buffer,
+            Texture,
+            Sampler
+        };
+
+        using ReleaseCallback = std::function<void(ObjectType type, uint32_t name)>;
+
+        /**
+         * @brief Objetos que se acumulan sin fence antes de cerrar el lote aunque nadie
+         * llame a endFrame().
+         */
+        static constexpr size_t kMaxBatchSize = DeferredReleaseQueue::kMaxBatchSize;
+
+        DeferredReleaseGL() = default;
+
+        /**
+         * @brief Borra todos los objetos pendientes (requiere el contexto GL activo).
+         */
+        ~DeferredReleaseGL() override;
+
+        DeferredReleaseGL(const DeferredReleaseGL&) = delete;
+        DeferredReleaseGL& operator=(const DeferredReleaseGL&) = delete;
+
+        void setReleaseCallback(ReleaseCallback callback) { m_onRelease = std::move(callback); }
+
+        /**
+         * @brief Entrega un objeto GL que ya no usa ningún recurso; se borra cuando la GPU
+         * termine los comandos enviados hasta el siguiente endFrame().
+         */
+        void release(ObjectType type, uint32_t name);
+
+        /**
+         * @brief Entrega el objeto a la cola si aún existe; si el contexto ya se destruyó
+         * lo borra en el acto. Es lo que usan los destructores de los recursos.
+         */
+        static void release(const std::weak_ptr<DeferredReleaseGL>& queue, ObjectType type, uint32_t name);
+
+        /**
+         * @brief Cierra el lote del frame con un fence y borra los lotes ya completados.
+         */
+        void endFrame() { m_queue.endFrame(); }
+
+        /**
+         * @brief Borra, sin esperar, los lotes cuyo fence se ha señalizado.
+         */
+        void collect() { m_queue.collect(); }
+
+        /**
+         * @brief Espera a la GPU y borra todo lo pendiente.
+         */
+        void flush() { m_queue.flush(); }
+
+        /**
+         * @brief Objetos entregados que aún no se han borrado.
+         */
+        size_t getPendingCount() const { return m_queue.getPendingCount(); }
+
+    private:
+        DeferredReleaseQueue m_queue{ *this };
+        ReleaseCallback m_onRelease;
+
+        // DeferredReleaseQueue::Backend; los fences son GLsync
+        void* insertFence() override;
+        bool isFenceSignaled(void* fence) override;
+        void deleteFence(void* fence) override;
+        void waitIdle() override;
+        void destroy(uint32_t type, uint32_t name) override;
+
+        static void destroyObject(ObjectType type, uint32_t name);
+    };
+
+} // namespace pgrender
@@ -2,12 +2,18 @@
 #include <PGRenderCore/Pipeline.h>
 #include <PGRenderCore/stateConstants.h>
 
+#include <PGRenderCoreGL/programPipelineCacheGL.h>
+
 #include <cstdint>
 
 namespace pgrender {
     class PipelineGL : public Pipeline {
     public:
-        explicit PipelineGL(const Pipeline::Desc& desc);
+        /**
+         * @param programPipelines Caché del contexto para los pipelines con stagePrograms.
+         * @throws std::invalid_argument si se indican program y stagePrograms a la vez.
+         */
+        PipelineGL(const Pipeline::Desc& desc, ProgramPipelineCacheGL& programPipelines);
         ~PipelineGL() override;
 
         BackendType getBackendType() const override { return BackendType::OpenGL; }
@@ -17,8 +23,18 @@ namespace pgrender {
         friend class ContextGL;  // Para que ContextGL pueda llamar a apply()
 
         Pipeline::Desc m_desc;
+        ProgramPipelineCacheGL& m_programPipelines;
+
+        // Program pipeline resuelto y la clave con la que se resolvió (cambia al recompilar)
+        mutable unsigned int m_programPipeline = 0;
+        mutable ProgramPipelineCacheGL::Key m_programPipelineKey{};
+        // Programa vinculado en el último apply() (cambia si se recarga con Program::adopt)
+        mutable unsigned long m_appliedProgram = 0;
 
         void apply() const;
+        bool isUpToDate() const;
+        bool isComputeOnly() const;
+        const Program* findStageProgram(ShaderStage stage) const;
         void applyBlendMode() const;
         void applyDepthState() const;
         void applyCullMode() const;
@@ -0,0 +1,69 @@
+#pragma once
+#include <PGRenderCore/shader.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    /**
+     * @brief Caché de program pipelines de OpenGL (glCreateProgramPipelines) que combinan
+     * programas separables (Program::Desc::separable).
+     *
+     * La clave es el número de enlace de cada programa por etapa (ShaderGL::getLinkSerial), que
+     * no se reutiliza aunque GL recicle el nombre del programa; así un programa recompilado
+     * produce una clave nueva. Las entradas cuyos programas se destruyeron o recompilaron se
+     * eliminan al crear entradas nuevas.
+     */
+    class ProgramPipelineCacheGL {
+    public:
+        /// Vertex, TessControl, TessEvaluation, Geometry, Fragment, Compute
+        static constexpr size_t kStageSlots = 6;
+        using Key = std::array<uint64_t, kStageSlots>;
+
+        ProgramPipelineCacheGL() = default;
+        ~ProgramPipelineCacheGL();
+
+        ProgramPipelineCacheGL(const ProgramPipelineCacheGL&) = delete;
+        ProgramPipelineCacheGL& operator=(const ProgramPipelineCacheGL&) = delete;
+
+        /**
+         * @brief Devuelve (creándolo si hace falta) el program pipeline de los programas dados.
+         * @throws std::invalid_argument si un programa no es separable o dos aportan la misma etapa.
+         * @throws std::runtime_error si algún programa no está compilado.
+         */
+        unsigned int acquire(const std::vector<std::shared_ptr<Program>>& programs);
+
+        /**
+         * @brief Clave de los programas con su número de enlace actual.
+         * @throws Las mismas excepciones que acquire.
+         */
+        static Key makeKey(const std::vector<std::shared_ptr<Program>>& programs);
+
+        /**
+         * @brief Elimina todas las entradas (requiere el contexto GL activo).
+         */
+        void clear();
+
+        size_t size() const { return m_entries.size(); }
+
+    private:
+        struct KeyHash {
+            size_t operator()(const Key& key) const;
+        };
+
+        struct Entry {
+            unsigned int pipeline = 0;
+            std::vector<std::weak_ptr<Program>> programs;
+        };
+
+        std::unordered_map<Key, Entry, KeyHash> m_entries;
+
+        void removeStale();
+    };
+
+} // namespace pgrender
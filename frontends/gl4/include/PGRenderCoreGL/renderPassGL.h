@@ -1,6 +1,7 @@
 #pragma once
 #include <PGRenderCore/renderPass.h>
 #include <cstdint>
+#include <vector>
 #include <PGRenderCore/backendType.h>
 
 namespace pgrender {
@@ -21,6 +22,21 @@ namespace pgrender {
     private:
         RenderPass::Desc m_desc;
         bool m_isActive = false;
+
+        unsigned int framebufferId() const;
+        uint32_t colorAttachmentCount() const;
+        bool hasDepthAttachment() const;
+        bool hasStencilAttachment() const;
+        const ColorAttachmentOps& colorOps(uint32_t index) const;
+
+        // Attachments (enums GL) afectados por una acción de carga/almacenamiento concreta
+        std::vector<unsigned int> collectAttachments(LoadAction action) const;
+        std::vector<unsigned int> collectAttachments(StoreAction action) const;
+        unsigned int colorAttachmentEnum(uint32_t index) const;
+
+        void applyLoadActions() const;
+        void resolveAttachments() const;
+        void applyStoreActions() const;
     };
 
 } // namespace pgrender
@@ -1,5 +1,6 @@
 #pragma once
 #include <PGRenderCore/renderTarget.h>
+#include <PGRenderCore/texture.h>
 #include <vector>
 #include <memory>
 #include <cstdint>
@@ -16,13 +17,34 @@ namespace pgrender {
         ~RenderTargetGL() override;
 
         std::shared_ptr<Texture> getColorAttachment(uint32_t index) const override;
+        uint32_t getColorAttachmentCount() const override { return static_cast<uint32_t>(m_colorAttachments.size()); }
         std::shared_ptr<Texture> getDepthStencilAttachment() const override;
 
         uint32_t getWidth() const override { return m_width; }
         uint32_t getHeight() const override { return m_height; }
+        uint32_t getSampleCount() const override { return m_desc.sampleCount; }
+
+        void resolve(const std::shared_ptr<RenderTarget>& destination, bool includeDepthStencil = false) override;
+
+        /**
+         * @brief Resuelve un único attachment de color sobre el mismo slot del destino.
+         * @param destination Render target destino (nullptr = framebuffer por defecto).
+         */
+        void resolveColorAttachment(uint32_t index, const RenderTarget* destination) const;
+
+        /**
+         * @brief Resuelve profundidad y/o stencil sobre el destino (nullptr = framebuffer por defecto).
+         */
+        void resolveDepthStencil(bool depth, bool stencil, const RenderTarget* destination) const;
 
         uint64_t nativeHandle() const override { return static_cast<uint64_t>(m_fboId); }
 
+        /**
+         * @brief Vuelve a adjuntar las texturas cuyo almacenamiento se ha reasignado
+         * (Texture::setResidentBaseLevel). Se llama antes de usar el framebuffer.
+         */
+        void refreshAttachments() const;
+
 		BackendType getBackendType() const override { return BackendType::OpenGL; }
 
     private:
@@ -32,10 +54,19 @@ namespace pgrender {
         uint32_t m_height = 0;
 
         void checkFramebufferStatus() const;
+        void validateAttachment(const std::shared_ptr<Texture>& texture) const;
+        void attachTexture(unsigned int attachment, const TextureGL& texture) const;
+        static uint32_t layerCount(const Texture::Desc& desc);
+        void blitTo(const RenderTarget* destination, unsigned int mask) const;
 
         // Mantener copias para retornar en getters
         std::vector<std::shared_ptr<Texture>> m_colorAttachments;
         std::shared_ptr<Texture> m_depthStencilAttachment;
+
+        // Nombres GL adjuntados al FBO, para detectar reasignaciones de las texturas
+        mutable std::vector<uint32_t> m_attachedColorNames;
+        mutable uint32_t m_attachedDepthStencilName = 0;
+        unsigned int m_depthStencilAttachPoint = 0;
     };
 
 } // namespace pgrender
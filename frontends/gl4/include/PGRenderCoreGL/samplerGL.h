@@ -1,25 +1,34 @@
 #pragma once
 #include <PGRenderCore/sampler.h>
+#include <PGRenderCoreGL/deferredReleaseGL.h>
 #include <cstdint>
 
 namespace pgrender {
 
     // Alias opaco para identificador OpenGL de sampler
-    using SamplerHandle = uint32_t;
+    using SamplerNameGL = uint32_t;
 
     class SamplerGL : public Sampler {
     public:
-        explicit SamplerGL(const Desc& desc);
+        explicit SamplerGL(const Desc& desc, std::weak_ptr<DeferredReleaseGL> deferredRelease = {});
         ~SamplerGL() override;
 
         const Desc& getDesc() const override { return m_desc; }
         uint64_t nativeHandle() const override { return static_cast<uint64_t>(m_samplerId); }
 
-        SamplerHandle nativeSamplerId() const { return m_samplerId; }
+        SamplerNameGL nativeSamplerId() const { return m_samplerId; }
+
+        /**
+         * @brief Identificador nico del sampler durante toda la ejecucin (nunca 0 ni reutilizado,
+         * a diferencia del nombre GL).
+         */
+        uint64_t uniqueId() const { return m_uniqueId; }
 		BackendType getBackendType() const override { return BackendType::OpenGL; }
     private:
         Desc m_desc;
-        SamplerHandle m_samplerId;
+        SamplerNameGL m_samplerId;
+        uint64_t m_uniqueId;
+        std::weak_ptr<DeferredReleaseGL> m_deferredRelease;
 
         // Helpers para conversin a enums OpenGL. Implementados en .cpp
         unsigned int toGLFilterMode(FilterMode mode) const;
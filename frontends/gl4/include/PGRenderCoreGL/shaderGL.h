@@ -1,34 +1,81 @@
 #pragma once
 #include <PGRenderCore/shader.h>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 namespace pgrender {
 
+    class ShaderObjectCacheGL;
+    class CachedShaderGL;
+
     class ShaderGL : public Program {
     public:
-        explicit ShaderGL(const Program::Desc& desc);
+        /**
+         * @param shaderCache Caché de shader objects compartida (opcional). Sin ella cada
+         * programa compila y borra sus propias etapas.
+         */
+        explicit ShaderGL(const Program::Desc& desc, ShaderObjectCacheGL* shaderCache = nullptr);
         ~ShaderGL() override;
 
         bool compile() override;
+        bool beginCompile() override;
+        CompileStatus pollCompileStatus() override;
+        CompileStatus getCompileStatus() const override { return m_compileStatus; }
         void release() override;
 
 		BackendType getBackendType() const override { return BackendType::OpenGL; }
 
-        std::string getLastError() const;
+        std::string getLastError() const override;
+        void adopt(Program& other) override;
         unsigned long nativeHandle() const override;
         const Program::Desc& getDesc() const override;
 
+        /**
+         * @brief Número único del último enlace correcto (0 si no está enlazado).
+         * A diferencia del nombre GL, no se reutiliza al recompilar o destruir programas.
+         */
+        uint64_t getLinkSerial() const { return m_linkSerial; }
+
+        const ProgramReflection& getReflection() const override { return m_reflection; }
+
+        void setUniform(int32_t location, float value) override;
+        void setUniform(int32_t location, int32_t value) override;
+        void setUniform(int32_t location, uint32_t value) override;
+        void setUniform(int32_t location, const glm::vec2& value) override;
+        void setUniform(int32_t location, const glm::vec3& value) override;
+        void setUniform(int32_t location, const glm::vec4& value) override;
+        void setUniform(int32_t location, const glm::mat3& value) override;
+        void setUniform(int32_t location, const glm::mat4& value) override;
+        void setUniform(int32_t location, const glm::vec4* values, uint32_t count) override;
+        void setUniform(int32_t location, const glm::mat4* values, uint32_t count) override;
+
     private:
+        struct AttachedShader {
+            unsigned int shader = 0;    // GLuint equiv.
+            uint64_t cacheKey = 0;
+            std::shared_ptr<CachedShaderGL> cached;    ///< Etapa de m_shaderCache: sólo se desadjunta
+        };
+
         Program::Desc m_desc;
         unsigned long m_programId = 0;
-        std::unordered_map<unsigned int, unsigned int> m_shaderObjects; // GLuint equiv.
+        ShaderObjectCacheGL* m_shaderCache = nullptr;
+        std::unordered_map<unsigned int, AttachedShader> m_shaderObjects;
+        std::vector<std::shared_ptr<CachedShaderGL>> m_cachedStages;   ///< Etapas de la caché usadas por el programa enlazado
         std::string m_lastError;
+        ProgramReflection m_reflection;
+        CompileStatus m_compileStatus = CompileStatus::NotCompiled;
+        uint64_t m_linkSerial = 0;
 
         unsigned int shaderTypeToGL(ShaderStage stage) const;
-        bool compileShaderStage(unsigned int shaderType, const std::string& source, unsigned int& outShader);
+        bool createShaderStage(unsigned int shaderType, const ShaderSource& stageSource, unsigned int& outShader);
+        bool acquireShaderStage(unsigned int shaderType, const ShaderSource& stageSource, AttachedShader& outShader);
+        bool checkShaderStage(unsigned int shader);
+        bool finishCompile();
+        bool fail();
         void detachAndDeleteShaders();
+        void captureReflection();
     };
 
 } // namespace pgrender
@@ -0,0 +1,81 @@
+#pragma once
+#include <PGRenderCore/shader.h>
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+namespace pgrender {
+
+    /**
+     * @brief Shader object compartido entre programas; se borra al soltarlo el último.
+     */
+    class CachedShaderGL {
+    public:
+        CachedShaderGL(const ShaderSource& source, unsigned int shader) : m_source(source), m_shader(shader) {}
+        ~CachedShaderGL();
+
+        CachedShaderGL(const CachedShaderGL&) = delete;
+        CachedShaderGL& operator=(const CachedShaderGL&) = delete;
+
+        const ShaderSource& getSource() const { return m_source; }
+        unsigned int getShader() const { return m_shader; }
+
+    private:
+        ShaderSource m_source;      ///< Para distinguir las colisiones de hash
+        unsigned int m_shader;      // GLuint equiv.
+    };
+
+    /**
+     * @brief Caché de shader objects de OpenGL indexada por ShaderSource::contentHash.
+     *
+     * Las etapas idénticas (misma fuente expandida, o mismo módulo SPIR-V con las mismas
+     * constantes) se compilan una sola vez y se adjuntan a todos los programas que las usan.
+     * Cada programa mantiene una referencia a sus etapas mientras está enlazado y la caché
+     * sólo guarda referencias débiles: al liberar o recompilar el último programa que usa una
+     * etapa se borra su shader object. Una coincidencia de hash sólo se da por buena si la
+     * etapa guardada es igual a la pedida. Una etapa que no compila se expulsa para
+     * reintentarla con la fuente corregida.
+     */
+    class ShaderObjectCacheGL {
+    public:
+        ShaderObjectCacheGL() = default;
+
+        ShaderObjectCacheGL(const ShaderObjectCacheGL&) = delete;
+        ShaderObjectCacheGL& operator=(const ShaderObjectCacheGL&) = delete;
+
+        /**
+         * @brief Etapa compilada igual a source, o nullptr si no está en la caché.
+         */
+        std::shared_ptr<CachedShaderGL> find(uint64_t key, const ShaderSource& source);
+
+        /**
+         * @brief Toma posesión de un shader object recién creado y lo registra con la clave.
+         * Si la clave ya la ocupa otra etapa viva (colisión de hash) no se registra, pero el
+         * resultado sigue siendo propietario del shader object.
+         */
+        std::shared_ptr<CachedShaderGL> insert(uint64_t key, const ShaderSource& source, unsigned int shader);
+
+        /**
+         * @brief Quita la etapa de la caché; los programas que ya la tienen la conservan.
+         */
+        void evict(uint64_t key, const CachedShaderGL& stage);
+
+        /**
+         * @brief Olvida todas las etapas; las que sigan usando programas vivos se borran con ellos.
+         */
+        void clear() { m_stages.clear(); }
+
+        /**
+         * @brief Etapas registradas, incluidas las ya borradas que aún no se han purgado.
+         */
+        size_t size() const { return m_stages.size(); }
+
+    private:
+        std::unordered_map<uint64_t, std::weak_ptr<CachedShaderGL>> m_stages;
+        size_t m_pruneThreshold = 64;
+
+        void pruneExpired();
+    };
+
+} // namespace pgrender
@@ -1,35 +1,98 @@
 #pragma once
 #include <PGRenderCore/texture.h>
+#include <PGRenderCoreGL/deferredReleaseGL.h>
 #include <cstdint>
+#include <memory>
+#include <vector>
 #include <PGRenderCore/backendType.h>
 
 namespace pgrender {
 
     // Alias opaco para el identificador de textura OpenGL
-    using TextureHandle = uint32_t;
+    using TextureNameGL = uint32_t;
 
     class TextureGL : public Texture {
     public:
-        explicit TextureGL(const Desc& desc);
+        explicit TextureGL(const Desc& desc, std::weak_ptr<DeferredReleaseGL> deferredRelease = {});
         ~TextureGL() override;
 
         void update(const void* pixelData, size_t dataSize, uint32_t mipLevel = 0, uint32_t arrayLayer = 0) override;
+        void updateRegion(const Region& region, const void* pixelData, size_t dataSize) override;
+
+        void setResidentBaseLevel(uint32_t baseLevel) override;
+        uint32_t getResidentBaseLevel() const override { return m_residentBaseLevel; }
+        void setLodBias(float bias) override;
+        void generateMipmaps() override;
+
+        void commitRegion(const Region& region, bool commit) override;
+        PageSize getSparsePageSize() const override { return m_sparsePageSize; }
+        uint32_t getSparseMipTailStart() const override { return m_sparseMipTailStart; }
+
+        uint64_t getBindlessHandle(const std::shared_ptr<Sampler>& sampler = nullptr) override;
+        void setBindlessHandleResident(uint64_t handle, bool resident) override;
+        bool hasBindlessHandles() const override { return m_hasBindlessHandles; }
 
         const Desc& getDesc() const override { return m_desc; }
         uint64_t nativeHandle() const override { return static_cast<uint64_t>(m_textureId); }
 
-        TextureHandle nativeTextureId() const { return m_textureId; }
+        TextureNameGL nativeTextureId() const { return m_textureId; }
+
+        /**
+         * @brief Nivel MIP lgico almacenado en el nivel 0 del objeto GL.
+         * Distinto de 0 slo en texturas no dispersas con niveles finos liberados.
+         */
+        uint32_t getAllocatedBaseLevel() const { return m_allocatedBaseLevel; }
 
 		BackendType getBackendType() const override { return BackendType::OpenGL; }
         unsigned int toGLTarget() const;
+        unsigned int toGLInternalFormat() const;
+
+        /**
+         * @brief Formato interno GL de un formato, sin crear la textura.
+         */
+        static unsigned int toGLInternalFormat(Format format);
     private:
         Desc m_desc;
-        TextureHandle m_textureId;
+        TextureNameGL m_textureId;
+        std::weak_ptr<DeferredReleaseGL> m_deferredRelease;
+
+        // Handles bindless creados para esta textura (uno por sampler). Se identifican por el
+        // uniqueId del sampler, no por su nombre GL, que se recicla tras glDeleteSamplers
+        struct BindlessHandle {
+            uint64_t samplerUniqueId;       ///< 0 si el handle no usa sampler
+            std::weak_ptr<Sampler> sampler;
+            uint64_t handle;
+            bool resident;
+        };
+        std::vector<BindlessHandle> m_bindlessHandles;
+        // Los handles de GL no se destruyen con el sampler: la textura queda fijada para siempre
+        bool m_hasBindlessHandles = false;
+
+        // Descarta los handles cuyos samplers ya se han destruido
+        void evictDestroyedSamplerHandles();
+
+        // Streaming de mips
+        uint32_t m_residentBaseLevel = 0;
+        uint32_t m_allocatedBaseLevel = 0;
+        float m_lodBias = 0.0f;
+
+        // Texturas dispersas
+        PageSize m_sparsePageSize;
+        uint32_t m_sparseMipTailStart = 0;
+
+        void allocateStorage(TextureNameGL textureId, uint32_t baseLevel) const;
+        void applySamplingParameters() const;
+        uint32_t toAllocatedLevel(uint32_t mipLevel) const;
+        void updateCompressedRegion(const Region& region, int level, const void* pixelData, size_t dataSize);
+        void initSparse();
+        void validateRegion(const Region& region) const;
+        bool isArrayType() const;
+        bool canReallocateLevels() const;
 
         // Conversin a tipos GL, implementados en .cpp
-        unsigned int toGLInternalFormat() const;
         unsigned int toGLFormat() const;
         unsigned int toGLType() const;
+        void getLevelSize(uint32_t mipLevel, uint32_t& width, uint32_t& height, uint32_t& depth) const;
     };
 
 } // namespace pgrender
@@ -5,43 +5,19 @@
 
 namespace pgrender {
 
-    BufferObjectGL::BufferObjectGL(const BufferObject::Desc& desc)
-        : m_desc(desc), m_bufferId(0), m_size(desc.size), m_isMapped(false)
+    BufferObjectGL::BufferObjectGL(const BufferObject::Desc& desc, std::weak_ptr<DeferredReleaseGL> deferredRelease)
+        : m_desc(desc), m_bufferId(0), m_size(desc.size), m_isMapped(false), m_deferredRelease(std::move(deferredRelease))
     {
         if (m_size == 0) {
             throw std::invalid_argument("Buffer size cannot be zero");
         }
 
-        glGenBuffers(1, &m_bufferId);
-        if (m_bufferId == 0) {
-            throw std::runtime_error("Failed to generate OpenGL buffer");
-        }
-
-        GLenum target = toGLTarget();
-        GLenum usage = toGLUsage();
-
-        glBindBuffer(target, m_bufferId);
-
-        // Crear buffer con almacenamiento inmutable (ms eficiente en OpenGL moderno)
-        GLbitfield flags = 0;
-        if (desc.usage == BufferUsage::Dynamic || desc.usage == BufferUsage::Stream) {
-            flags = GL_DYNAMIC_STORAGE_BIT | GL_MAP_WRITE_BIT | GL_MAP_READ_BIT;
-        }
-
-        glBufferStorage(target, m_size, desc.data, flags);
-
-        // Si no soporta glBufferStorage, usar el mtodo legacy
-        GLenum error = glGetError();
-        if (error == GL_INVALID_OPERATION || error == GL_INVALID_ENUM) {
-            glBufferData(target, m_size, desc.data, usage);
-        }
+        createStorage(desc.data);
 
         // Establecer label para debugging si se proporciona
         if (desc.debugName && glObjectLabel) {
             glObjectLabel(GL_BUFFER, m_bufferId, -1, desc.debugName);
         }
-
-        glBindBuffer(target, 0);
     }
 
     BufferObjectGL::~BufferObjectGL() {
@@ -50,7 +26,7 @@ namespace pgrender {
         }
 
         if (m_bufferId != 0) {
-            glDeleteBuffers(1, &m_bufferId);
+            DeferredReleaseGL::release(m_deferredRelease, DeferredReleaseGL::ObjectType::Buffer, m_bufferId);
             m_bufferId = 0;
         }
     }
@@ -64,10 +40,7 @@ namespace pgrender {
             throw std::out_of_range("Update exceeds buffer size");
         }
 
-        GLenum target = toGLTarget();
-        glBindBuffer(target, m_bufferId);
-        glBufferSubData(target, offset, size, data);
-        glBindBuffer(target, 0);
+        glNamedBufferSubData(m_bufferId, offset, size, data);
     }
 
     void* BufferObjectGL::map(BufferAccessFlags access, size_t offset, size_t size) {
@@ -83,12 +56,8 @@ namespace pgrender {
             throw std::out_of_range("Map range exceeds buffer size");
         }
 
-        GLenum target = toGLTarget();
         GLbitfield accessFlags = toGLAccessFlags(access);
-
-        glBindBuffer(target, m_bufferId);
-        void* ptr = glMapBufferRange(target, offset, size, accessFlags);
-        glBindBuffer(target, 0);
+        void* ptr = glMapNamedBufferRange(m_bufferId, offset, size, accessFlags);
 
         if (!ptr) {
             throw std::runtime_error("Failed to map buffer");
@@ -103,10 +72,7 @@ namespace pgrender {
             throw std::runtime_error("Buffer is not mapped");
         }
 
-        GLenum target = toGLTarget();
-        glBindBuffer(target, m_bufferId);
-        GLboolean success = glUnmapBuffer(target);
-        glBindBuffer(target, 0);
+        GLboolean success = glUnmapNamedBuffer(m_bufferId);
 
         m_isMapped = false;
 
@@ -152,36 +118,34 @@ namespace pgrender {
 
         m_size = newSize;
 
-        GLenum target = toGLTarget();
-        GLenum usage = toGLUsage();
-
-        glBindBuffer(target, m_bufferId);
+        // El almacenamiento es inmutable: se recrea el objeto buffer (cambia el nombre GL,
+        // los VAO que lo referencien deben volver a asignarlo). El anterior se borra cuando
+        // la GPU termine los comandos que an lo usan.
+        DeferredReleaseGL::release(m_deferredRelease, DeferredReleaseGL::ObjectType::Buffer, m_bufferId);
+        m_bufferId = 0;
+        createStorage(data);
 
-        // Realocar buffer (destruye contenido anterior)
-        glBufferData(target, m_size, data, usage);
-
-        glBindBuffer(target, 0);
+        if (m_desc.debugName && glObjectLabel) {
+            glObjectLabel(GL_BUFFER, m_bufferId, -1, m_desc.debugName);
+        }
     }
 
-    unsigned int BufferObjectGL::toGLTarget() const {
-        switch (m_desc.type) {
-        case BufferType::Vertex: return GL_ARRAY_BUFFER;
-        case BufferType::Index: return GL_ELEMENT_ARRAY_BUFFER;
-        case BufferType::Uniform: return GL_UNIFORM_BUFFER;
-        case BufferType::ShaderStorage: return GL_SHADER_STORAGE_BUFFER;
-        case BufferType::TransferSrc:
-        case BufferType::TransferDst:
-            return GL_COPY_READ_BUFFER;
-        default:
-            throw std::runtime_error("Unknown buffer type");
+    void BufferObjectGL::createStorage(const void* data) {
+        glCreateBuffers(1, &m_bufferId);
+        if (m_bufferId == 0) {
+            throw std::runtime_error("Failed to generate OpenGL buffer");
         }
+
+        // Crear buffer con almacenamiento inmutable (ms eficiente en OpenGL moderno)
+        glNamedBufferStorage(m_bufferId, m_size, data, toGLStorageFlags());
     }
 
-    unsigned int BufferObjectGL::toGLUsage() const {
+    unsigned int BufferObjectGL::toGLStorageFlags() const {
         switch (m_desc.usage) {
-        case BufferUsage::Static: return GL_STATIC_DRAW;
-        case BufferUsage::Dynamic: return GL_DYNAMIC_DRAW;
-        case BufferUsage::Stream: return GL_STREAM_DRAW;
+        case BufferUsage::Static: return 0;
+        case BufferUsage::Dynamic:
+        case BufferUsage::Stream:
+            return GL_DYNAMIC_STORAGE_BIT | GL_MAP_WRITE_BIT | GL_MAP_READ_BIT;
         default:
             throw std::runtime_error("Unknown buffer usage");
         }
@@ -7,10 +7,13 @@
 #include "PGRenderCoreGL/renderPassGL.h"
 #include "PGRenderCoreGL/samplerGL.h"
 #include "PGRenderCoreGL/vertexArrayGL.h"
+#include "PGRenderCore/bindingState.h"
 #include <GL/glew.h>
 #include <stdexcept>
 #include <iostream>
 #include <cstring>
+#include <algorithm>
+#include <utility>
 
 // Platform-specific includes
 #ifdef _WIN32
@@ -33,6 +36,9 @@ namespace pgrender {
 		m_nativeDisplayHandle(desc.nativeDisplayHandle),
 		m_glContext(nullptr),
 		m_vao(0),
+		m_bindlessTextureSupported(false),
+		m_indirectCountSupported(false),
+		m_sparseTextureSupported(false),
 		m_rayTracingSupported(false)
 	{
 		if (!m_nativeWindowHandle) {
@@ -55,6 +61,12 @@ namespace pgrender {
 			);
 		}
 
+		// El frontend GL4 usa Direct State Access (OpenGL 4.5 / ARB_direct_state_access) en todos los recursos
+		if (!GLEW_VERSION_4_5 && !GLEW_ARB_direct_state_access) {
+			cleanupGLContext();
+			throw std::runtime_error("OpenGL 4.5 or GL_ARB_direct_state_access is required");
+		}
+
 		// Informacin de la implementacin OpenGL
 		std::cout << "=== OpenGL Context Information ===" << std::endl;
 		std::cout << "Version: " << glGetString(GL_VERSION) << std::endl;
@@ -63,9 +75,84 @@ namespace pgrender {
 		std::cout << "Renderer: " << glGetString(GL_RENDERER) << std::endl;
 
 		// Crear VAO por defecto (requerido en OpenGL Core Profile)
-		glGenVertexArrays(1, &m_vao);
+		glCreateVertexArrays(1, &m_vao);
 		glBindVertexArray(m_vao);
 
+		// Lmites de compute
+		for (GLuint axis = 0; axis < 3; ++axis) {
+			GLint count = 0;
+			glGetIntegeri_v(GL_MAX_COMPUTE_WORK_GROUP_COUNT, axis, &count);
+			m_maxComputeWorkGroupCount[axis] = static_cast<uint32_t>(count);
+		}
+
+		// Draw count ledo de GPU (ncleo en 4.6, extensin en versiones anteriores)
+		m_indirectCountSupported = GLEW_VERSION_4_6 || GLEW_ARB_indirect_parameters;
+
+		// Verificar soporte de texturas bindless
+		m_bindlessTextureSupported = GLEW_ARB_bindless_texture != 0;
+		std::cout << "Bindless Textures: " << (m_bindlessTextureSupported ? "Supported (GL_ARB_bindless_texture)" : "Not Supported") << std::endl;
+
+		// Verificar soporte de texturas dispersas
+		m_sparseTextureSupported = GLEW_ARB_sparse_texture != 0;
+		std::cout << "Sparse Textures: " << (m_sparseTextureSupported ? "Supported (GL_ARB_sparse_texture)" : "Not Supported") << std::endl;
+
+		// Verificar soporte de formatos comprimidos por bloques
+		m_s3tcSupported = GLEW_EXT_texture_compression_s3tc != 0;
+		m_bptcSupported = GLEW_VERSION_4_2 || GLEW_ARB_texture_compression_bptc;
+		m_etc2Supported = GLEW_VERSION_4_3 || GLEW_ARB_ES3_compatibility;
+		m_astcSupported = GLEW_KHR_texture_compression_astc_ldr != 0;
+		std::cout << "Compressed Formats: RGTC"
+			<< (m_s3tcSupported ? " S3TC" : "")
+			<< (m_bptcSupported ? " BPTC" : "")
+			<< (m_etc2Supported ? " ETC2" : "")
+			<< (m_astcSupported ? " ASTC" : "") << std::endl;
+
+		queryFormatFeatures();
+
+		// Etapas precompiladas en SPIR-V (ncleo en 4.6)
+		m_spirvSupported = GLEW_VERSION_4_6 || GLEW_ARB_gl_spirv;
+		std::cout << "SPIR-V Shaders: " << (m_spirvSupported ? "Supported" : "Not Supported") << std::endl;
+
+		GLint uniformAlignment = 0;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment);
+		if (uniformAlignment > 0) {
+			m_uniformBufferOffsetAlignment = static_cast<size_t>(uniformAlignment);
+		}
+
+		// Tablas de binding planas, dimensionadas con los lmites del driver
+		auto queryLimit = [](GLenum limit) {
+			GLint value = 0;
+			glGetIntegerv(limit, &value);
+			return static_cast<size_t>(std::max(value, 0));
+		};
+		const size_t textureUnits = queryLimit(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS);
+		m_boundTextures.resize(textureUnits);
+		m_boundSamplers.resize(textureUnits);
+		m_boundUniformBuffers.resize(queryLimit(GL_MAX_UNIFORM_BUFFER_BINDINGS));
+		m_boundShaderStorageBuffers.resize(queryLimit(GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS));
+		const size_t maxBindings = std::max({ m_boundTextures.size(), m_boundUniformBuffers.size(), m_boundShaderStorageBuffers.size() });
+		m_bindNames.resize(maxBindings);
+		m_bindOffsets.resize(maxBindings);
+		m_bindSizes.resize(maxBindings);
+
+		m_deferredRelease = std::make_shared<DeferredReleaseGL>();
+		m_deferredRelease->setReleaseCallback([this](DeferredReleaseGL::ObjectType type, uint32_t name) {
+			invalidateBindings(type, name);
+		});
+
+		m_programPipelineCache = std::make_unique<ProgramPipelineCacheGL>();
+		m_shaderObjectCache = std::make_unique<ShaderObjectCacheGL>();
+
+		// Compilacin de shaders en hilos del driver (Program::beginCompile no bloquea)
+		if (GLEW_ARB_parallel_shader_compile) {
+			glMaxShaderCompilerThreadsARB(0xFFFFFFFFu);
+		}
+		else if (GLEW_KHR_parallel_shader_compile) {
+			glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+		}
+		std::cout << "Parallel Shader Compile: "
+			<< (GLEW_ARB_parallel_shader_compile || GLEW_KHR_parallel_shader_compile ? "Supported" : "Not Supported") << std::endl;
+
 		// Verificar soporte de ray tracing (extensin NVIDIA)
 #ifdef GL_NV_ray_tracing
 		m_rayTracingSupported = GLEW_NV_ray_tracing != 0;
@@ -74,6 +161,7 @@ namespace pgrender {
 #endif
 
 		if (m_rayTracingSupported) {
+			m_boundAccelerationStructures.resize(kMaxAccelerationStructureBindings);
 			std::cout << "Ray Tracing: Supported (GL_NV_ray_tracing)" << std::endl;
 		}
 		else {
@@ -84,6 +172,15 @@ namespace pgrender {
 	}
 
 	ContextGL::~ContextGL() {
+		// Los program pipelines, shader objects, recursos por handle y objetos pendientes de
+		// liberar se borran con el contexto an activo; los recursos que lo sobrevivan borran
+		// los suyos en el acto
+		m_programPipelineCache.reset();
+		m_shaderObjectCache.reset();
+		m_bufferPool.clear();
+		m_texturePool.clear();
+		m_samplerPool.clear();
+		m_deferredRelease.reset();
 		if (m_vao) {
 			glDeleteVertexArrays(1, &m_vao);
 			m_vao = 0;
@@ -298,24 +395,29 @@ namespace pgrender {
 		// macOS swap
 
 #endif
+		endFrame();
+	}
+
+	void ContextGL::endFrame() {
+		m_deferredRelease->endFrame();
 	}
 
 	// ===== FBRICAS DE RECURSOS =====
 
 	std::shared_ptr<BufferObject> ContextGL::createBufferObject(const BufferObject::Desc& desc) {
-		return std::make_shared<BufferObjectGL>(desc);
+		return std::make_shared<BufferObjectGL>(desc, m_deferredRelease);
 	}
 
 	std::shared_ptr<Texture> ContextGL::createTexture(const Texture::Desc& desc) {
-		return std::make_shared<TextureGL>(desc);
+		return std::make_shared<TextureGL>(desc, m_deferredRelease);
 	}
 
 	std::shared_ptr<Program> ContextGL::createProgram(const Program::Desc& desc) {
-		return std::make_shared<ShaderGL>(desc);
+		return std::make_shared<ShaderGL>(desc, m_shaderObjectCache.get());
 	}
 
 	std::shared_ptr<Pipeline> ContextGL::createPipeline(const Pipeline::Desc& desc) {
-		return std::make_shared<PipelineGL>(desc);
+		return std::make_shared<PipelineGL>(desc, *m_programPipelineCache);
 	}
 
 	std::shared_ptr<RenderTarget> ContextGL::createRenderTarget(const RenderTarget::Desc& desc) {
@@ -327,7 +429,7 @@ namespace pgrender {
 	}
 
 	std::shared_ptr<Sampler> ContextGL::createSampler(const Sampler::Desc& desc) {
-		return std::make_shared<SamplerGL>(desc);
+		return std::make_shared<SamplerGL>(desc, m_deferredRelease);
 	}
 
 	std::shared_ptr<VertexArray> ContextGL::createVertexArray(const VertexArray::Desc& desc) {
@@ -372,12 +474,12 @@ namespace pgrender {
 			throw std::runtime_error("Cannot bind non-OpenGL pipeline to OpenGL context");
 		}
 
-		// Evitar re-binding del mismo pipeline
-		if (m_boundPipeline == pipeline) {
+		// Evitar re-binding del mismo pipeline, salvo que se haya recargado alguno de sus programas
+		auto* pipelineGL = pipeline->as<PipelineGL>();
+		if (m_boundPipeline == pipeline && pipelineGL->isUpToDate()) {
 			return;
 		}
 
-		auto* pipelineGL = pipeline->as<PipelineGL>();
 		pipelineGL->apply();
 
 		m_boundPipeline = pipeline;
@@ -388,95 +490,324 @@ namespace pgrender {
 	}
 
 	void ContextGL::bindTexture(const std::shared_ptr<Texture>& texture, uint32_t slot) {
-		glActiveTexture(GL_TEXTURE0 + slot);
+		bindTextures(slot, std::span<const std::shared_ptr<Texture>>(&texture, 1));
+	}
 
-		if (!texture) {
-			glBindTexture(GL_TEXTURE_2D, 0);
-			return;
-		}
+	void ContextGL::bindSampler(const std::shared_ptr<Sampler>& sampler, uint32_t slot) {
+		bindSamplers(slot, std::span<const std::shared_ptr<Sampler>>(&sampler, 1));
+	}
 
-		if (texture->getBackendType() != BackendType::OpenGL) {
-			throw std::runtime_error("Cannot bind non-OpenGL texture to OpenGL context");
+	namespace {
+
+		// Rango de buffer ya resuelto a su objeto GL
+		struct ResolvedBufferRange {
+			const BufferObjectGL* buffer = nullptr;
+			size_t offset = 0;
+			size_t size = 0;
+		};
+
+		void validateBufferRanges(std::span<const BufferRange> ranges) {
+			for (const auto& range : ranges) {
+				if (range.buffer && range.buffer->getBackendType() != BackendType::OpenGL) {
+					throw std::runtime_error("Cannot bind non-OpenGL buffer to OpenGL context");
+				}
+			}
 		}
 
-		auto* texGL = texture->as<TextureGL>();
-		glBindTexture(texGL->toGLTarget(), texGL->nativeTextureId());
-	}
+	} // namespace
 
-	void ContextGL::bindSampler(const std::shared_ptr<Sampler>& sampler, uint32_t slot) {
-		if (!sampler) {
-			glBindSampler(slot, 0);
-			return;
+	template <typename Resolve>
+	void ContextGL::bindTextureUnits(uint32_t firstSlot, size_t count, Resolve&& resolve) {
+		if (firstSlot + count > m_boundTextures.size()) {
+			throw std::out_of_range("Texture unit out of range");
 		}
 
-		if (sampler->getBackendType() != BackendType::OpenGL) {
-			throw std::runtime_error("Cannot bind non-OpenGL sampler to OpenGL context");
+		// Slo se enva el tramo de unidades que cambia respecto al estado guardado
+		const auto slots = std::span(m_boundTextures).subspan(firstSlot, count);
+		const DirtyRange dirty = updateBindingSlots(slots, [&resolve](size_t i) {
+			const Texture* texture = resolve(i);
+			return BindingSlot<Texture>{ texture, texture ? static_cast<const TextureGL*>(texture)->nativeTextureId() : 0u };
+		});
+		if (dirty.empty()) {
+			return;
 		}
 
-		auto* samplerGL = sampler->as<SamplerGL>();
-		glBindSampler(slot, samplerGL->nativeSamplerId());
+		GLuint* names = m_bindNames.data();
+		for (size_t i = dirty.first; i < dirty.last; ++i) {
+			names[i] = slots[i].name;
+		}
+		if (GLEW_VERSION_4_4 || GLEW_ARB_multi_bind) {
+			glBindTextures(firstSlot + static_cast<GLuint>(dirty.first), static_cast<GLsizei>(dirty.count()), names + dirty.first);
+		}
+		else {
+			// DSA: una llamada por unidad, sin modificar la unidad de textura activa
+			for (size_t i = dirty.first; i < dirty.last; ++i) {
+				glBindTextureUnit(firstSlot + static_cast<GLuint>(i), names[i]);
+			}
+		}
 	}
 
-	void ContextGL::bindUniformBuffer(const std::shared_ptr<BufferObject>& buffer,
-		uint32_t binding,
-		size_t offset,
-		size_t size) {
-		if (!buffer) {
-			glBindBufferBase(GL_UNIFORM_BUFFER, binding, 0);
-			m_boundUniformBuffers.erase(binding);
+	template <typename Resolve>
+	void ContextGL::bindSamplerUnits(uint32_t firstSlot, size_t count, Resolve&& resolve) {
+		if (firstSlot + count > m_boundSamplers.size()) {
+			throw std::out_of_range("Sampler unit out of range");
+		}
+
+		const auto slots = std::span(m_boundSamplers).subspan(firstSlot, count);
+		const DirtyRange dirty = updateBindingSlots(slots, [&resolve](size_t i) {
+			const Sampler* sampler = resolve(i);
+			return BindingSlot<Sampler>{ sampler, sampler ? static_cast<const SamplerGL*>(sampler)->nativeSamplerId() : 0u };
+		});
+		if (dirty.empty()) {
 			return;
 		}
 
-		if (buffer->getBackendType() != BackendType::OpenGL) {
-			throw std::runtime_error("Cannot bind non-OpenGL buffer to OpenGL context");
+		GLuint* names = m_bindNames.data();
+		for (size_t i = dirty.first; i < dirty.last; ++i) {
+			names[i] = slots[i].name;
+		}
+		if (GLEW_VERSION_4_4 || GLEW_ARB_multi_bind) {
+			glBindSamplers(firstSlot + static_cast<GLuint>(dirty.first), static_cast<GLsizei>(dirty.count()), names + dirty.first);
+		}
+		else {
+			for (size_t i = dirty.first; i < dirty.last; ++i) {
+				glBindSampler(firstSlot + static_cast<GLuint>(i), names[i]);
+			}
+		}
+	}
+
+	template <typename Resolve>
+	void ContextGL::bindBufferRanges(unsigned int target, std::vector<BindingSlot<BufferObject>>& slots,
+		uint32_t firstBinding, size_t count, Resolve&& resolve) {
+		if (firstBinding + count > slots.size()) {
+			throw std::out_of_range("Buffer binding out of range");
+		}
+		// Se valida antes de tocar el estado guardado: un error no deja la tabla a medias
+		for (size_t i = 0; i < count; ++i) {
+			const ResolvedBufferRange range = resolve(i);
+			if (range.buffer && (range.offset > range.buffer->getSize() || range.size > range.buffer->getSize() - range.offset)) {
+				throw std::out_of_range("Buffer range exceeds the size of the buffer");
+			}
 		}
 
-		auto* bufferGL = buffer->as<BufferObjectGL>();
+		const auto bindings = std::span(slots).subspan(firstBinding, count);
+		const DirtyRange dirty = updateBindingSlots(bindings, [&resolve](size_t i) {
+			const ResolvedBufferRange range = resolve(i);
+			if (!range.buffer) {
+				return BindingSlot<BufferObject>{};     // Con buffer 0 se ignoran offset y size
+			}
+			// Size 0 cubre hasta el final del buffer
+			const size_t size = range.size > 0 ? range.size : range.buffer->getSize() - range.offset;
+			return BindingSlot<BufferObject>{ range.buffer, range.buffer->nativeBufferId(), range.offset, size };
+		});
+		if (dirty.empty()) {
+			return;
+		}
 
-		if (size > 0) {
-			glBindBufferRange(GL_UNIFORM_BUFFER, binding, bufferGL->nativeBufferId(), offset, size);
+		GLuint* buffers = m_bindNames.data();
+		GLintptr* offsets = m_bindOffsets.data();
+		GLsizeiptr* sizes = m_bindSizes.data();
+		for (size_t i = dirty.first; i < dirty.last; ++i) {
+			buffers[i] = bindings[i].name;
+			offsets[i] = static_cast<GLintptr>(bindings[i].offset);
+			sizes[i] = static_cast<GLsizeiptr>(bindings[i].size);
+		}
+		if (GLEW_VERSION_4_4 || GLEW_ARB_multi_bind) {
+			glBindBuffersRange(target, firstBinding + static_cast<GLuint>(dirty.first), static_cast<GLsizei>(dirty.count()),
+				buffers + dirty.first, offsets + dirty.first, sizes + dirty.first);
 		}
 		else {
-			glBindBufferBase(GL_UNIFORM_BUFFER, binding, bufferGL->nativeBufferId());
+			for (size_t i = dirty.first; i < dirty.last; ++i) {
+				const GLuint binding = firstBinding + static_cast<GLuint>(i);
+				if (buffers[i] != 0) {
+					glBindBufferRange(target, binding, buffers[i], offsets[i], sizes[i]);
+				}
+				else {
+					glBindBufferBase(target, binding, 0);
+				}
+			}
 		}
+	}
+
+	void ContextGL::bindTextures(uint32_t firstSlot, std::span<const std::shared_ptr<Texture>> textures) {
+		for (const auto& texture : textures) {
+			if (texture && texture->getBackendType() != BackendType::OpenGL) {
+				throw std::runtime_error("Cannot bind non-OpenGL texture to OpenGL context");
+			}
+		}
+		bindTextureUnits(firstSlot, textures.size(), [&textures](size_t i) {
+			return textures[i].get();
+		});
+	}
 
-		m_boundUniformBuffers[binding] = buffer;
+	void ContextGL::bindSamplers(uint32_t firstSlot, std::span<const std::shared_ptr<Sampler>> samplers) {
+		for (const auto& sampler : samplers) {
+			if (sampler && sampler->getBackendType() != BackendType::OpenGL) {
+				throw std::runtime_error("Cannot bind non-OpenGL sampler to OpenGL context");
+			}
+		}
+		bindSamplerUnits(firstSlot, samplers.size(), [&samplers](size_t i) {
+			return samplers[i].get();
+		});
+	}
+
+	void ContextGL::bindUniformBuffer(const std::shared_ptr<BufferObject>& buffer,
+		uint32_t binding,
+		size_t offset,
+		size_t size) {
+		const BufferRange range{ buffer, offset, size };
+		bindUniformBuffers(binding, std::span<const BufferRange>(&range, 1));
 	}
 
 	void ContextGL::bindShaderStorageBuffer(const std::shared_ptr<BufferObject>& buffer,
 		uint32_t binding,
 		size_t offset,
 		size_t size) {
-		if (!buffer) {
-			glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
-			m_boundShaderStorageBuffers.erase(binding);
-			return;
-		}
+		const BufferRange range{ buffer, offset, size };
+		bindShaderStorageBuffers(binding, std::span<const BufferRange>(&range, 1));
+	}
 
-		if (buffer->getBackendType() != BackendType::OpenGL) {
-			throw std::runtime_error("Cannot bind non-OpenGL buffer to OpenGL context");
-		}
+	void ContextGL::bindUniformBuffers(uint32_t firstBinding, std::span<const BufferRange> ranges) {
+		validateBufferRanges(ranges);
+		bindBufferRanges(GL_UNIFORM_BUFFER, m_boundUniformBuffers, firstBinding, ranges.size(), [&ranges](size_t i) {
+			return ResolvedBufferRange{ static_cast<const BufferObjectGL*>(ranges[i].buffer.get()), ranges[i].offset, ranges[i].size };
+		});
+	}
+
+	void ContextGL::bindShaderStorageBuffers(uint32_t firstBinding, std::span<const BufferRange> ranges) {
+		validateBufferRanges(ranges);
+		bindBufferRanges(GL_SHADER_STORAGE_BUFFER, m_boundShaderStorageBuffers, firstBinding, ranges.size(), [&ranges](size_t i) {
+			return ResolvedBufferRange{ static_cast<const BufferObjectGL*>(ranges[i].buffer.get()), ranges[i].offset, ranges[i].size };
+		});
+	}
+
+	BufferObject* ContextGL::getBoundUniformBuffer(uint32_t binding) const {
+		return binding < m_boundUniformBuffers.size() ? const_cast<BufferObject*>(m_boundUniformBuffers[binding].resource) : nullptr;
+	}
+
+	BufferObject* ContextGL::getBoundShaderStorageBuffer(uint32_t binding) const {
+		return binding < m_boundShaderStorageBuffers.size() ? const_cast<BufferObject*>(m_boundShaderStorageBuffers[binding].resource) : nullptr;
+	}
+
+	// ===== RECURSOS POR HANDLE =====
+
+	BufferHandle ContextGL::createBufferHandle(const BufferObject::Desc& desc) {
+		return m_bufferPool.create(desc, m_deferredRelease);
+	}
 
-		auto* bufferGL = buffer->as<BufferObjectGL>();
+	TextureHandle ContextGL::createTextureHandle(const Texture::Desc& desc) {
+		return m_texturePool.create(desc, m_deferredRelease);
+	}
+
+	SamplerHandle ContextGL::createSamplerHandle(const Sampler::Desc& desc) {
+		return m_samplerPool.create(desc, m_deferredRelease);
+	}
+
+	bool ContextGL::destroy(BufferHandle buffer) {
+		return m_bufferPool.destroy(buffer);
+	}
+
+	bool ContextGL::destroy(TextureHandle texture) {
+		return m_texturePool.destroy(texture);
+	}
+
+	bool ContextGL::destroy(SamplerHandle sampler) {
+		return m_samplerPool.destroy(sampler);
+	}
+
+	BufferObject* ContextGL::getBuffer(BufferHandle buffer) const {
+		return const_cast<BufferObjectGL*>(m_bufferPool.get(buffer));
+	}
+
+	Texture* ContextGL::getTexture(TextureHandle texture) const {
+		return const_cast<TextureGL*>(m_texturePool.get(texture));
+	}
+
+	Sampler* ContextGL::getSampler(SamplerHandle sampler) const {
+		return const_cast<SamplerGL*>(m_samplerPool.get(sampler));
+	}
 
-		if (size > 0) {
-			glBindBufferRange(GL_SHADER_STORAGE_BUFFER, binding, bufferGL->nativeBufferId(), offset, size);
+	void ContextGL::bindTextures(uint32_t firstSlot, std::span<const TextureHandle> textures) {
+		for (TextureHandle texture : textures) {
+			if (texture && !m_texturePool.contains(texture)) {
+				throw std::invalid_argument("Cannot bind a destroyed texture handle");
+			}
 		}
-		else {
-			glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, bufferGL->nativeBufferId());
+		bindTextureUnits(firstSlot, textures.size(), [this, &textures](size_t i) {
+			return static_cast<const Texture*>(m_texturePool.get(textures[i]));
+		});
+	}
+
+	void ContextGL::bindSamplers(uint32_t firstSlot, std::span<const SamplerHandle> samplers) {
+		for (SamplerHandle sampler : samplers) {
+			if (sampler && !m_samplerPool.contains(sampler)) {
+				throw std::invalid_argument("Cannot bind a destroyed sampler handle");
+			}
 		}
+		bindSamplerUnits(firstSlot, samplers.size(), [this, &samplers](size_t i) {
+			return static_cast<const Sampler*>(m_samplerPool.get(samplers[i]));
+		});
+	}
 
-		m_boundShaderStorageBuffers[binding] = buffer;
+	void ContextGL::bindUniformBuffers(uint32_t firstBinding, std::span<const BufferHandleRange> ranges) {
+		for (const auto& range : ranges) {
+			if (range.buffer && !m_bufferPool.contains(range.buffer)) {
+				throw std::invalid_argument("Cannot bind a destroyed buffer handle");
+			}
+		}
+		bindBufferRanges(GL_UNIFORM_BUFFER, m_boundUniformBuffers, firstBinding, ranges.size(), [this, &ranges](size_t i) {
+			return ResolvedBufferRange{ m_bufferPool.get(ranges[i].buffer), ranges[i].offset, ranges[i].size };
+		});
 	}
 
-	std::shared_ptr<BufferObject> ContextGL::getBoundUniformBuffer(uint32_t binding) const {
-		auto it = m_boundUniformBuffers.find(binding);
-		return (it != m_boundUniformBuffers.end()) ? it->second : nullptr;
+	void ContextGL::bindShaderStorageBuffers(uint32_t firstBinding, std::span<const BufferHandleRange> ranges) {
+		for (const auto& range : ranges) {
+			if (range.buffer && !m_bufferPool.contains(range.buffer)) {
+				throw std::invalid_argument("Cannot bind a destroyed buffer handle");
+			}
+		}
+		bindBufferRanges(GL_SHADER_STORAGE_BUFFER, m_boundShaderStorageBuffers, firstBinding, ranges.size(), [this, &ranges](size_t i) {
+			return ResolvedBufferRange{ m_bufferPool.get(ranges[i].buffer), ranges[i].offset, ranges[i].size };
+		});
 	}
 
-	std::shared_ptr<BufferObject> ContextGL::getBoundShaderStorageBuffer(uint32_t binding) const {
-		auto it = m_boundShaderStorageBuffers.find(binding);
-		return (it != m_boundShaderStorageBuffers.end()) ? it->second : nullptr;
+	void ContextGL::invalidateBindings(DeferredReleaseGL::ObjectType type, uint32_t name) {
+		// Se conserva el nombre para que el siguiente bind de esa unidad no se descarte como
+		// redundante: GL la mantiene vinculada hasta que el objeto se borre
+		auto invalidate = [name](auto& slots) {
+			for (auto& slot : slots) {
+				if (slot.name == name) {
+					slot.resource = nullptr;
+				}
+			}
+		};
+		switch (type) {
+		case DeferredReleaseGL::ObjectType::Buffer:
+			invalidate(m_boundUniformBuffers);
+			invalidate(m_boundShaderStorageBuffers);
+			break;
+		case DeferredReleaseGL::ObjectType::Texture:
+			for (size_t unit = 0; unit < m_boundTextures.size(); ++unit) {
+				auto& slot = m_boundTextures[unit];
+				if (slot.name != name || !slot.resource) {
+					continue;
+				}
+				// Si la textura sigue viva con otro nombre es que se ha reasignado su almacenamiento
+				// (Texture::setResidentBaseLevel): la unidad pasa a muestrear el nombre nuevo
+				const auto current = static_cast<uint32_t>(slot.resource->nativeHandle());
+				if (current != name) {
+					glBindTextureUnit(static_cast<GLuint>(unit), current);
+					slot.name = current;
+				}
+				else {
+					slot.resource = nullptr;
+				}
+			}
+			break;
+		case DeferredReleaseGL::ObjectType::Sampler:
+			invalidate(m_boundSamplers);
+			break;
+		}
 	}
 
 	// ===== LIMPIEZA =====
@@ -585,6 +916,305 @@ namespace pgrender {
 		}
 	}
 
+	void ContextGL::bindIndirectBuffer(const std::shared_ptr<BufferObject>& buffer,
+		size_t offset,
+		size_t commandSize,
+		uint32_t drawCount,
+		uint32_t stride) {
+		if (!buffer) {
+			throw std::invalid_argument("Indirect draw buffer is null");
+		}
+
+		if (buffer->getBackendType() != BackendType::OpenGL) {
+			throw std::runtime_error("Cannot draw from non-OpenGL buffer");
+		}
+
+		const size_t effectiveStride = stride ? stride : commandSize;
+		if (offset % 4 != 0 || effectiveStride % 4 != 0 || effectiveStride < commandSize) {
+			throw std::invalid_argument("Indirect draw offset and stride must be multiples of 4");
+		}
+
+		if (drawCount > 0 && offset + (drawCount - 1) * effectiveStride + commandSize > buffer->getSize()) {
+			throw std::out_of_range("Indirect draw commands exceed buffer size");
+		}
+
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, buffer->as<BufferObjectGL>()->nativeBufferId());
+	}
+
+	void ContextGL::drawIndexedIndirect(const std::shared_ptr<BufferObject>& buffer,
+		size_t offset,
+		uint32_t drawCount,
+		uint32_t stride) {
+		bindIndirectBuffer(buffer, offset, sizeof(DrawIndexedIndirectCommand), drawCount, stride);
+
+		if (drawCount == 0) {
+			return;
+		}
+
+		glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT,
+			reinterpret_cast<const void*>(static_cast<uintptr_t>(offset)),
+			drawCount, stride);
+	}
+
+	void ContextGL::drawIndexedIndirectCount(const std::shared_ptr<BufferObject>& buffer,
+		size_t offset,
+		const std::shared_ptr<BufferObject>& countBuffer,
+		size_t countOffset,
+		uint32_t maxDrawCount,
+		uint32_t stride) {
+		if (!m_indirectCountSupported) {
+			throw std::runtime_error("Indirect draw count requires OpenGL 4.6 or GL_ARB_indirect_parameters");
+		}
+
+		bindIndirectBuffer(buffer, offset, sizeof(DrawIndexedIndirectCommand), maxDrawCount, stride);
+
+		if (!countBuffer) {
+			throw std::invalid_argument("Indirect draw count buffer is null");
+		}
+
+		if (countBuffer->getBackendType() != BackendType::OpenGL) {
+			throw std::runtime_error("Cannot read draw count from non-OpenGL buffer");
+		}
+
+		if (countOffset % 4 != 0 || countOffset + sizeof(uint32_t) > countBuffer->getSize()) {
+			throw std::out_of_range("Invalid indirect draw count offset");
+		}
+
+		if (maxDrawCount == 0) {
+			return;
+		}
+
+		glBindBuffer(GL_PARAMETER_BUFFER, countBuffer->as<BufferObjectGL>()->nativeBufferId());
+
+		const void* indirect = reinterpret_cast<const void*>(static_cast<uintptr_t>(offset));
+		if (GLEW_VERSION_4_6) {
+			glMultiDrawElementsIndirectCount(GL_TRIANGLES, GL_UNSIGNED_INT, indirect,
+				static_cast<GLintptr>(countOffset), maxDrawCount, stride);
+		}
+		else {
+			glMultiDrawElementsIndirectCountARB(GL_TRIANGLES, GL_UNSIGNED_INT, indirect,
+				static_cast<GLintptr>(countOffset), maxDrawCount, stride);
+		}
+	}
+
+	// ===== COMPUTE =====
+
+	void ContextGL::dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) {
+		if (!m_boundPipeline) {
+			throw std::runtime_error("No pipeline bound for compute dispatch");
+		}
+
+		if (groupsX > m_maxComputeWorkGroupCount[0] ||
+			groupsY > m_maxComputeWorkGroupCount[1] ||
+			groupsZ > m_maxComputeWorkGroupCount[2]) {
+			throw std::invalid_argument("Compute work group count exceeds device limits");
+		}
+
+		if (groupsX == 0 || groupsY == 0 || groupsZ == 0) {
+			return;
+		}
+
+		glDispatchCompute(groupsX, groupsY, groupsZ);
+	}
+
+	void ContextGL::dispatchIndirect(const std::shared_ptr<BufferObject>& buffer, size_t offset) {
+		if (!m_boundPipeline) {
+			throw std::runtime_error("No pipeline bound for compute dispatch");
+		}
+
+		if (!buffer) {
+			throw std::invalid_argument("Indirect dispatch buffer is null");
+		}
+
+		if (buffer->getBackendType() != BackendType::OpenGL) {
+			throw std::runtime_error("Cannot dispatch from non-OpenGL buffer");
+		}
+
+		if (offset % 4 != 0 || offset + sizeof(DispatchIndirectCommand) > buffer->getSize()) {
+			throw std::out_of_range("Invalid indirect dispatch offset");
+		}
+
+		glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER, buffer->as<BufferObjectGL>()->nativeBufferId());
+		glDispatchComputeIndirect(static_cast<GLintptr>(offset));
+	}
+
+	void ContextGL::bindImage(const std::shared_ptr<Texture>& texture,
+		uint32_t unit,
+		ImageAccess access,
+		uint32_t mipLevel,
+		int32_t layer) {
+		if (!texture) {
+			glBindImageTexture(unit, 0, 0, GL_FALSE, 0, GL_READ_ONLY, GL_R8);
+			return;
+		}
+
+		if (texture->getBackendType() != BackendType::OpenGL) {
+			throw std::runtime_error("Cannot bind non-OpenGL texture as image");
+		}
+
+		const auto& texDesc = texture->getDesc();
+		if (!texDesc.storageTexture) {
+			throw std::runtime_error("Texture was not created with storageTexture enabled");
+		}
+
+		if (mipLevel >= std::max<uint32_t>(texDesc.mipLevels, 1)) {
+			throw std::out_of_range("Image mip level out of range");
+		}
+
+		if (!hasFeatures(getFormatFeatures(texDesc.format), FormatFeatures::Storage)) {
+			throw std::runtime_error("Texture format cannot be used for image load/store");
+		}
+
+		GLenum glAccess = GL_READ_WRITE;
+		switch (access) {
+		case ImageAccess::ReadOnly: glAccess = GL_READ_ONLY; break;
+		case ImageAccess::WriteOnly: glAccess = GL_WRITE_ONLY; break;
+		case ImageAccess::ReadWrite: glAccess = GL_READ_WRITE; break;
+		}
+
+		auto* texGL = texture->as<TextureGL>();
+		if (mipLevel < texGL->getAllocatedBaseLevel()) {
+			throw std::out_of_range("Image mip level is not resident");
+		}
+
+		const GLboolean layered = layer < 0 ? GL_TRUE : GL_FALSE;
+		glBindImageTexture(unit, texGL->nativeTextureId(), mipLevel - texGL->getAllocatedBaseLevel(), layered,
+			layer < 0 ? 0 : layer, glAccess, texGL->toGLInternalFormat());
+	}
+
+	void ContextGL::memoryBarrier(BarrierFlags flags) {
+		if (static_cast<uint32_t>(flags) == 0) {
+			return;
+		}
+
+		if (flags == BarrierFlags::All) {
+			glMemoryBarrier(GL_ALL_BARRIER_BITS);
+			return;
+		}
+
+		static const std::pair<BarrierFlags, GLbitfield> glBits[] = {
+			{ BarrierFlags::VertexAttribArray, GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT },
+			{ BarrierFlags::ElementArray, GL_ELEMENT_ARRAY_BARRIER_BIT },
+			{ BarrierFlags::Uniform, GL_UNIFORM_BARRIER_BIT },
+			{ BarrierFlags::TextureFetch, GL_TEXTURE_FETCH_BARRIER_BIT },
+			{ BarrierFlags::ShaderImageAccess, GL_SHADER_IMAGE_ACCESS_BARRIER_BIT },
+			{ BarrierFlags::Command, GL_COMMAND_BARRIER_BIT },
+			{ BarrierFlags::PixelBuffer, GL_PIXEL_BUFFER_BARRIER_BIT },
+			{ BarrierFlags::TextureUpdate, GL_TEXTURE_UPDATE_BARRIER_BIT },
+			{ BarrierFlags::BufferUpdate, GL_BUFFER_UPDATE_BARRIER_BIT },
+			{ BarrierFlags::Framebuffer, GL_FRAMEBUFFER_BARRIER_BIT },
+			{ BarrierFlags::AtomicCounter, GL_ATOMIC_COUNTER_BARRIER_BIT },
+			{ BarrierFlags::ShaderStorage, GL_SHADER_STORAGE_BARRIER_BIT },
+		};
+
+		GLbitfield barriers = 0;
+		for (const auto& [flag, bit] : glBits) {
+			if (static_cast<uint32_t>(flags & flag)) {
+				barriers |= bit;
+			}
+		}
+		glMemoryBarrier(barriers);
+	}
+
+	// ===== TEXTURAS BINDLESS =====
+
+	bool ContextGL::isBindlessTextureSupported() const {
+		return m_bindlessTextureSupported;
+	}
+
+	// ===== TEXTURAS DISPERSAS =====
+
+	bool ContextGL::isSparseTextureSupported() const {
+		return m_sparseTextureSupported;
+	}
+
+	bool ContextGL::isSpirvSupported() const {
+		return m_spirvSupported;
+	}
+
+	// ===== FORMATOS =====
+
+	bool ContextGL::isFormatSupported(Texture::Format format) const {
+		return hasFeatures(getFormatFeatures(format), FormatFeatures::Sampled);
+	}
+
+	FormatFeatures ContextGL::getFormatFeatures(Texture::Format format) const {
+		return m_formatFeatures[static_cast<size_t>(format)];
+	}
+
+	void ContextGL::queryFormatFeatures() {
+		using Format = Texture::Format;
+		const bool canQuery = GLEW_VERSION_4_3 || GLEW_ARB_internalformat_query2;
+
+		for (const FormatInfo& info : kFormatTable) {
+			FormatFeatures features = info.features;
+
+			// Familias de compresin opcionales
+			bool familySupported = true;
+			switch (info.format) {
+			case Format::BC1:
+			case Format::BC1_SRGB:
+			case Format::BC3:
+			case Format::BC3_SRGB:
+				familySupported = m_s3tcSupported;
+				break;
+			case Format::BC6H_UF16:
+			case Format::BC6H_SF16:
+			case Format::BC7:
+			case Format::BC7_SRGB:
+				familySupported = m_bptcSupported;
+				break;
+			case Format::ETC2_RGB8:
+			case Format::ETC2_RGB8_SRGB:
+			case Format::ETC2_RGBA8:
+			case Format::ETC2_RGBA8_SRGB:
+				familySupported = m_etc2Supported;
+				break;
+			case Format::ASTC_4x4:
+			case Format::ASTC_4x4_SRGB:
+			case Format::ASTC_6x6:
+			case Format::ASTC_6x6_SRGB:
+			case Format::ASTC_8x8:
+			case Format::ASTC_8x8_SRGB:
+				familySupported = m_astcSupported;
+				break;
+			default:
+				break;
+			}
+			if (!familySupported) {
+				m_formatFeatures[static_cast<size_t>(info.format)] = FormatFeatures{};
+				continue;
+			}
+
+			// Sin ARB_internalformat_query2 se confa en la tabla
+			if (canQuery) {
+				const GLenum internalFormat = TextureGL::toGLInternalFormat(info.format);
+				auto query = [internalFormat](GLenum pname) {
+					GLint value = GL_NONE;
+					glGetInternalformativ(GL_TEXTURE_2D, internalFormat, pname, 1, &value);
+					return value != GL_NONE && value != GL_FALSE;
+				};
+
+				FormatFeatures supported{};
+				if (query(GL_INTERNALFORMAT_SUPPORTED)) {
+					supported = supported | FormatFeatures::Sampled;
+					if (query(GL_FILTER)) {
+						supported = supported | FormatFeatures::Filterable;
+					}
+					if (query(GL_FRAMEBUFFER_RENDERABLE)) {
+						supported = supported | FormatFeatures::Renderable;
+					}
+					if (query(GL_SHADER_IMAGE_LOAD) && query(GL_SHADER_IMAGE_STORE)) {
+						supported = supported | FormatFeatures::Storage;
+					}
+				}
+				features = features & supported;
+			}
+
+			m_formatFeatures[static_cast<size_t>(info.format)] = features;
+		}
+	}
+
 	// ===== RAY TRACING =====
 
 	bool ContextGL::isRayTracingSupported() const {
@@ -650,21 +1280,20 @@ namespace pgrender {
 			throw std::runtime_error("Ray tracing is not supported");
 		}
 
-		if (!tlas) {
-			m_boundAccelerationStructures.erase(binding);
-			return;
+		if (binding >= m_boundAccelerationStructures.size()) {
+			throw std::out_of_range("Acceleration structure binding out of range");
 		}
 
-		if (tlas->getBackendType() != BackendType::OpenGL) {
+		if (tlas && tlas->getBackendType() != BackendType::OpenGL) {
 			throw std::runtime_error("Cannot bind non-OpenGL acceleration structure");
 		}
 
-		m_boundAccelerationStructures[binding] = tlas;
+		m_boundAccelerationStructures[binding].resource = tlas.get();
 	}
 
-	std::shared_ptr<AccelerationStructure> ContextGL::getBoundAccelerationStructure(uint32_t binding) const {
-		auto it = m_boundAccelerationStructures.find(binding);
-		return (it != m_boundAccelerationStructures.end()) ? it->second : nullptr;
+	AccelerationStructure* ContextGL::getBoundAccelerationStructure(uint32_t binding) const {
+		return binding < m_boundAccelerationStructures.size() ?
+			const_cast<AccelerationStructure*>(m_boundAccelerationStructures[binding].resource) : nullptr;
 	}
 
 	void ContextGL::traceRays(const TraceRaysDesc& desc) {
@@ -0,0 +1,60 @@
+#include "PGRenderCoreGL/deferredReleaseGL.h"
+#include <GL/glew.h>  // Solo aquí
+
+namespace pgrender {
+
+    DeferredReleaseGL::~DeferredReleaseGL() {
+        // Antes de que se destruya la cola: sus borrados llaman a esta clase
+        m_queue.flush();
+    }
+
+    void DeferredReleaseGL::release(ObjectType type, uint32_t name) {
+        if (name == 0) {
+            return;
+        }
+        if (m_onRelease) {
+            m_onRelease(type, name);
+        }
+        m_queue.release(static_cast<uint32_t>(type), name);
+    }
+
+    void DeferredReleaseGL::release(const std::weak_ptr<DeferredReleaseGL>& queue, ObjectType type, uint32_t name) {
+        if (auto deferred = queue.lock()) {
+            deferred->release(type, name);
+        }
+        else if (name != 0) {
+            destroyObject(type, name);
+        }
+    }
+
+    void* DeferredReleaseGL::insertFence() {
+        return glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    bool DeferredReleaseGL::isFenceSignaled(void* fence) {
+        const GLenum status = glClientWaitSync(static_cast<GLsync>(fence), 0, 0);
+        return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+    }
+
+    void DeferredReleaseGL::deleteFence(void* fence) {
+        glDeleteSync(static_cast<GLsync>(fence));
+    }
+
+    void DeferredReleaseGL::waitIdle() {
+        glFinish();
+    }
+
+    void DeferredReleaseGL::destroy(uint32_t type, uint32_t name) {
+        destroyObject(static_cast<ObjectType>(type), name);
+    }
+
+    void DeferredReleaseGL::destroyObject(ObjectType type, uint32_t name) {
+        const GLuint object = static_cast<GLuint>(name);
+        switch (type) {
+        case ObjectType::Buffer:  glDeleteBuffers(1, &object); break;
+        case ObjectType::Texture: glDeleteTextures(1, &object); break;
+        case ObjectType::Sampler: glDeleteSamplers(1, &object); break;
+        }
+    }
+
+} // namespace pgrender
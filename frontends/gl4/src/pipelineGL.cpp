@@ -4,12 +4,25 @@
 #include <GL/glew.h>
 #include <stdexcept>
 #include <iostream>
+#include <algorithm>
 
 namespace pgrender {
 
-	PipelineGL::PipelineGL(const Pipeline::Desc& desc)
-		: m_desc(desc)
+	PipelineGL::PipelineGL(const Pipeline::Desc& desc, ProgramPipelineCacheGL& programPipelines)
+		: m_desc(desc), m_programPipelines(programPipelines)
 	{
+		if (m_desc.program && !m_desc.stagePrograms.empty()) {
+			throw std::invalid_argument("Pipeline cannot use both a program and separable stage programs");
+		}
+
+		// Detectar al crear el pipeline los atributos que faltan o no encajan con el shader
+		const Program* vertexProgram = findStageProgram(ShaderStage::Vertex);
+		if (vertexProgram && !m_desc.vertexLayout.getAttributes().empty()) {
+			const auto& reflection = vertexProgram->getReflection();
+			if (!reflection.empty()) {
+				reflection.validateVertexLayout(m_desc.vertexLayout);
+			}
+		}
 	}
 
 	PipelineGL::~PipelineGL() {
@@ -17,7 +30,26 @@ namespace pgrender {
 
 	void PipelineGL::apply() const
 	{
-		glUseProgram(m_desc.program->nativeHandle());
+		if (m_desc.stagePrograms.empty()) {
+			m_appliedProgram = m_desc.program->nativeHandle();
+			glUseProgram(static_cast<GLuint>(m_appliedProgram));
+		}
+		else {
+			// Un programa en uso tiene prioridad sobre el program pipeline vinculado
+			const auto key = ProgramPipelineCacheGL::makeKey(m_desc.stagePrograms);
+			if (m_programPipeline == 0 || key != m_programPipelineKey) {
+				m_programPipeline = m_programPipelines.acquire(m_desc.stagePrograms);
+				m_programPipelineKey = key;
+			}
+			glUseProgram(0);
+			glBindProgramPipeline(m_programPipeline);
+		}
+
+		// Un pipeline de compute no usa el estado de rasterizacin
+		if (isComputeOnly()) {
+			return;
+		}
+
 		applyBlendMode();
 		applyDepthState();
 		applyCullMode();
@@ -25,6 +57,39 @@ namespace pgrender {
 		// Aqu se pueden aplicar otros estados si es necesario
 	}
 
+	bool PipelineGL::isUpToDate() const {
+		if (m_desc.stagePrograms.empty()) {
+			return m_desc.program->nativeHandle() == m_appliedProgram;
+		}
+		return m_programPipeline != 0 && ProgramPipelineCacheGL::makeKey(m_desc.stagePrograms) == m_programPipelineKey;
+	}
+
+	bool PipelineGL::isComputeOnly() const {
+		if (!m_desc.stagePrograms.empty()) {
+			return findStageProgram(ShaderStage::Compute) != nullptr;
+		}
+		const auto& stages = m_desc.program->getDesc().stages;
+		return !stages.empty() && std::all_of(stages.begin(), stages.end(),
+			[](const ShaderSource& stage) { return stage.stage == ShaderStage::Compute; });
+	}
+
+	const Program* PipelineGL::findStageProgram(ShaderStage stage) const {
+		auto hasStage = [stage](const std::shared_ptr<Program>& program) {
+			if (!program) {
+				return false;
+			}
+			const auto& stages = program->getDesc().stages;
+			return std::any_of(stages.begin(), stages.end(),
+				[stage](const ShaderSource& source) { return source.stage == stage; });
+		};
+
+		if (hasStage(m_desc.program)) {
+			return m_desc.program.get();
+		}
+		auto it = std::find_if(m_desc.stagePrograms.begin(), m_desc.stagePrograms.end(), hasStage);
+		return it != m_desc.stagePrograms.end() ? it->get() : nullptr;
+	}
+
 	void PipelineGL::applyBlendMode() const {
 		if (m_desc.customBlendState.enabled)
 			glEnable(GL_BLEND);
@@ -0,0 +1,135 @@
+#include "PGRenderCoreGL/programPipelineCacheGL.h"
+#include "PGRenderCoreGL/shaderGL.h"
+#include <GL/glew.h> // Solo aquí
+#include <stdexcept>
+#include <functional>
+
+namespace pgrender {
+
+    namespace {
+
+        int stageSlot(ShaderStage stage) {
+            switch (stage) {
+            case ShaderStage::Vertex: return 0;
+            case ShaderStage::TessControl: return 1;
+            case ShaderStage::TessEvaluation: return 2;
+            case ShaderStage::Geometry: return 3;
+            case ShaderStage::Fragment: return 4;
+            case ShaderStage::Compute: return 5;
+            default: return -1;
+            }
+        }
+
+        GLbitfield stageBit(ShaderStage stage) {
+            switch (stage) {
+            case ShaderStage::Vertex: return GL_VERTEX_SHADER_BIT;
+            case ShaderStage::TessControl: return GL_TESS_CONTROL_SHADER_BIT;
+            case ShaderStage::TessEvaluation: return GL_TESS_EVALUATION_SHADER_BIT;
+            case ShaderStage::Geometry: return GL_GEOMETRY_SHADER_BIT;
+            case ShaderStage::Fragment: return GL_FRAGMENT_SHADER_BIT;
+            case ShaderStage::Compute: return GL_COMPUTE_SHADER_BIT;
+            default: return 0;
+            }
+        }
+
+    } // namespace
+
+    ProgramPipelineCacheGL::~ProgramPipelineCacheGL() {
+        clear();
+    }
+
+    ProgramPipelineCacheGL::Key ProgramPipelineCacheGL::makeKey(const std::vector<std::shared_ptr<Program>>& programs) {
+        Key key{};
+        for (const auto& program : programs) {
+            if (!program || program->getBackendType() != BackendType::OpenGL) {
+                throw std::invalid_argument("Program pipeline stages must be OpenGL programs");
+            }
+            if (!program->getDesc().separable) {
+                throw std::invalid_argument("Program pipeline stages must be created with Program::Desc::separable");
+            }
+
+            const uint64_t serial = program->as<ShaderGL>()->getLinkSerial();
+            if (serial == 0) {
+                throw std::runtime_error("Program pipeline stage is not compiled");
+            }
+
+            for (const auto& stage : program->getDesc().stages) {
+                const int slot = stageSlot(stage.stage);
+                if (slot < 0) {
+                    throw std::invalid_argument("Stage is not supported by program pipelines");
+                }
+                if (key[slot] != 0) {
+                    throw std::invalid_argument("Two programs provide the same stage to a program pipeline");
+                }
+                key[slot] = serial;
+            }
+        }
+        return key;
+    }
+
+    unsigned int ProgramPipelineCacheGL::acquire(const std::vector<std::shared_ptr<Program>>& programs) {
+        const Key key = makeKey(programs);
+        auto it = m_entries.find(key);
+        if (it != m_entries.end()) {
+            return it->second.pipeline;
+        }
+
+        // Sólo se barre al crear: las búsquedas no pagan nada por las entradas obsoletas
+        removeStale();
+
+        Entry entry;
+        glCreateProgramPipelines(1, &entry.pipeline);
+        if (entry.pipeline == 0) {
+            throw std::runtime_error("Failed to create program pipeline");
+        }
+
+        for (const auto& program : programs) {
+            GLbitfield stages = 0;
+            for (const auto& stage : program->getDesc().stages) {
+                stages |= stageBit(stage.stage);
+            }
+            glUseProgramStages(entry.pipeline, stages, static_cast<GLuint>(program->nativeHandle()));
+            entry.programs.push_back(program);
+        }
+
+        return m_entries.emplace(key, std::move(entry)).first->second.pipeline;
+    }
+
+    void ProgramPipelineCacheGL::clear() {
+        for (auto& [key, entry] : m_entries) {
+            glDeleteProgramPipelines(1, &entry.pipeline);
+        }
+        m_entries.clear();
+    }
+
+    void ProgramPipelineCacheGL::removeStale() {
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            bool stale = false;
+            for (const auto& weak : it->second.programs) {
+                auto program = weak.lock();
+                if (!program || program->getDesc().stages.empty() || it->first[stageSlot(program->getDesc().stages.front().stage)] !=
+                    program->as<ShaderGL>()->getLinkSerial()) {
+                    stale = true;
+                    break;
+                }
+            }
+
+            if (stale) {
+                glDeleteProgramPipelines(1, &it->second.pipeline);
+                it = m_entries.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    size_t ProgramPipelineCacheGL::KeyHash::operator()(const Key& key) const {
+        size_t hash = 0;
+        for (uint64_t serial : key) {
+            hash = hash * 31 + std::hash<uint64_t>{}(serial);
+        }
+        return hash;
+    }
+
+} // namespace pgrender
@@ -2,13 +2,28 @@
 #include <GL/glew.h>
 #include <stdexcept>
 #include <PGRenderCoreGL/renderTargetGL.h>
+#include <PGRenderCoreGL/textureGL.h>
+#include <PGRenderCore/formatInfo.h>
 
 namespace pgrender {
 
     RenderPassGL::RenderPassGL(const RenderPass::Desc& desc)
         : m_desc(desc), m_isActive(false)
     {
-        // Aqu puedes validar el descriptor, verificar compatibilidad, etc.
+        if (m_desc.renderTarget && m_desc.renderTarget->getBackendType() != BackendType::OpenGL) {
+            throw std::invalid_argument("RenderPass render target is not an OpenGL render target");
+        }
+        if (m_desc.resolveTarget && m_desc.resolveTarget->getBackendType() != BackendType::OpenGL) {
+            throw std::invalid_argument("RenderPass resolve target is not an OpenGL render target");
+        }
+
+        // El framebuffer por defecto no puede ser origen de un resolve
+        if (!m_desc.renderTarget && !collectAttachments(StoreAction::Resolve).empty()) {
+            throw std::invalid_argument("StoreAction::Resolve requires a RenderTarget as source");
+        }
+        if (m_desc.renderTarget && m_desc.renderTarget == m_desc.resolveTarget) {
+            throw std::invalid_argument("RenderPass cannot resolve a RenderTarget onto itself");
+        }
     }
 
     RenderPassGL::~RenderPassGL()
@@ -33,39 +48,11 @@ namespace pgrender {
         }
         m_isActive = true;
 
-        // Bind framebuffer si existe
         if (m_desc.renderTarget) {
-            // Cast seguro a RenderTargetGL para obtener handle y bindear FBO
-            // Asume dynamic_pointer_cast, pero puedes aadir mtodo virtual en RenderTarget para bind/unbind
-            auto rtGL = std::dynamic_pointer_cast<RenderTargetGL>(m_desc.renderTarget);
-            if (!rtGL) {
-                throw std::runtime_error("Invalid RenderTarget for RenderPass");
-            }
-            glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(rtGL->nativeHandle()));
-        }
-        else {
-            // Bind framebuffer por defecto
-            glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        }
-
-        // Clear si est definido en descriptor
-        GLuint clearMask = 0;
-        if (m_desc.clearColor) {
-            auto & c = m_desc.clearColorValue;
-            glClearColor(c[0], c[1], c[2], c[3]);
-            clearMask |= GL_COLOR_BUFFER_BIT;
-        }
-        if (m_desc.clearDepth) {
-            glClearDepth(m_desc.clearDepthValue);
-            clearMask |= GL_DEPTH_BUFFER_BIT;
-        }
-        if (m_desc.clearStencil) {
-            glClearStencil(m_desc.clearStencilValue);
-            clearMask |= GL_STENCIL_BUFFER_BIT;
-        }
-        if (clearMask != 0) {
-            glClear(clearMask);
+            m_desc.renderTarget->as<RenderTargetGL>()->refreshAttachments();
         }
+        glBindFramebuffer(GL_FRAMEBUFFER, framebufferId());
+        applyLoadActions();
     }
 
     void RenderPassGL::end() {
@@ -74,8 +61,155 @@ namespace pgrender {
         }
         m_isActive = false;
 
+        // Primero se resuelve (necesita el contenido) y despus se descarta lo que no se va a usar
+        resolveAttachments();
+        applyStoreActions();
+
         // Unbind framebuffer (volver a default)
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
     }
 
+    // ===== ACCIONES DE CARGA =====
+
+    void RenderPassGL::applyLoadActions() const {
+        GLuint fbo = framebufferId();
+
+        // DontCare: el contenido previo se invalida, evitando su lectura en hardware tile-based
+        auto discarded = collectAttachments(LoadAction::DontCare);
+        if (!discarded.empty()) {
+            glInvalidateNamedFramebufferData(fbo, static_cast<GLsizei>(discarded.size()), discarded.data());
+        }
+
+        // Clear por attachment, sin tocar el estado global de glClearColor/glClearDepth
+        for (uint32_t i = 0; i < colorAttachmentCount(); ++i) {
+            const auto& ops = colorOps(i);
+            if (ops.loadAction != LoadAction::Clear) {
+                continue;
+            }
+            // Los attachments enteros deben limpiarse con la variante uiv
+            auto texture = m_desc.renderTarget ? m_desc.renderTarget->getColorAttachment(i) : nullptr;
+            if (texture && getFormatInfo(texture->getDesc().format).isInteger()) {
+                const GLuint clearValue[4] = {
+                    static_cast<GLuint>(ops.clearValue.r), static_cast<GLuint>(ops.clearValue.g),
+                    static_cast<GLuint>(ops.clearValue.b), static_cast<GLuint>(ops.clearValue.a) };
+                glClearNamedFramebufferuiv(fbo, GL_COLOR, static_cast<GLint>(i), clearValue);
+            }
+            else {
+                glClearNamedFramebufferfv(fbo, GL_COLOR, static_cast<GLint>(i), &ops.clearValue[0]);
+            }
+        }
+
+        const auto& ds = m_desc.depthStencilAttachment;
+        bool clearDepth = hasDepthAttachment() && ds.depthLoadAction == LoadAction::Clear;
+        bool clearStencil = hasStencilAttachment() && ds.stencilLoadAction == LoadAction::Clear;
+
+        if (clearDepth && clearStencil) {
+            glClearNamedFramebufferfi(fbo, GL_DEPTH_STENCIL, 0, ds.clearDepth, ds.clearStencil);
+        }
+        else if (clearDepth) {
+            glClearNamedFramebufferfv(fbo, GL_DEPTH, 0, &ds.clearDepth);
+        }
+        else if (clearStencil) {
+            glClearNamedFramebufferiv(fbo, GL_STENCIL, 0, &ds.clearStencil);
+        }
+    }
+
+    // ===== ACCIONES DE ALMACENAMIENTO =====
+
+    void RenderPassGL::resolveAttachments() const {
+        if (!m_desc.renderTarget) return;
+
+        auto* rtGL = m_desc.renderTarget->as<RenderTargetGL>();
+        const RenderTarget* destination = m_desc.resolveTarget.get();
+
+        for (uint32_t i = 0; i < colorAttachmentCount(); ++i) {
+            if (colorOps(i).storeAction == StoreAction::Resolve) {
+                rtGL->resolveColorAttachment(i, destination);
+            }
+        }
+
+        const auto& ds = m_desc.depthStencilAttachment;
+        bool resolveDepth = hasDepthAttachment() && ds.depthStoreAction == StoreAction::Resolve;
+        bool resolveStencil = hasStencilAttachment() && ds.stencilStoreAction == StoreAction::Resolve;
+        if (resolveDepth || resolveStencil) {
+            rtGL->resolveDepthStencil(resolveDepth, resolveStencil, destination);
+        }
+    }
+
+    void RenderPassGL::applyStoreActions() const {
+        // Tanto DontCare como Resolve dejan el attachment origen sin contenido til
+        auto discarded = collectAttachments(StoreAction::DontCare);
+        auto resolved = collectAttachments(StoreAction::Resolve);
+        discarded.insert(discarded.end(), resolved.begin(), resolved.end());
+
+        if (!discarded.empty()) {
+            glInvalidateNamedFramebufferData(framebufferId(), static_cast<GLsizei>(discarded.size()), discarded.data());
+        }
+    }
+
+    // ===== HELPERS =====
+
+    unsigned int RenderPassGL::framebufferId() const {
+        return m_desc.renderTarget ? static_cast<GLuint>(m_desc.renderTarget->nativeHandle()) : 0;
+    }
+
+    uint32_t RenderPassGL::colorAttachmentCount() const {
+        // El framebuffer por defecto tiene un nico buffer de color
+        return m_desc.renderTarget ? m_desc.renderTarget->getColorAttachmentCount() : 1;
+    }
+
+    bool RenderPassGL::hasDepthAttachment() const {
+        return m_desc.renderTarget ? m_desc.renderTarget->getDepthStencilAttachment() != nullptr : true;
+    }
+
+    bool RenderPassGL::hasStencilAttachment() const {
+        if (!m_desc.renderTarget) return true;
+        auto depth = m_desc.renderTarget->getDepthStencilAttachment();
+        return depth && getFormatInfo(depth->getDesc().format).hasStencil();
+    }
+
+    const ColorAttachmentOps& RenderPassGL::colorOps(uint32_t index) const {
+        static const ColorAttachmentOps defaultOps;
+        return index < m_desc.colorAttachments.size() ? m_desc.colorAttachments[index] : defaultOps;
+    }
+
+    unsigned int RenderPassGL::colorAttachmentEnum(uint32_t index) const {
+        // El framebuffer por defecto usa nombres de buffer en lugar de puntos de attachment
+        return m_desc.renderTarget ? GL_COLOR_ATTACHMENT0 + index : GL_COLOR;
+    }
+
+    std::vector<unsigned int> RenderPassGL::collectAttachments(LoadAction action) const {
+        std::vector<unsigned int> attachments;
+        for (uint32_t i = 0; i < colorAttachmentCount(); ++i) {
+            if (colorOps(i).loadAction == action) {
+                attachments.push_back(colorAttachmentEnum(i));
+            }
+        }
+        const auto& ds = m_desc.depthStencilAttachment;
+        if (hasDepthAttachment() && ds.depthLoadAction == action) {
+            attachments.push_back(m_desc.renderTarget ? GL_DEPTH_ATTACHMENT : GL_DEPTH);
+        }
+        if (hasStencilAttachment() && ds.stencilLoadAction == action) {
+            attachments.push_back(m_desc.renderTarget ? GL_STENCIL_ATTACHMENT : GL_STENCIL);
+        }
+        return attachments;
+    }
+
+    std::vector<unsigned int> RenderPassGL::collectAttachments(StoreAction action) const {
+        std::vector<unsigned int> attachments;
+        for (uint32_t i = 0; i < colorAttachmentCount(); ++i) {
+            if (colorOps(i).storeAction == action) {
+                attachments.push_back(colorAttachmentEnum(i));
+            }
+        }
+        const auto& ds = m_desc.depthStencilAttachment;
+        if (hasDepthAttachment() && ds.depthStoreAction == action) {
+            attachments.push_back(m_desc.renderTarget ? GL_DEPTH_ATTACHMENT : GL_DEPTH);
+        }
+        if (hasStencilAttachment() && ds.stencilStoreAction == action) {
+            attachments.push_back(m_desc.renderTarget ? GL_STENCIL_ATTACHMENT : GL_STENCIL);
+        }
+        return attachments;
+    }
+
 } // namespace pgrender
@@ -1,8 +1,10 @@
 #include "PGRenderCoreGL/renderTargetGL.h"
 #include "PGRenderCoreGL/textureGL.h"  // Para dinmica_pointer_cast
+#include "PGRenderCore/formatInfo.h"
 #include <GL/glew.h>
 #include <stdexcept>
 #include <iostream>
+#include <algorithm>
 
 namespace pgrender {
 
@@ -11,48 +13,65 @@ namespace pgrender {
         m_colorAttachments(desc.colorAttachments),
         m_depthStencilAttachment(desc.depthStencilAttachment)
     {
-        glGenFramebuffers(1, &m_fboId);
+        if (m_desc.sampleCount < 1) {
+            throw std::invalid_argument("Render target sample count must be at least 1");
+        }
+        for (const auto& attachment : m_colorAttachments) {
+            validateAttachment(attachment);
+        }
+        if (m_depthStencilAttachment) {
+            validateAttachment(m_depthStencilAttachment);
+        }
+
+        glCreateFramebuffers(1, &m_fboId);
         if (m_fboId == 0) {
             throw std::runtime_error("Failed to generate framebuffer");
         }
-        glBindFramebuffer(GL_FRAMEBUFFER, m_fboId);
 
         // Attach color attachments
         std::vector<GLenum> drawBuffers;
         for (size_t i = 0; i < m_colorAttachments.size(); ++i) {
             auto texGL = std::dynamic_pointer_cast<TextureGL>(m_colorAttachments[i]);
             if (!texGL) {
-                glBindFramebuffer(GL_FRAMEBUFFER, 0);
+                glDeleteFramebuffers(1, &m_fboId);
                 throw std::invalid_argument("Color attachment is not a valid TextureGL");
             }
-            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i),
-                texGL->toGLTarget(), texGL->nativeTextureId(), 0);
+            attachTexture(GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i), *texGL);
+            m_attachedColorNames.push_back(texGL->nativeTextureId());
             drawBuffers.push_back(GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i));
         }
 
         if (drawBuffers.empty()) {
             // Deshabilitar render target si no hay color
-            glDrawBuffer(GL_NONE);
-            glReadBuffer(GL_NONE);
+            glNamedFramebufferDrawBuffer(m_fboId, GL_NONE);
+            glNamedFramebufferReadBuffer(m_fboId, GL_NONE);
         }
         else {
-            glDrawBuffers(static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data());
+            glNamedFramebufferDrawBuffers(m_fboId, static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data());
         }
 
         // Attach depth/stencil if present
         if (m_depthStencilAttachment) {
             auto depthTexGL = std::dynamic_pointer_cast<TextureGL>(m_depthStencilAttachment);
             if (!depthTexGL) {
-                glBindFramebuffer(GL_FRAMEBUFFER, 0);
+                glDeleteFramebuffers(1, &m_fboId);
                 throw std::invalid_argument("DepthStencil attachment is not a valid TextureGL");
             }
-            GLenum attachPoint = GL_DEPTH_STENCIL_ATTACHMENT;
-            // Alternativamente se podran comprobar formatos para separar DEPTH_ATTACHMENT o STENCIL_ATTACHMENT
-            glFramebufferTexture2D(GL_FRAMEBUFFER, attachPoint, depthTexGL->toGLTarget(), depthTexGL->nativeTextureId(), 0);
+            // Slo los formatos con stencil se enlazan como DEPTH_STENCIL
+            m_depthStencilAttachPoint = getFormatInfo(m_depthStencilAttachment->getDesc().format).hasStencil()
+                ? GL_DEPTH_STENCIL_ATTACHMENT
+                : GL_DEPTH_ATTACHMENT;
+            attachTexture(m_depthStencilAttachPoint, *depthTexGL);
+            m_attachedDepthStencilName = depthTexGL->nativeTextureId();
         }
 
-        checkFramebufferStatus();
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        try {
+            checkFramebufferStatus();
+        }
+        catch (...) {
+            glDeleteFramebuffers(1, &m_fboId);
+            throw;
+        }
     }
 
     RenderTargetGL::~RenderTargetGL()
@@ -74,9 +93,159 @@ namespace pgrender {
         return m_depthStencilAttachment;
     }
 
+    void RenderTargetGL::resolve(const std::shared_ptr<RenderTarget>& destination, bool includeDepthStencil)
+    {
+        if (destination && destination->getBackendType() != BackendType::OpenGL) {
+            throw std::invalid_argument("Resolve destination is not an OpenGL render target");
+        }
+        if (destination.get() == this) {
+            throw std::invalid_argument("Cannot resolve a render target onto itself");
+        }
+
+        // El framebuffer por defecto slo tiene un buffer de color
+        uint32_t count = destination ? destination->getColorAttachmentCount() : 1;
+        if (count > getColorAttachmentCount()) {
+            count = getColorAttachmentCount();
+        }
+        for (uint32_t i = 0; i < count; ++i) {
+            resolveColorAttachment(i, destination.get());
+        }
+
+        if (includeDepthStencil && m_depthStencilAttachment) {
+            bool hasStencil = getFormatInfo(m_depthStencilAttachment->getDesc().format).hasStencil();
+            resolveDepthStencil(true, hasStencil, destination.get());
+        }
+    }
+
+    void RenderTargetGL::resolveColorAttachment(uint32_t index, const RenderTarget* destination) const
+    {
+        if (index >= m_colorAttachments.size()) {
+            throw std::out_of_range("Invalid color attachment index for resolve");
+        }
+
+        GLuint dstFbo = destination ? static_cast<GLuint>(destination->nativeHandle()) : 0;
+
+        // Redirigir read/draw buffer al slot a resolver
+        glNamedFramebufferReadBuffer(m_fboId, GL_COLOR_ATTACHMENT0 + index);
+        glNamedFramebufferDrawBuffer(dstFbo, dstFbo ? GL_COLOR_ATTACHMENT0 + index : GL_BACK);
+
+        blitTo(destination, GL_COLOR_BUFFER_BIT);
+
+        // Restaurar el estado de read/draw buffers configurado al crear los framebuffers
+        glNamedFramebufferReadBuffer(m_fboId, GL_COLOR_ATTACHMENT0);
+        if (dstFbo) {
+            std::vector<GLenum> drawBuffers;
+            for (uint32_t i = 0; i < destination->getColorAttachmentCount(); ++i) {
+                drawBuffers.push_back(GL_COLOR_ATTACHMENT0 + i);
+            }
+            if (drawBuffers.empty()) {
+                glNamedFramebufferDrawBuffer(dstFbo, GL_NONE);
+            }
+            else {
+                glNamedFramebufferDrawBuffers(dstFbo, static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data());
+            }
+        }
+        else {
+            glNamedFramebufferDrawBuffer(0, GL_BACK);
+        }
+    }
+
+    void RenderTargetGL::resolveDepthStencil(bool depth, bool stencil, const RenderTarget* destination) const
+    {
+        if (!m_depthStencilAttachment) {
+            throw std::runtime_error("Render target has no depth/stencil attachment to resolve");
+        }
+
+        GLbitfield mask = 0;
+        if (depth) mask |= GL_DEPTH_BUFFER_BIT;
+        if (stencil) mask |= GL_STENCIL_BUFFER_BIT;
+        if (mask != 0) {
+            blitTo(destination, mask);
+        }
+    }
+
+    void RenderTargetGL::blitTo(const RenderTarget* destination, unsigned int mask) const
+    {
+        refreshAttachments();
+        if (destination) {
+            destination->as<RenderTargetGL>()->refreshAttachments();
+        }
+
+        GLuint dstFbo = destination ? static_cast<GLuint>(destination->nativeHandle()) : 0;
+        GLint dstWidth = destination ? static_cast<GLint>(destination->getWidth()) : static_cast<GLint>(m_width);
+        GLint dstHeight = destination ? static_cast<GLint>(destination->getHeight()) : static_cast<GLint>(m_height);
+
+        bool sameSize = dstWidth == static_cast<GLint>(m_width) && dstHeight == static_cast<GLint>(m_height);
+        if (m_desc.sampleCount > 1 && !sameSize) {
+            throw std::invalid_argument("Multisample resolve requires source and destination of the same size");
+        }
+
+        // Profundidad/stencil y resolves multisample slo admiten GL_NEAREST
+        GLenum filter = (sameSize || mask != GL_COLOR_BUFFER_BIT) ? GL_NEAREST : GL_LINEAR;
+
+        glBlitNamedFramebuffer(m_fboId, dstFbo,
+            0, 0, static_cast<GLint>(m_width), static_cast<GLint>(m_height),
+            0, 0, dstWidth, dstHeight,
+            mask, filter);
+    }
+
+    void RenderTargetGL::refreshAttachments() const
+    {
+        for (size_t i = 0; i < m_colorAttachments.size(); ++i) {
+            const auto& texture = *m_colorAttachments[i]->as<TextureGL>();
+            if (texture.nativeTextureId() != m_attachedColorNames[i]) {
+                attachTexture(GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i), texture);
+                m_attachedColorNames[i] = texture.nativeTextureId();
+            }
+        }
+        if (m_depthStencilAttachment) {
+            const auto& texture = *m_depthStencilAttachment->as<TextureGL>();
+            if (texture.nativeTextureId() != m_attachedDepthStencilName) {
+                attachTexture(m_depthStencilAttachPoint, texture);
+                m_attachedDepthStencilName = texture.nativeTextureId();
+            }
+        }
+    }
+
+    void RenderTargetGL::validateAttachment(const std::shared_ptr<Texture>& texture) const
+    {
+        if (!texture) {
+            throw std::invalid_argument("Render target attachment is null");
+        }
+
+        const auto& texDesc = texture->getDesc();
+        bool multisample = texDesc.type == Texture::Type::Texture2DMultisample;
+        uint32_t samples = multisample ? texDesc.sampleCount : 1;
+
+        if (samples != m_desc.sampleCount) {
+            throw std::invalid_argument("Render target attachment sample count does not match the render target");
+        }
+
+        if (m_desc.layer >= 0 && static_cast<uint32_t>(m_desc.layer) >= layerCount(texDesc)) {
+            throw std::out_of_range("Render target layer out of range for attachment");
+        }
+    }
+
+    uint32_t RenderTargetGL::layerCount(const Texture::Desc& desc)
+    {
+        return desc.type == Texture::Type::Texture3D ? std::max<uint32_t>(desc.depth, 1) : Texture::getLayerCount(desc);
+    }
+
+    void RenderTargetGL::attachTexture(unsigned int attachment, const TextureGL& texture) const
+    {
+        const auto& texDesc = texture.getDesc();
+        const bool layered = layerCount(texDesc) > 1;
+        if (layered && m_desc.layer >= 0) {
+            glNamedFramebufferTextureLayer(m_fboId, attachment, texture.nativeTextureId(), 0, m_desc.layer);
+        }
+        else {
+            glNamedFramebufferTexture(m_fboId, attachment, texture.nativeTextureId(), 0);
+        }
+    }
+
     void RenderTargetGL::checkFramebufferStatus() const
     {
-        GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+        GLenum status = glCheckNamedFramebufferStatus(m_fboId, GL_FRAMEBUFFER);
         if (status != GL_FRAMEBUFFER_COMPLETE) {
             std::string errorStr = "Framebuffer incomplete: ";
             switch (status) {
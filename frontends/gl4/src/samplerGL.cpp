@@ -1,13 +1,18 @@
 #include "PGRenderCoreGL/samplerGL.h"
 #include <GL/glew.h>  // Solo aqu
+#include <atomic>
 #include <stdexcept>
 
 namespace pgrender {
 
-    SamplerGL::SamplerGL(const Desc& desc)
-        : m_desc(desc), m_samplerId(0)
+    namespace {
+        std::atomic<uint64_t> g_nextSamplerUniqueId{ 1 };
+    }
+
+    SamplerGL::SamplerGL(const Desc& desc, std::weak_ptr<DeferredReleaseGL> deferredRelease)
+        : m_desc(desc), m_samplerId(0), m_uniqueId(g_nextSamplerUniqueId++), m_deferredRelease(std::move(deferredRelease))
     {
-        glGenSamplers(1, reinterpret_cast<GLuint*>(&m_samplerId));
+        glCreateSamplers(1, reinterpret_cast<GLuint*>(&m_samplerId));
         if (m_samplerId == 0) {
             throw std::runtime_error("Failed to generate OpenGL sampler");
         }
@@ -39,8 +44,7 @@ namespace pgrender {
     SamplerGL::~SamplerGL()
     {
         if (m_samplerId != 0) {
-            GLuint id = static_cast<GLuint>(m_samplerId);
-            glDeleteSamplers(1, &id);
+            DeferredReleaseGL::release(m_deferredRelease, DeferredReleaseGL::ObjectType::Sampler, m_samplerId);
             m_samplerId = 0;
         }
     }
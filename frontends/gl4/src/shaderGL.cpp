@@ -1,12 +1,142 @@
 #include "PGRenderCoreGL/shaderGL.h"
+#include "PGRenderCoreGL/shaderObjectCacheGL.h"
 #include <GL/glew.h> // Solo aqu
 #include <vector>
 #include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <atomic>
 
 namespace pgrender {
 
-    ShaderGL::ShaderGL(const Program::Desc& desc)
-        : m_desc(desc), m_programId(0), m_lastError()
+    namespace {
+
+        struct GLTypeInfo {
+            ProgramReflection::BaseType baseType;
+            uint32_t columns;
+            uint32_t rows;
+        };
+
+        GLTypeInfo describeGLType(GLenum type) {
+            using BaseType = ProgramReflection::BaseType;
+            switch (type) {
+            case GL_FLOAT: return { BaseType::Float, 1, 1 };
+            case GL_FLOAT_VEC2: return { BaseType::Float, 1, 2 };
+            case GL_FLOAT_VEC3: return { BaseType::Float, 1, 3 };
+            case GL_FLOAT_VEC4: return { BaseType::Float, 1, 4 };
+            case GL_DOUBLE: return { BaseType::Double, 1, 1 };
+            case GL_DOUBLE_VEC2: return { BaseType::Double, 1, 2 };
+            case GL_DOUBLE_VEC3: return { BaseType::Double, 1, 3 };
+            case GL_DOUBLE_VEC4: return { BaseType::Double, 1, 4 };
+            case GL_INT: return { BaseType::Int, 1, 1 };
+            case GL_INT_VEC2: return { BaseType::Int, 1, 2 };
+            case GL_INT_VEC3: return { BaseType::Int, 1, 3 };
+            case GL_INT_VEC4: return { BaseType::Int, 1, 4 };
+            case GL_UNSIGNED_INT: return { BaseType::UInt, 1, 1 };
+            case GL_UNSIGNED_INT_VEC2: return { BaseType::UInt, 1, 2 };
+            case GL_UNSIGNED_INT_VEC3: return { BaseType::UInt, 1, 3 };
+            case GL_UNSIGNED_INT_VEC4: return { BaseType::UInt, 1, 4 };
+            case GL_BOOL: return { BaseType::Bool, 1, 1 };
+            case GL_BOOL_VEC2: return { BaseType::Bool, 1, 2 };
+            case GL_BOOL_VEC3: return { BaseType::Bool, 1, 3 };
+            case GL_BOOL_VEC4: return { BaseType::Bool, 1, 4 };
+            // Matrices: GL_FLOAT_MATCxR tiene C columnas y R filas
+            case GL_FLOAT_MAT2: return { BaseType::Float, 2, 2 };
+            case GL_FLOAT_MAT3: return { BaseType::Float, 3, 3 };
+            case GL_FLOAT_MAT4: return { BaseType::Float, 4, 4 };
+            case GL_FLOAT_MAT2x3: return { BaseType::Float, 2, 3 };
+            case GL_FLOAT_MAT2x4: return { BaseType::Float, 2, 4 };
+            case GL_FLOAT_MAT3x2: return { BaseType::Float, 3, 2 };
+            case GL_FLOAT_MAT3x4: return { BaseType::Float, 3, 4 };
+            case GL_FLOAT_MAT4x2: return { BaseType::Float, 4, 2 };
+            case GL_FLOAT_MAT4x3: return { BaseType::Float, 4, 3 };
+            case GL_DOUBLE_MAT2: return { BaseType::Double, 2, 2 };
+            case GL_DOUBLE_MAT3: return { BaseType::Double, 3, 3 };
+            case GL_DOUBLE_MAT4: return { BaseType::Double, 4, 4 };
+            case GL_SAMPLER_1D: case GL_SAMPLER_2D: case GL_SAMPLER_3D: case GL_SAMPLER_CUBE:
+            case GL_SAMPLER_1D_SHADOW: case GL_SAMPLER_2D_SHADOW: case GL_SAMPLER_CUBE_SHADOW:
+            case GL_SAMPLER_1D_ARRAY: case GL_SAMPLER_2D_ARRAY: case GL_SAMPLER_CUBE_MAP_ARRAY:
+            case GL_SAMPLER_1D_ARRAY_SHADOW: case GL_SAMPLER_2D_ARRAY_SHADOW: case GL_SAMPLER_CUBE_MAP_ARRAY_SHADOW:
+            case GL_SAMPLER_2D_MULTISAMPLE: case GL_SAMPLER_2D_MULTISAMPLE_ARRAY:
+            case GL_SAMPLER_BUFFER: case GL_SAMPLER_2D_RECT: case GL_SAMPLER_2D_RECT_SHADOW:
+            case GL_INT_SAMPLER_1D: case GL_INT_SAMPLER_2D: case GL_INT_SAMPLER_3D: case GL_INT_SAMPLER_CUBE:
+            case GL_INT_SAMPLER_1D_ARRAY: case GL_INT_SAMPLER_2D_ARRAY: case GL_INT_SAMPLER_CUBE_MAP_ARRAY:
+            case GL_INT_SAMPLER_2D_MULTISAMPLE: case GL_INT_SAMPLER_2D_MULTISAMPLE_ARRAY:
+            case GL_INT_SAMPLER_BUFFER: case GL_INT_SAMPLER_2D_RECT:
+            case GL_UNSIGNED_INT_SAMPLER_1D: case GL_UNSIGNED_INT_SAMPLER_2D: case GL_UNSIGNED_INT_SAMPLER_3D:
+            case GL_UNSIGNED_INT_SAMPLER_CUBE: case GL_UNSIGNED_INT_SAMPLER_1D_ARRAY: case GL_UNSIGNED_INT_SAMPLER_2D_ARRAY:
+            case GL_UNSIGNED_INT_SAMPLER_CUBE_MAP_ARRAY: case GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE:
+            case GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY: case GL_UNSIGNED_INT_SAMPLER_BUFFER:
+            case GL_UNSIGNED_INT_SAMPLER_2D_RECT:
+                return { BaseType::Sampler, 1, 1 };
+            default:
+                // Los tipos image* ocupan un rango contiguo de enumerados
+                if (type >= GL_IMAGE_1D && type <= GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE_ARRAY) {
+                    return { BaseType::Image, 1, 1 };
+                }
+                return { BaseType::Unknown, 1, 1 };
+            }
+        }
+
+        std::string resourceName(GLuint program, GLenum programInterface, GLuint index, GLint length) {
+            std::string name(static_cast<size_t>(std::max(length, 1)), '\0');
+            glGetProgramResourceName(program, programInterface, index, length, nullptr, name.data());
+            name.resize(std::strlen(name.c_str()));
+            // Los arrays se enumeran como "nombre[0]"
+            if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0) {
+                name.resize(name.size() - 3);
+            }
+            return name;
+        }
+
+        GLint activeResources(GLuint program, GLenum programInterface) {
+            GLint count = 0;
+            glGetProgramInterfaceiv(program, programInterface, GL_ACTIVE_RESOURCES, &count);
+            return count;
+        }
+
+        // Bloques (UBO o SSBO) con sus miembros, enumerados en el orden de ndice de GL
+        std::vector<ProgramReflection::Block> reflectBlocks(GLuint program, GLenum blockInterface) {
+            std::vector<ProgramReflection::Block> blocks(activeResources(program, blockInterface));
+            const GLenum props[] = { GL_NAME_LENGTH, GL_BUFFER_BINDING, GL_BUFFER_DATA_SIZE };
+            for (GLuint i = 0; i < blocks.size(); ++i) {
+                GLint values[3] = {};
+                glGetProgramResourceiv(program, blockInterface, i, 3, props, 3, nullptr, values);
+                blocks[i].name = resourceName(program, blockInterface, i, values[0]);
+                blocks[i].hash = hashName(blocks[i].name);
+                blocks[i].binding = static_cast<uint32_t>(values[1]);
+                blocks[i].dataSize = static_cast<uint32_t>(values[2]);
+            }
+            return blocks;
+        }
+
+        // Variables con layout de buffer (GL_UNIFORM o GL_BUFFER_VARIABLE); devuelve su ndice de bloque
+        GLint reflectVariable(GLuint program, GLenum variableInterface, GLuint index, ProgramReflection::Uniform& out) {
+            const GLenum props[] = { GL_NAME_LENGTH, GL_TYPE, GL_ARRAY_SIZE, GL_BLOCK_INDEX,
+                GL_OFFSET, GL_ARRAY_STRIDE, GL_MATRIX_STRIDE, GL_IS_ROW_MAJOR };
+            GLint values[8] = {};
+            glGetProgramResourceiv(program, variableInterface, index, 8, props, 8, nullptr, values);
+
+            const GLTypeInfo type = describeGLType(static_cast<GLenum>(values[1]));
+            out.name = resourceName(program, variableInterface, index, values[0]);
+            out.hash = hashName(out.name);
+            out.baseType = type.baseType;
+            out.columns = type.columns;
+            out.rows = type.rows;
+            out.arraySize = static_cast<uint32_t>(std::max(values[2], 1));
+            out.offset = values[4] >= 0 ? static_cast<uint32_t>(values[4]) : 0;
+            out.arrayStride = static_cast<uint32_t>(std::max(values[5], 0));
+            out.matrixStride = static_cast<uint32_t>(std::max(values[6], 0));
+            out.rowMajor = values[7] != 0;
+            return values[3];
+        }
+
+        std::atomic<uint64_t> s_linkCounter{ 0 };
+
+    } // namespace
+
+    ShaderGL::ShaderGL(const Program::Desc& desc, ShaderObjectCacheGL* shaderCache)
+        : m_desc(desc), m_programId(0), m_shaderCache(shaderCache), m_lastError()
     {}
 
     ShaderGL::~ShaderGL() {
@@ -14,16 +144,23 @@ namespace pgrender {
     }
 
     bool ShaderGL::compile() {
-        m_lastError.clear();
+        // Compilacin sncrona: lanzar y esperar el resultado
+        if (!beginCompile()) {
+            return false;
+        }
+        return finishCompile();
+    }
 
+    bool ShaderGL::beginCompile() {
         if (m_programId != 0) {
             release();
         }
+        m_lastError.clear();
 
         m_programId = glCreateProgram();
         if (m_programId == 0) {
             m_lastError = "Failed to create GL program";
-            return false;
+            return fail();
         }
 
         // Establecer label para debugging si se proporciona
@@ -31,19 +168,60 @@ namespace pgrender {
             glObjectLabel(GL_PROGRAM, m_programId, -1, m_desc.debugName);
         }
 
+        // No se consulta el estado de cada etapa aqu: con parallel_shader_compile el driver
+        // compila y enlaza en segundo plano hasta que se pregunta por el resultado
         for (const auto& stageSource : m_desc.stages) {
             unsigned int glType = shaderTypeToGL(stageSource.stage);
-            unsigned int shader = 0;
-            if (!compileShaderStage(glType, stageSource.source, shader)) {
+            AttachedShader attached;
+            if (!acquireShaderStage(glType, stageSource, attached)) {
                 // Error ya almacenado en m_lastError
-                release();
-                return false;
+                return fail();
             }
-            glAttachShader(m_programId, shader);
-            m_shaderObjects[glType] = shader;
+            glAttachShader(m_programId, attached.shader);
+            m_shaderObjects[glType] = attached;
+        }
+
+        if (m_desc.separable) {
+            glProgramParameteri(m_programId, GL_PROGRAM_SEPARABLE, GL_TRUE);
         }
 
         glLinkProgram(m_programId);
+        m_compileStatus = CompileStatus::Pending;
+        return true;
+    }
+
+    Program::CompileStatus ShaderGL::pollCompileStatus() {
+        if (m_compileStatus != CompileStatus::Pending) {
+            return m_compileStatus;
+        }
+
+        if (GLEW_ARB_parallel_shader_compile || GLEW_KHR_parallel_shader_compile) {
+            GLint completed = GL_FALSE;
+            glGetProgramiv(m_programId, GL_COMPLETION_STATUS_ARB, &completed);
+            if (completed != GL_TRUE) {
+                return CompileStatus::Pending;
+            }
+        }
+
+        finishCompile();
+        return m_compileStatus;
+    }
+
+    bool ShaderGL::finishCompile() {
+        if (m_compileStatus != CompileStatus::Pending) {
+            return m_compileStatus == CompileStatus::Ready;
+        }
+
+        for (const auto& shaderPair : m_shaderObjects) {
+            const AttachedShader& attached = shaderPair.second;
+            if (!checkShaderStage(attached.shader)) {
+                // No dejar en la cach una etapa que no compila
+                if (attached.cached && m_shaderCache) {
+                    m_shaderCache->evict(attached.cacheKey, *attached.cached);
+                }
+                return fail();
+            }
+        }
 
         GLint linkStatus = GL_FALSE;
         glGetProgramiv(m_programId, GL_LINK_STATUS, &linkStatus);
@@ -58,12 +236,14 @@ namespace pgrender {
             else {
                 m_lastError = "Unknown program link error";
             }
-            release();
-            return false;
+            return fail();
         }
 
         // Detach shaders (ya no son necesarios despus del link)
         detachAndDeleteShaders();
+        captureReflection();
+        m_linkSerial = ++s_linkCounter;
+        m_compileStatus = CompileStatus::Ready;
         return true;
     }
 
@@ -72,23 +252,92 @@ namespace pgrender {
             glDeleteProgram(m_programId);
             m_programId = 0;
         }
+        // Borrar el programa ya desadjunta sus etapas; las de la cach se borran al soltar
+        // la ltima referencia
         for (auto& shaderPair : m_shaderObjects) {
-            glDeleteShader(shaderPair.second);
+            if (!shaderPair.second.cached) {
+                glDeleteShader(shaderPair.second.shader);
+            }
         }
         m_shaderObjects.clear();
+        m_cachedStages.clear();
         m_lastError.clear();
+        m_reflection = ProgramReflection();
+        m_compileStatus = CompileStatus::NotCompiled;
+        m_linkSerial = 0;
     }
 
-    bool ShaderGL::compileShaderStage(unsigned int shaderType, const std::string& source, unsigned int& outShader) {
+    bool ShaderGL::fail() {
+        // release() borra el error: conservarlo para getLastError()
+        std::string error = std::move(m_lastError);
+        release();
+        m_lastError = std::move(error);
+        m_compileStatus = CompileStatus::Failed;
+        return false;
+    }
+
+    bool ShaderGL::acquireShaderStage(unsigned int shaderType, const ShaderSource& stageSource, AttachedShader& outShader) {
+        if (!m_shaderCache) {
+            return createShaderStage(shaderType, stageSource, outShader.shader);
+        }
+
+        // El hash incluye la etapa: fuentes idnticas en etapas distintas no se confunden
+        outShader.cacheKey = stageSource.contentHash();
+        outShader.cached = m_shaderCache->find(outShader.cacheKey, stageSource);
+        if (!outShader.cached) {
+            unsigned int shader = 0;
+            if (!createShaderStage(shaderType, stageSource, shader)) {
+                return false;
+            }
+            outShader.cached = m_shaderCache->insert(outShader.cacheKey, stageSource, shader);
+        }
+        outShader.shader = outShader.cached->getShader();
+        return true;
+    }
+
+    bool ShaderGL::createShaderStage(unsigned int shaderType, const ShaderSource& stageSource, unsigned int& outShader) {
+        if (stageSource.isSpirv() && !(GLEW_VERSION_4_6 || GLEW_ARB_gl_spirv)) {
+            m_lastError = "SPIR-V shaders are not supported (requires GL 4.6 or GL_ARB_gl_spirv)";
+            return false;
+        }
+
         GLuint shader = glCreateShader(shaderType);
         if (shader == 0) {
             m_lastError = "Failed to create shader object";
             return false;
         }
-        const char* src = source.c_str();
-        glShaderSource(shader, 1, &src, nullptr);
-        glCompileShader(shader);
 
+        if (stageSource.isSpirv()) {
+            // El mdulo ya est compilado: glSpecializeShader slo elige el punto de entrada
+            // y fija las constantes; el resultado se consulta con GL_COMPILE_STATUS
+            glShaderBinary(1, &shader, GL_SHADER_BINARY_FORMAT_SPIR_V_ARB, stageSource.spirv.data(),
+                static_cast<GLsizei>(stageSource.spirv.size() * sizeof(uint32_t)));
+
+            std::vector<GLuint> constantIds;
+            std::vector<GLuint> constantValues;
+            for (const auto& constant : stageSource.specializationConstants) {
+                constantIds.push_back(constant.id);
+                constantValues.push_back(constant.value);
+            }
+            const GLuint constantCount = static_cast<GLuint>(constantIds.size());
+            if (GLEW_VERSION_4_6) {
+                glSpecializeShader(shader, stageSource.entryPoint.c_str(), constantCount, constantIds.data(), constantValues.data());
+            }
+            else {
+                glSpecializeShaderARB(shader, stageSource.entryPoint.c_str(), constantCount, constantIds.data(), constantValues.data());
+            }
+        }
+        else {
+            const char* src = stageSource.source.c_str();
+            glShaderSource(shader, 1, &src, nullptr);
+            glCompileShader(shader);
+        }
+
+        outShader = shader;
+        return true;
+    }
+
+    bool ShaderGL::checkShaderStage(unsigned int shader) {
         GLint compileStatus = GL_FALSE;
         glGetShaderiv(shader, GL_COMPILE_STATUS, &compileStatus);
         if (compileStatus != GL_TRUE) {
@@ -102,22 +351,163 @@ namespace pgrender {
             else {
                 m_lastError = "Unknown shader compile error";
             }
-            glDeleteShader(shader);
             return false;
         }
-
-        outShader = shader;
         return true;
     }
 
     void ShaderGL::detachAndDeleteShaders() {
-        for (const auto& shaderPair : m_shaderObjects) {
-            glDetachShader(m_programId, shaderPair.second);
-            glDeleteShader(shaderPair.second);
+        for (auto& shaderPair : m_shaderObjects) {
+            glDetachShader(m_programId, shaderPair.second.shader);
+            if (shaderPair.second.cached) {
+                // La referencia se mantiene mientras el programa siga enlazado
+                m_cachedStages.push_back(std::move(shaderPair.second.cached));
+            }
+            else {
+                glDeleteShader(shaderPair.second.shader);
+            }
         }
         m_shaderObjects.clear();
     }
 
+    void ShaderGL::captureReflection() {
+        // La consulta de interfaces del programa es core desde GL 4.3
+        if (!(GLEW_VERSION_4_3 || GLEW_ARB_program_interface_query)) {
+            m_reflection = ProgramReflection();
+            return;
+        }
+
+        const GLuint program = static_cast<GLuint>(m_programId);
+        std::vector<ProgramReflection::Uniform> uniforms;
+        auto uniformBlocks = reflectBlocks(program, GL_UNIFORM_BLOCK);
+        auto storageBlocks = reflectBlocks(program, GL_SHADER_STORAGE_BLOCK);
+
+        const GLint uniformCount = activeResources(program, GL_UNIFORM);
+        for (GLint i = 0; i < uniformCount; ++i) {
+            ProgramReflection::Uniform uniform;
+            const GLint blockIndex = reflectVariable(program, GL_UNIFORM, static_cast<GLuint>(i), uniform);
+            if (blockIndex >= 0) {
+                // Miembro de un bloque: no tiene location propia
+                if (static_cast<size_t>(blockIndex) < uniformBlocks.size()) {
+                    uniform.location = -1;
+                    uniformBlocks[blockIndex].members.push_back(std::move(uniform));
+                }
+                continue;
+            }
+
+            const GLenum locationProp = GL_LOCATION;
+            glGetProgramResourceiv(program, GL_UNIFORM, static_cast<GLuint>(i), 1, &locationProp, 1, nullptr, &uniform.location);
+            if (uniform.location >= 0 &&
+                (uniform.baseType == ProgramReflection::BaseType::Sampler || uniform.baseType == ProgramReflection::BaseType::Image)) {
+                // Unidad asignada con layout(binding = N) o con glProgramUniform1i
+                GLint unit = 0;
+                glGetUniformiv(program, uniform.location, &unit);
+                uniform.binding = static_cast<uint32_t>(unit);
+            }
+            uniforms.push_back(std::move(uniform));
+        }
+
+        const GLint bufferVariableCount = activeResources(program, GL_BUFFER_VARIABLE);
+        for (GLint i = 0; i < bufferVariableCount; ++i) {
+            ProgramReflection::Uniform variable;
+            const GLint blockIndex = reflectVariable(program, GL_BUFFER_VARIABLE, static_cast<GLuint>(i), variable);
+            if (blockIndex >= 0 && static_cast<size_t>(blockIndex) < storageBlocks.size()) {
+                storageBlocks[blockIndex].members.push_back(std::move(variable));
+            }
+        }
+
+        // Entradas del vertex shader; las variables gl_* no tienen location
+        std::vector<ProgramReflection::VertexInput> vertexInputs;
+        const bool hasVertexStage = std::any_of(m_desc.stages.begin(), m_desc.stages.end(),
+            [](const ShaderSource& stage) { return stage.stage == ShaderStage::Vertex; });
+        const GLint inputCount = hasVertexStage ? activeResources(program, GL_PROGRAM_INPUT) : 0;
+        for (GLint i = 0; i < inputCount; ++i) {
+            const GLenum props[] = { GL_NAME_LENGTH, GL_TYPE, GL_ARRAY_SIZE, GL_LOCATION };
+            GLint values[4] = {};
+            glGetProgramResourceiv(program, GL_PROGRAM_INPUT, static_cast<GLuint>(i), 4, props, 4, nullptr, values);
+            if (values[3] < 0) {
+                continue;
+            }
+
+            const GLTypeInfo type = describeGLType(static_cast<GLenum>(values[1]));
+            ProgramReflection::VertexInput input;
+            input.name = resourceName(program, GL_PROGRAM_INPUT, static_cast<GLuint>(i), values[0]);
+            input.hash = hashName(input.name);
+            input.location = static_cast<uint32_t>(values[3]);
+            input.baseType = type.baseType;
+            input.components = type.rows;
+            input.locationCount = type.columns * static_cast<uint32_t>(std::max(values[2], 1));
+            vertexInputs.push_back(std::move(input));
+        }
+
+        m_reflection = ProgramReflection(std::move(uniforms), std::move(uniformBlocks),
+            std::move(storageBlocks), std::move(vertexInputs));
+    }
+
+    // ===== UNIFORMS =====
+
+    void ShaderGL::setUniform(int32_t location, float value) {
+        if (location >= 0) glProgramUniform1f(static_cast<GLuint>(m_programId), location, value);
+    }
+
+    void ShaderGL::setUniform(int32_t location, int32_t value) {
+        if (location >= 0) glProgramUniform1i(static_cast<GLuint>(m_programId), location, value);
+    }
+
+    void ShaderGL::setUniform(int32_t location, uint32_t value) {
+        if (location >= 0) glProgramUniform1ui(static_cast<GLuint>(m_programId), location, value);
+    }
+
+    void ShaderGL::setUniform(int32_t location, const glm::vec2& value) {
+        if (location >= 0) glProgramUniform2fv(static_cast<GLuint>(m_programId), location, 1, &value[0]);
+    }
+
+    void ShaderGL::setUniform(int32_t location, const glm::vec3& value) {
+        if (location >= 0) glProgramUniform3fv(static_cast<GLuint>(m_programId), location, 1, &value[0]);
+    }
+
+    void ShaderGL::setUniform(int32_t location, const glm::vec4& value) {
+        if (location >= 0) glProgramUniform4fv(static_cast<GLuint>(m_programId), location, 1, &value[0]);
+    }
+
+    void ShaderGL::setUniform(int32_t location, const glm::mat3& value) {
+        if (location >= 0) glProgramUniformMatrix3fv(static_cast<GLuint>(m_programId), location, 1, GL_FALSE, &value[0][0]);
+    }
+
+    void ShaderGL::setUniform(int32_t location, const glm::mat4& value) {
+        if (location >= 0) glProgramUniformMatrix4fv(static_cast<GLuint>(m_programId), location, 1, GL_FALSE, &value[0][0]);
+    }
+
+    void ShaderGL::setUniform(int32_t location, const glm::vec4* values, uint32_t count) {
+        if (location >= 0 && count > 0) {
+            glProgramUniform4fv(static_cast<GLuint>(m_programId), location, static_cast<GLsizei>(count), &values[0][0]);
+        }
+    }
+
+    void ShaderGL::setUniform(int32_t location, const glm::mat4* values, uint32_t count) {
+        if (location >= 0 && count > 0) {
+            glProgramUniformMatrix4fv(static_cast<GLuint>(m_programId), location, static_cast<GLsizei>(count), GL_FALSE, &values[0][0][0]);
+        }
+    }
+
+    void ShaderGL::adopt(Program& other) {
+        if (other.getBackendType() != BackendType::OpenGL || other.getCompileStatus() != CompileStatus::Ready) {
+            throw std::invalid_argument("Can only adopt a compiled OpenGL program");
+        }
+
+        auto& source = *other.as<ShaderGL>();
+        std::swap(m_desc, source.m_desc);
+        std::swap(m_programId, source.m_programId);
+        std::swap(m_shaderCache, source.m_shaderCache);
+        std::swap(m_shaderObjects, source.m_shaderObjects);
+        std::swap(m_cachedStages, source.m_cachedStages);
+        std::swap(m_lastError, source.m_lastError);
+        std::swap(m_reflection, source.m_reflection);
+        std::swap(m_compileStatus, source.m_compileStatus);
+        // El nmero de enlace cambia: los program pipelines que lo usaban se resuelven de nuevo
+        std::swap(m_linkSerial, source.m_linkSerial);
+    }
+
     std::string ShaderGL::getLastError() const {
         return m_lastError;
     }
@@ -0,0 +1,60 @@
+#include "PGRenderCoreGL/shaderObjectCacheGL.h"
+#include <GL/glew.h> // Solo aquí
+#include <algorithm>
+
+namespace pgrender {
+
+    CachedShaderGL::~CachedShaderGL() {
+        glDeleteShader(m_shader);
+    }
+
+    std::shared_ptr<CachedShaderGL> ShaderObjectCacheGL::find(uint64_t key, const ShaderSource& source) {
+        auto it = m_stages.find(key);
+        if (it == m_stages.end()) {
+            return nullptr;
+        }
+        auto stage = it->second.lock();
+        if (!stage) {
+            m_stages.erase(it);
+            return nullptr;
+        }
+        return stage->getSource() == source ? stage : nullptr;
+    }
+
+    std::shared_ptr<CachedShaderGL> ShaderObjectCacheGL::insert(uint64_t key, const ShaderSource& source, unsigned int shader) {
+        auto stage = std::make_shared<CachedShaderGL>(source, shader);
+        auto [it, inserted] = m_stages.try_emplace(key, stage);
+        if (!inserted && it->second.expired()) {
+            it->second = stage;
+        }
+
+        // Las etapas sin programas dejan entradas caducadas: se purgan al crecer la tabla
+        if (m_stages.size() >= m_pruneThreshold) {
+            pruneExpired();
+            m_pruneThreshold = std::max<size_t>(64, m_stages.size() * 2);
+        }
+        return stage;
+    }
+
+    void ShaderObjectCacheGL::evict(uint64_t key, const CachedShaderGL& stage) {
+        auto it = m_stages.find(key);
+        if (it != m_stages.end()) {
+            auto cached = it->second.lock();
+            if (!cached || cached.get() == &stage) {
+                m_stages.erase(it);
+            }
+        }
+    }
+
+    void ShaderObjectCacheGL::pruneExpired() {
+        for (auto it = m_stages.begin(); it != m_stages.end();) {
+            if (it->second.expired()) {
+                it = m_stages.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+} // namespace pgrender
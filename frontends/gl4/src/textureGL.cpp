@@ -1,149 +1,645 @@
 #include "PGRenderCoreGL/textureGL.h"
+#include "PGRenderCoreGL/samplerGL.h"
+#include "PGRenderCore/formatInfo.h"
 #include <GL/glew.h>  // Solo aqu
 #include <stdexcept>
 #include <cstring>
+#include <algorithm>
+#include <array>
 
 namespace pgrender {
 
-    TextureGL::TextureGL(const Desc& desc)
-        : m_desc(desc), m_textureId(0)
+    namespace {
+
+        // Formato de Texture, formato interno y formato y tipo de los datos de subida; format y
+        // type son 0 en los formatos comprimidos, que se suben con glCompressedTextureSubImage*
+        struct GLFormat {
+            Texture::Format textureFormat;
+            GLenum internalFormat;
+            GLenum format;
+            GLenum type;
+        };
+
+        using F = Texture::Format;
+
+        // Indexada por Texture::Format, en el mismo orden que kFormatTable
+        constexpr std::array<GLFormat, kFormatCount> kGLFormatTable = { {
+            { F::R8,              GL_R8,                 GL_RED,             GL_UNSIGNED_BYTE },
+            { F::RG8,             GL_RG8,                GL_RG,              GL_UNSIGNED_BYTE },
+            { F::RGB8,            GL_RGB8,               GL_RGB,             GL_UNSIGNED_BYTE },
+            { F::RGBA8,           GL_RGBA8,              GL_RGBA,            GL_UNSIGNED_BYTE },
+            { F::R16F,            GL_R16F,               GL_RED,             GL_HALF_FLOAT },
+            { F::RG16F,           GL_RG16F,              GL_RG,              GL_HALF_FLOAT },
+            { F::RGB16F,          GL_RGB16F,             GL_RGB,             GL_HALF_FLOAT },
+            { F::RGBA16F,         GL_RGBA16F,            GL_RGBA,            GL_HALF_FLOAT },
+            { F::R32F,            GL_R32F,               GL_RED,             GL_FLOAT },
+            { F::RG32F,           GL_RG32F,              GL_RG,              GL_FLOAT },
+            { F::RGB32F,          GL_RGB32F,             GL_RGB,             GL_FLOAT },
+            { F::RGBA32F,         GL_RGBA32F,            GL_RGBA,            GL_FLOAT },
+            { F::Depth24Stencil8, GL_DEPTH24_STENCIL8,   GL_DEPTH_STENCIL,   GL_UNSIGNED_INT_24_8 },
+            { F::Depth32F,        GL_DEPTH_COMPONENT32F, GL_DEPTH_COMPONENT, GL_FLOAT },
+            { F::SRGB8_A8,        GL_SRGB8_ALPHA8,       GL_RGBA,            GL_UNSIGNED_BYTE },
+            { F::RGB10_A2,        GL_RGB10_A2,           GL_RGBA,            GL_UNSIGNED_INT_2_10_10_10_REV },
+            { F::R11G11B10F,      GL_R11F_G11F_B10F,     GL_RGB,             GL_UNSIGNED_INT_10F_11F_11F_REV },
+            { F::R32UI,           GL_R32UI,              GL_RED_INTEGER,     GL_UNSIGNED_INT },
+            { F::RG16UI,          GL_RG16UI,             GL_RG_INTEGER,      GL_UNSIGNED_SHORT },
+            { F::Depth16,         GL_DEPTH_COMPONENT16,  GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT },
+            { F::Depth24,         GL_DEPTH_COMPONENT24,  GL_DEPTH_COMPONENT, GL_UNSIGNED_INT },
+            { F::BC1,             GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,            0, 0 },
+            { F::BC1_SRGB,        GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT,      0, 0 },
+            { F::BC3,             GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,            0, 0 },
+            { F::BC3_SRGB,        GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT,      0, 0 },
+            { F::BC4,             GL_COMPRESSED_RED_RGTC1,                     0, 0 },
+            { F::BC5,             GL_COMPRESSED_RG_RGTC2,                      0, 0 },
+            { F::BC6H_UF16,       GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT,       0, 0 },
+            { F::BC6H_SF16,       GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT,         0, 0 },
+            { F::BC7,             GL_COMPRESSED_RGBA_BPTC_UNORM,               0, 0 },
+            { F::BC7_SRGB,        GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM,         0, 0 },
+            { F::ETC2_RGB8,       GL_COMPRESSED_RGB8_ETC2,                     0, 0 },
+            { F::ETC2_RGB8_SRGB,  GL_COMPRESSED_SRGB8_ETC2,                    0, 0 },
+            { F::ETC2_RGBA8,      GL_COMPRESSED_RGBA8_ETC2_EAC,                0, 0 },
+            { F::ETC2_RGBA8_SRGB, GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,         0, 0 },
+            { F::ASTC_4x4,        GL_COMPRESSED_RGBA_ASTC_4x4_KHR,             0, 0 },
+            { F::ASTC_4x4_SRGB,   GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR,     0, 0 },
+            { F::ASTC_6x6,        GL_COMPRESSED_RGBA_ASTC_6x6_KHR,             0, 0 },
+            { F::ASTC_6x6_SRGB,   GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR,     0, 0 },
+            { F::ASTC_8x8,        GL_COMPRESSED_RGBA_ASTC_8x8_KHR,             0, 0 },
+            { F::ASTC_8x8_SRGB,   GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR,     0, 0 },
+        } };
+
+        constexpr bool matchesFormatTable() {
+            for (size_t i = 0; i < kFormatCount; ++i) {
+                if (kGLFormatTable[i].textureFormat != kFormatTable[i].format) {
+                    return false;
+                }
+            }
+            return kGLFormatTable.size() == kFormatTable.size();
+        }
+
+        static_assert(matchesFormatTable(), "kGLFormatTable must list every format in the order of kFormatTable");
+
+    } // namespace
+
+    TextureGL::TextureGL(const Desc& desc, std::weak_ptr<DeferredReleaseGL> deferredRelease)
+        : m_desc(desc), m_textureId(0), m_deferredRelease(std::move(deferredRelease))
     {
-        glGenTextures(1, reinterpret_cast<GLuint*>(&m_textureId));
+        if (isCompressedFormat(m_desc.format) &&
+            (m_desc.type == Type::Texture1D || m_desc.type == Type::Texture2DMultisample ||
+             m_desc.type == Type::TextureBuffer || m_desc.storageTexture)) {
+            throw std::invalid_argument("Compressed formats require a sampled 2D, 3D, cubemap or array texture");
+        }
+
+        if (m_desc.mipmapped) {
+            if (isCompressedFormat(m_desc.format)) {
+                throw std::invalid_argument("Mipmaps of compressed textures cannot be generated on the GPU");
+            }
+            // Sin niveles explcitos se reserva la cadena completa para que haya dnde generarlos
+            if (m_desc.mipLevels <= 1 && m_desc.type != Type::Texture2DMultisample && m_desc.type != Type::TextureBuffer) {
+                uint32_t largest = std::max({ m_desc.width, m_desc.height, m_desc.type == Type::Texture3D ? m_desc.depth : 1u });
+                uint16_t levels = 1;
+                while (largest > 1) {
+                    largest >>= 1;
+                    ++levels;
+                }
+                m_desc.mipLevels = levels;
+            }
+        }
+
+        if (isArrayType()) {
+            GLint maxLayers = 0;
+            glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+            if (m_desc.arrayLayers < 1 || getLayerCount(m_desc) > static_cast<uint32_t>(maxLayers)) {
+                throw std::invalid_argument("Unsupported texture array layer count");
+            }
+        }
+
+        if (m_desc.type == Type::Texture2DMultisample) {
+            GLint maxSamples = 0;
+            glGetIntegerv(GL_MAX_SAMPLES, &maxSamples);
+            if (m_desc.sampleCount < 1 || m_desc.sampleCount > static_cast<uint32_t>(maxSamples)) {
+                throw std::invalid_argument("Unsupported multisample texture sample count");
+            }
+        }
+
+        if (m_desc.sparse) {
+            if (!GLEW_ARB_sparse_texture) {
+                throw std::runtime_error("Sparse textures are not supported (GL_ARB_sparse_texture)");
+            }
+            if (m_desc.type != Type::Texture2D && m_desc.type != Type::Texture3D && m_desc.type != Type::TextureCube &&
+                !isArrayType()) {
+                throw std::invalid_argument("Sparse textures must be 2D, 3D, cubemap or array");
+            }
+        }
+
+        GLenum target = static_cast<GLenum>(toGLTarget());
+        glCreateTextures(target, 1, reinterpret_cast<GLuint*>(&m_textureId));
         if (m_textureId == 0) {
             throw std::runtime_error("Failed to generate OpenGL texture");
         }
 
-        GLenum target = static_cast<GLenum>(toGLTarget());
-        glBindTexture(target, m_textureId);
+        if (m_desc.sparse) {
+            try {
+                initSparse();
+            }
+            catch (...) {
+                glDeleteTextures(1, reinterpret_cast<GLuint*>(&m_textureId));
+                throw;
+            }
+        }
+
+        switch (m_desc.type) {
+        case Type::Texture2DMultisample:
+            glTextureStorage2DMultisample(m_textureId, m_desc.sampleCount, toGLInternalFormat(), m_desc.width, m_desc.height, GL_TRUE);
+            // Las texturas multisample no tienen mipmaps ni parmetros de muestreo
+            return;
+        case Type::TextureBuffer:
+            // No se maneja en esta funcin, requiere buffer especfico (y no admite parmetros de muestreo)
+            return;
+        default:
+            break;
+        }
+
+        if (m_desc.residentBaseLevel >= std::max<uint32_t>(m_desc.mipLevels, 1) ||
+            (m_desc.residentBaseLevel > 0 && !m_desc.sparse && !canReallocateLevels())) {
+            glDeleteTextures(1, reinterpret_cast<GLuint*>(&m_textureId));
+            throw std::invalid_argument("Invalid resident base level for this texture");
+        }
+
+        // Las texturas dispersas reservan toda la cadena virtual; el resto slo los niveles residentes
+        m_residentBaseLevel = m_desc.residentBaseLevel;
+        m_allocatedBaseLevel = m_desc.sparse ? 0 : m_residentBaseLevel;
+        try {
+            allocateStorage(m_textureId, m_allocatedBaseLevel);
+        }
+        catch (...) {
+            glDeleteTextures(1, reinterpret_cast<GLuint*>(&m_textureId));
+            throw;
+        }
+
+        if (m_desc.sparse) {
+            // Los niveles a partir de NUM_SPARSE_LEVELS forman la cola de mips
+            GLint sparseLevels = 0;
+            glGetTextureParameteriv(m_textureId, GL_NUM_SPARSE_LEVELS_ARB, &sparseLevels);
+            m_sparseMipTailStart = static_cast<uint32_t>(sparseLevels);
+        }
+
+        applySamplingParameters();
+    }
+
+    void TextureGL::allocateStorage(TextureNameGL textureId, uint32_t baseLevel) const {
+        const GLsizei levels = static_cast<GLsizei>(m_desc.mipLevels - baseLevel);
+        const GLsizei width = std::max<GLsizei>(1, static_cast<GLsizei>(m_desc.width >> baseLevel));
+        const GLsizei height = std::max<GLsizei>(1, static_cast<GLsizei>(m_desc.height >> baseLevel));
 
         switch (m_desc.type) {
         case Type::Texture1D:
-            glTexStorage1D(target, m_desc.mipLevels, toGLInternalFormat(), m_desc.width);
+            glTextureStorage1D(textureId, levels, toGLInternalFormat(), width);
             break;
         case Type::Texture2D:
         case Type::TextureCube:
-            glTexStorage2D(target, m_desc.mipLevels, toGLInternalFormat(), m_desc.width, m_desc.height);
+            glTextureStorage2D(textureId, levels, toGLInternalFormat(), width, height);
             break;
         case Type::Texture3D:
-            glTexStorage3D(target, m_desc.mipLevels, toGLInternalFormat(), m_desc.width, m_desc.height, m_desc.depth);
+            glTextureStorage3D(textureId, levels, toGLInternalFormat(), width, height,
+                std::max<GLsizei>(1, static_cast<GLsizei>(m_desc.depth >> baseLevel)));
             break;
-        case Type::TextureBuffer:
-            // No se maneja en esta funcin, requiere buffer especfico
+        case Type::Texture2DArray:
+        case Type::TextureCubeArray:
+            // Las capas no se reducen con el nivel MIP; en arrays de cubemaps depth cuenta caras
+            glTextureStorage3D(textureId, levels, toGLInternalFormat(), width, height,
+                static_cast<GLsizei>(getLayerCount(m_desc)));
             break;
         default:
             throw std::runtime_error("Unsupported texture type");
         }
+    }
 
-        if (m_desc.mipmapped && m_desc.mipLevels == 1) {
-            glGenerateMipmap(target);
+    void TextureGL::applySamplingParameters() const {
+        // Los formatos enteros no admiten filtrado lineal: con GL_LINEAR la textura queda incompleta
+        if (hasFeatures(getFormatInfo(m_desc.format).features, FormatFeatures::Filterable)) {
+            glTextureParameteri(m_textureId, GL_TEXTURE_MIN_FILTER, m_desc.mipmapped ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+            glTextureParameteri(m_textureId, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         }
-
-        glTexParameteri(target, GL_TEXTURE_MIN_FILTER, m_desc.mipmapped ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
-        glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(target, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(target, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        else {
+            glTextureParameteri(m_textureId, GL_TEXTURE_MIN_FILTER, m_desc.mipmapped ? GL_NEAREST_MIPMAP_NEAREST : GL_NEAREST);
+            glTextureParameteri(m_textureId, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        }
+        glTextureParameteri(m_textureId, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(m_textureId, GL_TEXTURE_WRAP_T, GL_REPEAT);
         if (m_desc.type == Type::Texture3D) {
-            glTexParameteri(target, GL_TEXTURE_WRAP_R, GL_REPEAT);
+            glTextureParameteri(m_textureId, GL_TEXTURE_WRAP_R, GL_REPEAT);
         }
 
-        glBindTexture(target, 0);
+        // En texturas reasignadas el nivel 0 del objeto GL ya es el nivel residente
+        const uint32_t baseLevel = m_residentBaseLevel - m_allocatedBaseLevel;
+        glTextureParameteri(m_textureId, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(baseLevel));
+        glTextureParameterf(m_textureId, GL_TEXTURE_MIN_LOD, static_cast<GLfloat>(baseLevel));
+        glTextureParameterf(m_textureId, GL_TEXTURE_LOD_BIAS, m_lodBias);
+    }
+
+    uint32_t TextureGL::toAllocatedLevel(uint32_t mipLevel) const {
+        if (mipLevel < m_allocatedBaseLevel) {
+            throw std::out_of_range("Texture mip level is not resident");
+        }
+        return mipLevel - m_allocatedBaseLevel;
+    }
+
+    void TextureGL::setResidentBaseLevel(uint32_t baseLevel) {
+        if (baseLevel >= std::max<uint32_t>(m_desc.mipLevels, 1)) {
+            throw std::out_of_range("Invalid resident base level");
+        }
+        if (baseLevel == m_residentBaseLevel) {
+            return;
+        }
+        // ARB_bindless_texture fija el estado de la textura al crear el primer handle
+        if (m_hasBindlessHandles) {
+            throw std::runtime_error("Cannot change the resident base level of a texture with bindless handles");
+        }
+
+        if (m_desc.sparse) {
+            m_residentBaseLevel = baseLevel;
+            applySamplingParameters();
+            return;
+        }
+
+        if (!canReallocateLevels()) {
+            throw std::runtime_error("Resident base level can only change on 2D, cubemap and array textures");
+        }
+
+        GLenum target = static_cast<GLenum>(toGLTarget());
+        GLuint newTextureId = 0;
+        glCreateTextures(target, 1, &newTextureId);
+        if (newTextureId == 0) {
+            throw std::runtime_error("Failed to generate OpenGL texture");
+        }
+        allocateStorage(newTextureId, baseLevel);
+
+        // Copiar los niveles residentes en ambas asignaciones
+        const GLsizei layers = static_cast<GLsizei>(getLayerCount(m_desc));
+        for (uint32_t mip = std::max(baseLevel, m_allocatedBaseLevel); mip < m_desc.mipLevels; ++mip) {
+            glCopyImageSubData(m_textureId, target, static_cast<GLint>(mip - m_allocatedBaseLevel), 0, 0, 0,
+                newTextureId, target, static_cast<GLint>(mip - baseLevel), 0, 0, 0,
+                std::max<GLsizei>(1, static_cast<GLsizei>(m_desc.width >> mip)),
+                std::max<GLsizei>(1, static_cast<GLsizei>(m_desc.height >> mip)),
+                layers);
+        }
+
+        // El nombre nuevo se asigna antes de liberar el anterior: al recibir la liberacin el
+        // contexto ve que la textura sigue viva y revincula sus unidades al nombre nuevo
+        const TextureNameGL oldTextureId = m_textureId;
+        m_textureId = newTextureId;
+        DeferredReleaseGL::release(m_deferredRelease, DeferredReleaseGL::ObjectType::Texture, oldTextureId);
+
+        m_allocatedBaseLevel = baseLevel;
+        m_residentBaseLevel = baseLevel;
+        applySamplingParameters();
+    }
+
+    void TextureGL::setLodBias(float bias) {
+        if (m_hasBindlessHandles) {
+            throw std::runtime_error("Cannot change the LOD bias of a texture with bindless handles");
+        }
+        m_lodBias = bias;
+        if (m_desc.type != Type::Texture2DMultisample && m_desc.type != Type::TextureBuffer) {
+            glTextureParameterf(m_textureId, GL_TEXTURE_LOD_BIAS, bias);
+        }
     }
 
     TextureGL::~TextureGL() {
+        for (const auto& bindless : m_bindlessHandles) {
+            if (bindless.resident) {
+                glMakeTextureHandleNonResidentARB(bindless.handle);
+            }
+        }
+        m_bindlessHandles.clear();
+
         if (m_textureId != 0) {
-            GLuint id = static_cast<GLuint>(m_textureId);
-            glDeleteTextures(1, &id);
+            DeferredReleaseGL::release(m_deferredRelease, DeferredReleaseGL::ObjectType::Texture, m_textureId);
             m_textureId = 0;
         }
     }
 
-    void TextureGL::update(const void* pixelData, size_t, uint32_t mipLevel, uint32_t arrayLayer) {
-        GLenum target = static_cast<GLenum>(toGLTarget());
-        glBindTexture(target, m_textureId);
+    void TextureGL::update(const void* pixelData, size_t dataSize, uint32_t mipLevel, uint32_t arrayLayer) {
+        if (m_desc.type == Type::TextureBuffer) {
+            // La actualizacin de texturas buffer no se maneja aqu
+            return;
+        }
+
+        // Un nivel completo (o una capa completa en cubemaps y arrays) es una regin ms
+        Region region;
+        uint32_t levelDepth = 1;
+        if (mipLevel < m_desc.mipLevels) {
+            getLevelSize(mipLevel, region.width, region.height, levelDepth);
+        }
+        region.mipLevel = mipLevel;
+        if (m_desc.type == Type::TextureCube || isArrayType()) {
+            // Con DSA las caras del cubemap y las capas de los arrays se direccionan con zoffset
+            if (arrayLayer >= getLayerCount(m_desc)) throw std::out_of_range("Invalid texture array layer");
+            region.z = arrayLayer;
+        }
+        else {
+            region.depth = levelDepth;
+        }
+
+        updateRegion(region, pixelData, dataSize);
+
+        // Desc::mipmapped: la cadena se regenera cada vez que cambia el nivel base
+        if (m_desc.mipmapped && mipLevel == m_residentBaseLevel && !m_desc.sparse) {
+            generateMipmaps();
+        }
+    }
+
+    void TextureGL::generateMipmaps() {
+        if (isCompressedFormat(m_desc.format) || m_desc.type == Type::Texture2DMultisample ||
+            m_desc.type == Type::TextureBuffer) {
+            throw std::runtime_error("Mipmaps cannot be generated on the GPU for this texture");
+        }
+        if (m_desc.mipLevels > 1) {
+            glGenerateTextureMipmap(m_textureId);
+        }
+    }
+
+    void TextureGL::updateRegion(const Region& region, const void* pixelData, size_t dataSize) {
+        if (m_desc.type == Type::Texture2DMultisample) {
+            throw std::runtime_error("Multisample textures cannot be updated from CPU");
+        }
+
+        validateRegion(region);
+
+        const GLint level = static_cast<GLint>(toAllocatedLevel(region.mipLevel));
+
+        if (isCompressedFormat(m_desc.format)) {
+            updateCompressedRegion(region, level, pixelData, dataSize);
+            return;
+        }
 
         GLenum format = static_cast<GLenum>(toGLFormat());
         GLenum type = static_cast<GLenum>(toGLType());
 
         switch (m_desc.type) {
         case Type::Texture1D:
-            glTexSubImage1D(target, mipLevel, 0, m_desc.width, format, type, pixelData);
+            glTextureSubImage1D(m_textureId, level, region.x, region.width, format, type, pixelData);
             break;
         case Type::Texture2D:
-            glTexSubImage2D(target, mipLevel, 0, 0, m_desc.width, m_desc.height, format, type, pixelData);
+            glTextureSubImage2D(m_textureId, level, region.x, region.y,
+                region.width, region.height, format, type, pixelData);
             break;
         case Type::TextureCube:
-            if (arrayLayer > 5) throw std::out_of_range("Invalid cubemap layer");
-            glTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + arrayLayer, mipLevel, 0, 0, m_desc.width, m_desc.height, format, type, pixelData);
-            break;
         case Type::Texture3D:
-            glTexSubImage3D(target, mipLevel, 0, 0, 0, m_desc.width, m_desc.height, m_desc.depth, format, type, pixelData);
+        case Type::Texture2DArray:
+        case Type::TextureCubeArray:
+            glTextureSubImage3D(m_textureId, level, region.x, region.y, region.z,
+                region.width, region.height, region.depth, format, type, pixelData);
             break;
-        case Type::TextureBuffer:
-            // La actualizacin de texturas buffer no se maneja aqu
+        default:
+            throw std::runtime_error("Unsupported texture type for region update");
+        }
+    }
+
+    void TextureGL::updateCompressedRegion(const Region& region, int level, const void* pixelData, size_t dataSize) {
+        uint32_t levelWidth, levelHeight, levelDepth;
+        getLevelSize(region.mipLevel, levelWidth, levelHeight, levelDepth);
+
+        // Las regiones deben cubrir bloques completos salvo en el borde del nivel
+        const uint32_t blockWidth = getBlockWidth(m_desc.format);
+        const uint32_t blockHeight = getBlockHeight(m_desc.format);
+        auto aligned = [](uint32_t offset, uint32_t size, uint32_t levelSize, uint32_t block) {
+            return offset % block == 0 && (size % block == 0 || offset + size == levelSize);
+        };
+        if (!aligned(region.x, region.width, levelWidth, blockWidth) ||
+            !aligned(region.y, region.height, levelHeight, blockHeight)) {
+            throw std::invalid_argument("Compressed texture region is not aligned to the block size");
+        }
+
+        const size_t imageSize = getImageSize(m_desc.format, region.width, region.height, region.depth);
+        if (dataSize < imageSize) {
+            throw std::invalid_argument("Compressed texture data is smaller than the region");
+        }
+
+        const GLenum internalFormat = static_cast<GLenum>(toGLInternalFormat());
+        switch (m_desc.type) {
+        case Type::Texture2D:
+            glCompressedTextureSubImage2D(m_textureId, level, region.x, region.y,
+                region.width, region.height, internalFormat, static_cast<GLsizei>(imageSize), pixelData);
+            break;
+        case Type::TextureCube:
+        case Type::Texture3D:
+        case Type::Texture2DArray:
+        case Type::TextureCubeArray:
+            glCompressedTextureSubImage3D(m_textureId, level, region.x, region.y, region.z,
+                region.width, region.height, region.depth, internalFormat, static_cast<GLsizei>(imageSize), pixelData);
             break;
         default:
-            throw std::runtime_error("Unsupported texture type for update");
+            throw std::runtime_error("Unsupported texture type for compressed update");
+        }
+    }
+
+    void TextureGL::commitRegion(const Region& region, bool commit) {
+        if (!m_desc.sparse) {
+            throw std::runtime_error("Texture is not sparse");
+        }
+
+        validateRegion(region);
+
+        uint32_t levelWidth, levelHeight, levelDepth;
+        getLevelSize(region.mipLevel, levelWidth, levelHeight, levelDepth);
+
+        if (region.mipLevel >= m_sparseMipTailStart) {
+            if (region.x != 0 || region.y != 0 || region.width != levelWidth || region.height != levelHeight) {
+                throw std::invalid_argument("Mip tail levels must be committed as a whole");
+            }
+        }
+        else {
+            auto aligned = [](uint32_t offset, uint32_t size, uint32_t levelSize, uint32_t page) {
+                return offset % page == 0 && (size % page == 0 || offset + size == levelSize);
+            };
+            if (!aligned(region.x, region.width, levelWidth, m_sparsePageSize.width) ||
+                !aligned(region.y, region.height, levelHeight, m_sparsePageSize.height) ||
+                (m_desc.type == Type::Texture3D && !aligned(region.z, region.depth, levelDepth, m_sparsePageSize.depth))) {
+                throw std::invalid_argument("Sparse commit region is not aligned to the page size");
+            }
+        }
+
+        const GLboolean glCommit = commit ? GL_TRUE : GL_FALSE;
+        if (glTexturePageCommitmentEXT) {
+            glTexturePageCommitmentEXT(m_textureId, region.mipLevel, region.x, region.y, region.z,
+                region.width, region.height, region.depth, glCommit);
+        }
+        else {
+            // Sin la variante DSA (EXT_direct_state_access) hay que vincular la textura; se
+            // restaura la anterior para no invalidar el estado de binding que guarda ContextGL
+            GLenum target = static_cast<GLenum>(toGLTarget());
+            GLint previous = 0;
+            glGetIntegerv(target == GL_TEXTURE_3D ? GL_TEXTURE_BINDING_3D :
+                target == GL_TEXTURE_2D_ARRAY ? GL_TEXTURE_BINDING_2D_ARRAY :
+                target == GL_TEXTURE_CUBE_MAP ? GL_TEXTURE_BINDING_CUBE_MAP :
+                target == GL_TEXTURE_CUBE_MAP_ARRAY ? GL_TEXTURE_BINDING_CUBE_MAP_ARRAY : GL_TEXTURE_BINDING_2D, &previous);
+            glBindTexture(target, m_textureId);
+            glTexPageCommitmentARB(target, region.mipLevel, region.x, region.y, region.z,
+                region.width, region.height, region.depth, glCommit);
+            glBindTexture(target, static_cast<GLuint>(previous));
+        }
+    }
+
+    void TextureGL::initSparse() {
+        GLenum target = static_cast<GLenum>(toGLTarget());
+        GLenum internalFormat = static_cast<GLenum>(toGLInternalFormat());
+
+        GLint pageSizeCount = 0;
+        glGetInternalformativ(target, internalFormat, GL_NUM_VIRTUAL_PAGE_SIZES_ARB, 1, &pageSizeCount);
+        if (pageSizeCount <= 0) {
+            throw std::runtime_error("Texture format does not support sparse storage");
+        }
+
+        GLint pageX = 0, pageY = 0, pageZ = 0;
+        glGetInternalformativ(target, internalFormat, GL_VIRTUAL_PAGE_SIZE_X_ARB, 1, &pageX);
+        glGetInternalformativ(target, internalFormat, GL_VIRTUAL_PAGE_SIZE_Y_ARB, 1, &pageY);
+        glGetInternalformativ(target, internalFormat, GL_VIRTUAL_PAGE_SIZE_Z_ARB, 1, &pageZ);
+        m_sparsePageSize = { static_cast<uint32_t>(pageX), static_cast<uint32_t>(pageY), static_cast<uint32_t>(pageZ) };
+
+        // Debe establecerse antes de asignar el almacenamiento
+        glTextureParameteri(m_textureId, GL_TEXTURE_SPARSE_ARB, GL_TRUE);
+        glTextureParameteri(m_textureId, GL_VIRTUAL_PAGE_SIZE_INDEX_ARB, 0);
+    }
+
+    void TextureGL::validateRegion(const Region& region) const {
+        if (region.mipLevel >= m_desc.mipLevels) {
+            throw std::out_of_range("Invalid texture mip level");
+        }
+
+        uint32_t levelWidth, levelHeight, levelDepth;
+        getLevelSize(region.mipLevel, levelWidth, levelHeight, levelDepth);
+
+        if (region.width == 0 || region.height == 0 || region.depth == 0 ||
+            region.x + region.width > levelWidth ||
+            region.y + region.height > levelHeight ||
+            region.z + region.depth > levelDepth) {
+            throw std::out_of_range("Texture region out of bounds");
+        }
+    }
+
+    void TextureGL::getLevelSize(uint32_t mipLevel, uint32_t& width, uint32_t& height, uint32_t& depth) const {
+        width = std::max<uint32_t>(1, m_desc.width >> mipLevel);
+        height = m_desc.type == Type::Texture1D ? 1 : std::max<uint32_t>(1, m_desc.height >> mipLevel);
+        switch (m_desc.type) {
+        case Type::Texture3D: depth = std::max<uint32_t>(1, m_desc.depth >> mipLevel); break;
+        default: depth = getLayerCount(m_desc); break;
         }
+    }
+
+    bool TextureGL::isArrayType() const {
+        return m_desc.type == Type::Texture2DArray || m_desc.type == Type::TextureCubeArray;
+    }
 
-        glBindTexture(target, 0);
+    bool TextureGL::canReallocateLevels() const {
+        return m_desc.type == Type::Texture2D || m_desc.type == Type::TextureCube || isArrayType();
+    }
+
+    uint64_t TextureGL::getBindlessHandle(const std::shared_ptr<Sampler>& sampler) {
+        if (!GLEW_ARB_bindless_texture) {
+            throw std::runtime_error("Bindless textures are not supported (GL_ARB_bindless_texture)");
+        }
+
+        GLuint samplerId = 0;
+        uint64_t samplerUniqueId = 0;
+        if (sampler) {
+            if (sampler->getBackendType() != BackendType::OpenGL) {
+                throw std::runtime_error("Cannot create bindless handle with a non-OpenGL sampler");
+            }
+            samplerId = sampler->as<SamplerGL>()->nativeSamplerId();
+            samplerUniqueId = sampler->as<SamplerGL>()->uniqueId();
+        }
+
+        evictDestroyedSamplerHandles();
+        for (auto& bindless : m_bindlessHandles) {
+            if (bindless.samplerUniqueId == samplerUniqueId) {
+                if (!bindless.resident) {
+                    glMakeTextureHandleResidentARB(bindless.handle);
+                    bindless.resident = true;
+                }
+                return bindless.handle;
+            }
+        }
+
+        GLuint64 handle = samplerId ? glGetTextureSamplerHandleARB(m_textureId, samplerId)
+                                    : glGetTextureHandleARB(m_textureId);
+        if (handle == 0) {
+            throw std::runtime_error("Failed to create bindless texture handle");
+        }
+
+        glMakeTextureHandleResidentARB(handle);
+        m_bindlessHandles.push_back({ samplerUniqueId, sampler, handle, true });
+        m_hasBindlessHandles = true;
+        return handle;
+    }
+
+    void TextureGL::evictDestroyedSamplerHandles() {
+        std::erase_if(m_bindlessHandles, [](const BindlessHandle& bindless) {
+            if (bindless.samplerUniqueId == 0 || !bindless.sampler.expired()) {
+                return false;
+            }
+            if (bindless.resident) {
+                glMakeTextureHandleNonResidentARB(bindless.handle);
+            }
+            return true;
+            });
+    }
+
+    void TextureGL::setBindlessHandleResident(uint64_t handle, bool resident) {
+        for (auto& bindless : m_bindlessHandles) {
+            if (bindless.handle != handle) continue;
+
+            if (bindless.resident != resident) {
+                if (resident) {
+                    glMakeTextureHandleResidentARB(handle);
+                }
+                else {
+                    glMakeTextureHandleNonResidentARB(handle);
+                }
+                bindless.resident = resident;
+            }
+            return;
+        }
+
+        throw std::invalid_argument("Bindless handle does not belong to this texture");
     }
 
     unsigned int TextureGL::toGLTarget() const {
         switch (m_desc.type) {
         case Type::Texture1D: return GL_TEXTURE_1D;
         case Type::Texture2D: return GL_TEXTURE_2D;
+        case Type::Texture2DMultisample: return GL_TEXTURE_2D_MULTISAMPLE;
         case Type::Texture3D: return GL_TEXTURE_3D;
         case Type::TextureCube: return GL_TEXTURE_CUBE_MAP;
         case Type::TextureBuffer: return GL_TEXTURE_BUFFER;
+        case Type::Texture2DArray: return GL_TEXTURE_2D_ARRAY;
+        case Type::TextureCubeArray: return GL_TEXTURE_CUBE_MAP_ARRAY;
         default: throw std::runtime_error("Unknown texture type");
         }
     }
 
     unsigned int TextureGL::toGLInternalFormat() const {
-        switch (m_desc.format) {
-        case Format::R8: return GL_R8;
-        case Format::RG8: return GL_RG8;
-        case Format::RGB8: return GL_RGB8;
-        case Format::RGBA8: return GL_RGBA8;
-        case Format::R16F: return GL_R16F;
-        case Format::RG16F: return GL_RG16F;
-        case Format::RGB16F: return GL_RGB16F;
-        case Format::RGBA16F: return GL_RGBA16F;
-        case Format::R32F: return GL_R32F;
-        case Format::RG32F: return GL_RG32F;
-        case Format::RGB32F: return GL_RGB32F;
-        case Format::RGBA32F: return GL_RGBA32F;
-        case Format::Depth24Stencil8: return GL_DEPTH24_STENCIL8;
-        case Format::Depth32F: return GL_DEPTH_COMPONENT32F;
-        default: throw std::runtime_error("Unsupported texture format");
-        }
+        return toGLInternalFormat(m_desc.format);
+    }
+
+    unsigned int TextureGL::toGLInternalFormat(Format format) {
+        return kGLFormatTable[static_cast<size_t>(format)].internalFormat;
     }
 
     unsigned int TextureGL::toGLFormat() const {
-        switch (m_desc.format) {
-        case Format::R8: case Format::R16F: case Format::R32F: return GL_RED;
-        case Format::RG8: case Format::RG16F: case Format::RG32F: return GL_RG;
-        case Format::RGB8: case Format::RGB16F: case Format::RGB32F: return GL_RGB;
-        case Format::RGBA8: case Format::RGBA16F: case Format::RGBA32F: return GL_RGBA;
-        case Format::Depth24Stencil8: return GL_DEPTH_STENCIL;
-        case Format::Depth32F: return GL_DEPTH_COMPONENT;
-        default: throw std::runtime_error("Unsupported format for GL format");
+        const GLFormat& glFormat = kGLFormatTable[static_cast<size_t>(m_desc.format)];
+        if (glFormat.format == 0) {
+            throw std::runtime_error("Unsupported format for GL format");
         }
+        return glFormat.format;
     }
 
     unsigned int TextureGL::toGLType() const {
-        switch (m_desc.format) {
-        case Format::R8: case Format::RG8: case Format::RGB8: case Format::RGBA8:
-            return GL_UNSIGNED_BYTE;
-        case Format::R16F: case Format::RG16F: case Format::RGB16F: case Format::RGBA16F:
-            return GL_HALF_FLOAT;
-        case Format::R32F: case Format::RG32F: case Format::RGB32F: case Format::RGBA32F: case Format::Depth32F:
-            return GL_FLOAT;
-        case Format::Depth24Stencil8:
-            return GL_UNSIGNED_INT_24_8;
-        default:
+        const GLFormat& glFormat = kGLFormatTable[static_cast<size_t>(m_desc.format)];
+        if (glFormat.type == 0) {
             throw std::runtime_error("Unsupported format for GL type");
         }
+        return glFormat.type;
     }
 
 } // namespace pgrender
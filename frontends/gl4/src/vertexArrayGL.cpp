@@ -10,14 +10,12 @@ namespace pgrender {
         m_vertexBuffers(desc.vertexBuffers),
         m_indexBuffer(desc.indexBuffer)
     {
-        // Crear VAO
-        glGenVertexArrays(1, &m_vao);
+        // Crear VAO (DSA: no se modifica el VAO vinculado en el contexto)
+        glCreateVertexArrays(1, &m_vao);
         if (m_vao == 0) {
             throw std::runtime_error("Failed to create Vertex Array Object");
         }
 
-        glBindVertexArray(m_vao);
-
         // Configurar atributos de vrtice
         setupVertexAttributes();
 
@@ -27,11 +25,8 @@ namespace pgrender {
                 throw std::runtime_error("Index buffer is not an OpenGL buffer");
             }
             auto* indexBufferGL = m_indexBuffer->as<BufferObjectGL>();
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferGL->nativeBufferId());
+            glVertexArrayElementBuffer(m_vao, indexBufferGL->nativeBufferId());
         }
-
-        // Desvincular VAO
-        glBindVertexArray(0);
     }
 
     VertexArrayGL::~VertexArrayGL() {
@@ -58,23 +53,24 @@ namespace pgrender {
             auto* bufferGL = buffer->as<BufferObjectGL>();
 
             // Vincular buffer al binding point
-            glBindVertexBuffer(bufferBinding.binding,
+            glVertexArrayVertexBuffer(m_vao,
+                bufferBinding.binding,
                 bufferGL->nativeBufferId(),
                 0,
                 bufferBinding.stride);
 
             // Configurar divisor para instancing
             if (bufferBinding.instanceRate) {
-                glVertexBindingDivisor(bufferBinding.binding, bufferBinding.divisor);
+                glVertexArrayBindingDivisor(m_vao, bufferBinding.binding, bufferBinding.divisor);
             }
             else {
-                glVertexBindingDivisor(bufferBinding.binding, 0);
+                glVertexArrayBindingDivisor(m_vao, bufferBinding.binding, 0);
             }
         }
 
         // Configurar atributos
         for (const auto& attr : m_layout.getAttributes()) {
-            glEnableVertexAttribArray(attr.location);
+            glEnableVertexArrayAttrib(m_vao, attr.location);
 
             GLint componentCount = VertexLayout::getComponentCount(attr.type);
             GLenum glType = toGLAttributeType(attr.type);
@@ -89,7 +85,7 @@ namespace pgrender {
             case VertexAttributeType::Float4:
             case VertexAttributeType::Half2:
             case VertexAttributeType::Half4:
-                glVertexAttribFormat(attr.location, componentCount, glType,
+                glVertexArrayAttribFormat(m_vao, attr.location, componentCount, glType,
                     normalized, attr.offset);
                 break;
 
@@ -108,7 +104,7 @@ namespace pgrender {
             case VertexAttributeType::Short4:
             case VertexAttributeType::UShort2:
             case VertexAttributeType::UShort4:
-                glVertexAttribIFormat(attr.location, componentCount, glType, attr.offset);
+                glVertexArrayAttribIFormat(m_vao, attr.location, componentCount, glType, attr.offset);
                 break;
 
             default:
@@ -116,7 +112,7 @@ namespace pgrender {
             }
 
             // Asociar atributo con binding del buffer
-            glVertexAttribBinding(attr.location, attr.binding);
+            glVertexArrayAttribBinding(m_vao, attr.location, attr.binding);
         }
     }
 
@@ -128,8 +124,6 @@ namespace pgrender {
         m_vertexBuffers[binding] = buffer;
 
         // Actualizar VAO
-        glBindVertexArray(m_vao);
-
         if (buffer) {
             if (buffer->getBackendType() != BackendType::OpenGL) {
                 throw std::runtime_error("Buffer is not an OpenGL buffer");
@@ -146,32 +140,26 @@ namespace pgrender {
                 }
             }
 
-            glBindVertexBuffer(binding, bufferGL->nativeBufferId(), 0, stride);
+            glVertexArrayVertexBuffer(m_vao, binding, bufferGL->nativeBufferId(), 0, stride);
         }
         else {
-            glBindVertexBuffer(binding, 0, 0, 0);
+            glVertexArrayVertexBuffer(m_vao, binding, 0, 0, 0);
         }
-
-        glBindVertexArray(0);
     }
 
     void VertexArrayGL::setIndexBuffer(std::shared_ptr<BufferObject> buffer) {
         m_indexBuffer = buffer;
 
-        glBindVertexArray(m_vao);
-
         if (buffer) {
             if (buffer->getBackendType() != BackendType::OpenGL) {
                 throw std::runtime_error("Buffer is not an OpenGL buffer");
             }
             auto* bufferGL = buffer->as<BufferObjectGL>();
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferGL->nativeBufferId());
+            glVertexArrayElementBuffer(m_vao, bufferGL->nativeBufferId());
         }
         else {
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+            glVertexArrayElementBuffer(m_vao, 0);
         }
-
-        glBindVertexArray(0);
     }
 
     unsigned int VertexArrayGL::toGLAttributeType(VertexAttributeType type) const {
@@ -0,0 +1,350 @@
+#pragma once
+#include <PGRenderCore/context.h>
+
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Implementaciones en memoria de los recursos y del contexto, para probar sin GPU las clases
+// de coreRender que sólo usan la interfaz Context. Registran las llamadas que interesan a
+// los tests y no hacen nada en el resto.
+namespace pgrender::fakes {
+
+	class FakeBuffer : public BufferObject {
+	public:
+		explicit FakeBuffer(const Desc& desc) : data(desc.size), m_desc(desc) {
+			if (desc.data) {
+				std::memcpy(data.data(), desc.data, desc.size);
+			}
+		}
+
+		BackendType getBackendType() const override { return BackendType::OpenGL; }
+		const Desc& getDesc() const override { return m_desc; }
+		uint64_t nativeHandle() const override { return 0; }
+		size_t getSize() const override { return data.size(); }
+
+		void update(const void* source, size_t size, size_t offset = 0) override {
+			std::memcpy(data.data() + offset, source, size);
+			updates.push_back({ offset, size });
+		}
+		void* map(BufferAccessFlags = BufferAccessFlags::Write, size_t offset = 0, size_t = 0) override { return data.data() + offset; }
+		void unmap() override {}
+		void copyFrom(const std::shared_ptr<BufferObject>&, size_t, size_t, size_t) override {}
+		void resize(size_t newSize, const void* = nullptr) override { data.resize(newSize); }
+
+		std::vector<uint8_t> data;
+		std::vector<std::pair<size_t, size_t>> updates;     ///< (offset, size) de cada update()
+
+	private:
+		Desc m_desc;
+	};
+
+	class FakeSampler : public Sampler {
+	public:
+		explicit FakeSampler(const Desc& desc) : m_desc(desc) {}
+
+		BackendType getBackendType() const override { return BackendType::OpenGL; }
+		const Desc& getDesc() const override { return m_desc; }
+		uint64_t nativeHandle() const override { return 0; }
+
+	private:
+		Desc m_desc;
+	};
+
+	class FakeTexture : public Texture {
+	public:
+		explicit FakeTexture(const Desc& desc) : residentBaseLevel(desc.residentBaseLevel), m_desc(desc) {}
+
+		BackendType getBackendType() const override { return BackendType::OpenGL; }
+		const Desc& getDesc() const override { return m_desc; }
+		uint64_t nativeHandle() const override { return 0; }
+
+		void update(const void*, size_t, uint32_t mipLevel = 0, uint32_t = 0) override { updatedLevels.push_back(mipLevel); }
+		void updateRegion(const Region& region, const void* data, size_t size) override {
+			updatedLevels.push_back(region.mipLevel);
+			const auto* bytes = static_cast<const uint8_t*>(data);
+			lastUpload.assign(bytes, bytes + size);
+		}
+
+		void setResidentBaseLevel(uint32_t baseLevel) override {
+			requireMutable();
+			residentBaseLevel = baseLevel;
+		}
+		uint32_t getResidentBaseLevel() const override { return residentBaseLevel; }
+		void setLodBias(float bias) override {
+			requireMutable();
+			lodBias = bias;
+		}
+		void generateMipmaps() override {}
+
+		void commitRegion(const Region& region, bool commit) override { commits.push_back({ region, commit }); }
+		PageSize getSparsePageSize() const override { return pageSize; }
+		uint32_t getSparseMipTailStart() const override { return mipTailStart; }
+
+		uint64_t getBindlessHandle(const std::shared_ptr<Sampler>& sampler = nullptr) override {
+			auto [it, created] = bindlessHandles.try_emplace(sampler.get(), 0);
+			if (created) {
+				static uint64_t nextHandle = 1;
+				it->second = nextHandle++;
+			}
+			resident[it->second] = true;
+			return it->second;
+		}
+		void setBindlessHandleResident(uint64_t handle, bool isResident) override { resident[handle] = isResident; }
+		bool hasBindlessHandles() const override { return !bindlessHandles.empty(); }
+
+		uint32_t residentBaseLevel = 0;
+		float lodBias = 0.0f;
+		PageSize pageSize{ 128, 128, 1 };
+		uint32_t mipTailStart = 0;
+		std::vector<uint32_t> updatedLevels;
+		std::vector<uint8_t> lastUpload;        ///< Datos del último updateRegion()
+		std::vector<std::pair<Region, bool>> commits;
+		std::unordered_map<const Sampler*, uint64_t> bindlessHandles;
+		std::unordered_map<uint64_t, bool> resident;
+
+	private:
+		Desc m_desc;
+
+		// Como en GL, el estado de la textura queda fijado al crear un handle bindless
+		void requireMutable() const {
+			if (hasBindlessHandles()) {
+				throw std::runtime_error("Texture state is immutable after creating bindless handles");
+			}
+		}
+	};
+
+	class FakeRenderTarget : public RenderTarget {
+	public:
+		explicit FakeRenderTarget(const Desc& desc) : m_desc(desc) {}
+
+		BackendType getBackendType() const override { return BackendType::OpenGL; }
+		std::shared_ptr<Texture> getColorAttachment(uint32_t index) const override { return m_desc.colorAttachments.at(index); }
+		uint32_t getColorAttachmentCount() const override { return static_cast<uint32_t>(m_desc.colorAttachments.size()); }
+		std::shared_ptr<Texture> getDepthStencilAttachment() const override { return m_desc.depthStencilAttachment; }
+		uint32_t getWidth() const override { return m_desc.width; }
+		uint32_t getHeight() const override { return m_desc.height; }
+		uint32_t getSampleCount() const override { return m_desc.sampleCount; }
+		void resolve(const std::shared_ptr<RenderTarget>&, bool = false) override {}
+		uint64_t nativeHandle() const override { return 0; }
+
+	private:
+		Desc m_desc;
+	};
+
+	/**
+	 * @brief Programa que "compila" salvo si alguna etapa define kCompileError (como un #error
+	 * dentro de un #ifdef). La compilación asíncrona sigue pendiente durante pendingPolls consultas.
+	 */
+	class FakeProgram : public Program {
+	public:
+		static constexpr const char* kCompileError = "COMPILE_ERROR";
+
+		explicit FakeProgram(const Desc& desc, uint32_t pendingPolls = 0) : pendingPolls(pendingPolls), m_desc(desc) {}
+
+		BackendType getBackendType() const override { return BackendType::OpenGL; }
+
+		bool compile() override {
+			m_status = sourceCompiles() ? CompileStatus::Ready : CompileStatus::Failed;
+			return m_status == CompileStatus::Ready;
+		}
+		bool beginCompile() override { m_status = CompileStatus::Pending; return true; }
+		CompileStatus pollCompileStatus() override {
+			if (m_status == CompileStatus::Pending) {
+				if (pendingPolls > 0) {
+					--pendingPolls;
+				}
+				else {
+					compile();
+				}
+			}
+			return m_status;
+		}
+		CompileStatus getCompileStatus() const override { return m_status; }
+		std::string getLastError() const override { return m_status == CompileStatus::Failed ? "fake compile error" : ""; }
+
+		void adopt(Program& other) override {
+			auto& fake = static_cast<FakeProgram&>(other);
+			std::swap(m_desc, fake.m_desc);
+			std::swap(m_status, fake.m_status);
+			adoptions++;
+		}
+		void release() override {}
+		const Desc& getDesc() const override { return m_desc; }
+		unsigned long nativeHandle() const override { return 0; }
+		const ProgramReflection& getReflection() const override { return m_reflection; }
+
+		void setUniform(int32_t, float) override {}
+		void setUniform(int32_t, int32_t) override {}
+		void setUniform(int32_t, uint32_t) override {}
+		void setUniform(int32_t, const glm::vec2&) override {}
+		void setUniform(int32_t, const glm::vec3&) override {}
+		void setUniform(int32_t, const glm::vec4&) override {}
+		void setUniform(int32_t, const glm::mat3&) override {}
+		void setUniform(int32_t, const glm::mat4&) override {}
+		void setUniform(int32_t, const glm::vec4*, uint32_t) override {}
+		void setUniform(int32_t, const glm::mat4*, uint32_t) override {}
+
+		/**
+		 * @brief Fuente de la primera etapa del tipo dado, o vacía.
+		 */
+		std::string stageSource(ShaderStage stage) const {
+			for (const auto& source : m_desc.stages) {
+				if (source.stage == stage) {
+					return source.source;
+				}
+			}
+			return {};
+		}
+
+		uint32_t pendingPolls;
+		uint32_t adoptions = 0;
+
+	private:
+		Desc m_desc;
+		CompileStatus m_status = CompileStatus::NotCompiled;
+		ProgramReflection m_reflection;
+
+		bool sourceCompiles() const {
+			for (const auto& source : m_desc.stages) {
+				if (source.source.find(std::string("#define ") + kCompileError) != std::string::npos) {
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+
+	class FakeContext : public Context {
+	public:
+		BackendType getBackendType() const override { return BackendType::OpenGL; }
+
+		void makeCurrent() override {}
+		void swapBuffers() override { endFrame(); }
+		void endFrame() override { frames++; }
+
+		// ===== FÁBRICAS =====
+
+		std::shared_ptr<BufferObject> createBufferObject(const BufferObject::Desc& desc) override {
+			auto buffer = std::make_shared<FakeBuffer>(desc);
+			buffers.push_back(buffer);
+			return buffer;
+		}
+		std::shared_ptr<Texture> createTexture(const Texture::Desc& desc) override {
+			if (onCreateTexture) {
+				onCreateTexture(desc);
+			}
+			texturesCreated++;
+			return std::make_shared<FakeTexture>(desc);
+		}
+		std::shared_ptr<Program> createProgram(const Program::Desc& desc) override {
+			auto program = std::make_shared<FakeProgram>(desc, pendingPolls);
+			programs.push_back(program);
+			return program;
+		}
+		std::shared_ptr<Sampler> createSampler(const Sampler::Desc& desc) override { return std::make_shared<FakeSampler>(desc); }
+		std::shared_ptr<Pipeline> createPipeline(const Pipeline::Desc&) override { return nullptr; }
+		std::shared_ptr<RenderTarget> createRenderTarget(const RenderTarget::Desc& desc) override {
+			if (onCreateRenderTarget) {
+				onCreateRenderTarget(desc);
+			}
+			renderTargetsCreated++;
+			return std::make_shared<FakeRenderTarget>(desc);
+		}
+		std::shared_ptr<RenderPass> createRenderPass(const RenderPass::Desc&) override { return nullptr; }
+		std::shared_ptr<VertexArray> createVertexArray(const VertexArray::Desc&) override { return nullptr; }
+
+		// ===== BINDING =====
+
+		void bindVertexArray(const std::shared_ptr<VertexArray>&) override {}
+		std::shared_ptr<VertexArray> getBoundVertexArray() const override { return nullptr; }
+		void bindPipeline(const std::shared_ptr<Pipeline>&) override {}
+		std::shared_ptr<Pipeline> getBoundPipeline() const override { return nullptr; }
+		void bindTexture(const std::shared_ptr<Texture>&, uint32_t = 0) override {}
+		void bindSampler(const std::shared_ptr<Sampler>&, uint32_t = 0) override {}
+		void bindTextures(uint32_t, std::span<const std::shared_ptr<Texture>>) override {}
+		void bindSamplers(uint32_t, std::span<const std::shared_ptr<Sampler>>) override {}
+		void bindUniformBuffer(const std::shared_ptr<BufferObject>& buffer, uint32_t binding, size_t offset = 0, size_t size = 0) override {
+			const BufferRange range{ buffer, offset, size };
+			bindUniformBuffers(binding, std::span<const BufferRange>(&range, 1));
+		}
+		void bindShaderStorageBuffer(const std::shared_ptr<BufferObject>&, uint32_t, size_t = 0, size_t = 0) override {}
+		BufferObject* getBoundUniformBuffer(uint32_t) const override { return nullptr; }
+		BufferObject* getBoundShaderStorageBuffer(uint32_t) const override { return nullptr; }
+		void bindUniformBuffers(uint32_t firstBinding, std::span<const BufferRange> ranges) override {
+			for (size_t i = 0; i < ranges.size(); ++i) {
+				boundUniformRanges[firstBinding + static_cast<uint32_t>(i)] = ranges[i];
+			}
+		}
+		void bindShaderStorageBuffers(uint32_t, std::span<const BufferRange>) override {}
+		size_t getUniformBufferOffsetAlignment() const override { return uniformBufferOffsetAlignment; }
+
+		BufferHandle createBufferHandle(const BufferObject::Desc&) override { return {}; }
+		TextureHandle createTextureHandle(const Texture::Desc&) override { return {}; }
+		SamplerHandle createSamplerHandle(const Sampler::Desc&) override { return {}; }
+		bool destroy(BufferHandle) override { return false; }
+		bool destroy(TextureHandle) override { return false; }
+		bool destroy(SamplerHandle) override { return false; }
+		BufferObject* getBuffer(BufferHandle) const override { return nullptr; }
+		Texture* getTexture(TextureHandle) const override { return nullptr; }
+		Sampler* getSampler(SamplerHandle) const override { return nullptr; }
+		void bindTextures(uint32_t, std::span<const TextureHandle>) override {}
+		void bindSamplers(uint32_t, std::span<const SamplerHandle>) override {}
+		void bindUniformBuffers(uint32_t, std::span<const BufferHandleRange>) override {}
+		void bindShaderStorageBuffers(uint32_t, std::span<const BufferHandleRange>) override {}
+
+		// ===== COMANDOS =====
+
+		void clear(ClearFlags, const glm::vec4& = glm::vec4{ 0.0f }, float = 1.0f, int = 0) override {}
+		void setClearColor(float, float, float, float = 1.0f) override {}
+		void setClearDepth(float) override {}
+		void setClearStencil(int) override {}
+		void draw(uint32_t, uint32_t = 0) override {}
+		void drawIndexed(uint32_t, uint32_t = 0, int32_t = 0) override {}
+		void drawInstanced(uint32_t, uint32_t, uint32_t = 0, uint32_t = 0) override {}
+		void drawIndexedInstanced(uint32_t, uint32_t, uint32_t = 0, int32_t = 0, uint32_t = 0) override {}
+		void drawIndexedIndirect(const std::shared_ptr<BufferObject>&, size_t, uint32_t, uint32_t = 0) override {}
+		void drawIndexedIndirectCount(const std::shared_ptr<BufferObject>&, size_t, const std::shared_ptr<BufferObject>&,
+			size_t, uint32_t, uint32_t = 0) override {}
+		void dispatch(uint32_t, uint32_t = 1, uint32_t = 1) override {}
+		void dispatchIndirect(const std::shared_ptr<BufferObject>&, size_t = 0) override {}
+		void bindImage(const std::shared_ptr<Texture>&, uint32_t, ImageAccess, uint32_t = 0, int32_t = -1) override {}
+		void memoryBarrier(BarrierFlags) override {}
+
+		// ===== CAPACIDADES =====
+
+		bool isBindlessTextureSupported() const override { return true; }
+		bool isSparseTextureSupported() const override { return sparseTextureSupported; }
+		bool isSpirvSupported() const override { return false; }
+		bool isFormatSupported(Texture::Format) const override { return true; }
+		FormatFeatures getFormatFeatures(Texture::Format format) const override { return getFormatInfo(format).features; }
+		bool isRayTracingSupported() const override { return false; }
+		std::shared_ptr<AccelerationStructure> createBLAS(const BLASDesc&) override { return nullptr; }
+		std::shared_ptr<AccelerationStructure> createTLAS(const TLASDesc&) override { return nullptr; }
+		void buildAccelerationStructure(const std::shared_ptr<AccelerationStructure>&, bool = false) override {}
+		void rayTracingBarrier() override {}
+
+		void setViewport(int, int, uint32_t, uint32_t) override {}
+		void setScissor(int, int, uint32_t, uint32_t) override {}
+		void setPolygonMode(PolygonMode) override {}
+
+		// Configuración y registro
+		size_t uniformBufferOffsetAlignment = 256;
+		bool sparseTextureSupported = true;
+		uint32_t pendingPolls = 0;          ///< Consultas que siguen pendientes en cada programa nuevo
+		std::function<void(const Texture::Desc&)> onCreateTexture;
+		std::function<void(const RenderTarget::Desc&)> onCreateRenderTarget;
+		uint32_t texturesCreated = 0;
+		uint32_t renderTargetsCreated = 0;
+		uint32_t frames = 0;
+		std::vector<std::shared_ptr<FakeBuffer>> buffers;
+		std::vector<std::shared_ptr<FakeProgram>> programs;
+		std::unordered_map<uint32_t, BufferRange> boundUniformRanges;
+	};
+
+} // namespace pgrender::fakes
@@ -0,0 +1,97 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/bindingState.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace ::testing;
+using namespace pgrender;
+
+namespace {
+
+	// Misma forma que las entradas de un backend: recurso, nombre nativo y rango
+	struct Slot {
+		const void* resource = nullptr;
+		uint32_t name = 0;
+		size_t offset = 0;
+		size_t size = 0;
+
+		bool operator==(const Slot& other) const = default;
+	};
+
+	int g_resources[8];
+
+	Slot texture(int index, uint32_t name) {
+		return Slot{ &g_resources[index], name };
+	}
+
+	DirtyRange bind(std::vector<Slot>& table, size_t first, const std::vector<Slot>& slots) {
+		return updateBindingSlots(std::span(table).subspan(first, slots.size()), [&slots](size_t i) { return slots[i]; });
+	}
+
+}
+
+TEST(BindingStateTest, FirstBindSendsEverySlot) {
+	std::vector<Slot> table(8);
+	const DirtyRange dirty = bind(table, 2, { texture(0, 10), texture(1, 11), texture(2, 12) });
+
+	EXPECT_EQ(dirty.first, 0u);
+	EXPECT_EQ(dirty.last, 3u);
+	EXPECT_EQ(dirty.count(), 3u);
+	EXPECT_EQ(table[2], texture(0, 10));
+	EXPECT_EQ(table[4], texture(2, 12));
+	EXPECT_EQ(table[5], Slot{});
+}
+
+TEST(BindingStateTest, RedundantBindIsEmpty) {
+	std::vector<Slot> table(8);
+	bind(table, 0, { texture(0, 10), texture(1, 11) });
+
+	const DirtyRange dirty = bind(table, 0, { texture(0, 10), texture(1, 11) });
+	EXPECT_TRUE(dirty.empty());
+	EXPECT_EQ(dirty.count(), 0u);
+
+	EXPECT_TRUE(bind(table, 0, {}).empty());
+}
+
+TEST(BindingStateTest, CoversOnlyTheChangedSpan) {
+	std::vector<Slot> table(8);
+	bind(table, 0, { texture(0, 10), texture(1, 11), texture(2, 12), texture(3, 13), texture(4, 14) });
+
+	// Cambian las unidades 1 y 3: la 2 va en el tramo con su valor guardado
+	const DirtyRange dirty = bind(table, 0, { texture(0, 10), texture(5, 15), texture(2, 12), texture(6, 16), texture(4, 14) });
+	EXPECT_EQ(dirty.first, 1u);
+	EXPECT_EQ(dirty.last, 4u);
+	EXPECT_EQ(table[1], texture(5, 15));
+	EXPECT_EQ(table[2], texture(2, 12));
+	EXPECT_EQ(table[3], texture(6, 16));
+}
+
+TEST(BindingStateTest, DetectsRecreatedNativeObjects) {
+	std::vector<Slot> table(4);
+	bind(table, 0, { texture(0, 10) });
+
+	// El mismo recurso con otro nombre nativo (p.ej. tras resize) se vuelve a enviar
+	const DirtyRange dirty = bind(table, 0, { texture(0, 20) });
+	EXPECT_EQ(dirty.first, 0u);
+	EXPECT_EQ(dirty.last, 1u);
+	EXPECT_EQ(table[0].name, 20u);
+}
+
+TEST(BindingStateTest, ComparesBufferRanges) {
+	std::vector<Slot> table(4);
+	const Slot whole{ &g_resources[0], 7, 0, 256 };
+	bind(table, 1, { whole });
+
+	Slot tail = whole;
+	tail.offset = 128;
+	tail.size = 128;
+	const DirtyRange dirty = bind(table, 1, { whole, tail });
+	EXPECT_EQ(dirty.first, 1u);
+	EXPECT_EQ(dirty.last, 2u);
+	EXPECT_EQ(table[2], tail);
+
+	// Desvincular también cuenta como cambio
+	EXPECT_EQ(bind(table, 1, { Slot{} }).count(), 1u);
+	EXPECT_EQ(table[1], Slot{});
+}
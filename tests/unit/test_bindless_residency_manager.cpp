@@ -0,0 +1,77 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/bindlessResidencyManager.h>
+#include "fakeContext.h"
+
+#include <stdexcept>
+
+using namespace ::testing;
+using namespace pgrender;
+using namespace pgrender::fakes;
+
+namespace {
+
+	std::shared_ptr<FakeTexture> makeTexture() {
+		Texture::Desc desc{};
+		desc.width = desc.height = 64;
+		return std::make_shared<FakeTexture>(desc);
+	}
+
+}
+
+TEST(BindlessResidencyManagerTest, ReusesHandlePerTextureAndSampler) {
+	BindlessResidencyManager manager;
+	auto texture = makeTexture();
+	auto sampler = std::make_shared<FakeSampler>(Sampler::Desc{});
+
+	const uint64_t plain = manager.use(texture);
+	const uint64_t sampled = manager.use(texture, sampler);
+	EXPECT_NE(plain, sampled);
+	EXPECT_EQ(manager.use(texture), plain);
+	EXPECT_EQ(manager.use(texture, sampler), sampled);
+
+	EXPECT_EQ(manager.getStatistics().residentHandles, 2u);
+	EXPECT_EQ(manager.getStatistics().madeResident, 2u);
+	EXPECT_TRUE(texture->resident[plain]);
+	EXPECT_TRUE(texture->resident[sampled]);
+	EXPECT_THROW(manager.use(nullptr), std::invalid_argument);
+}
+
+TEST(BindlessResidencyManagerTest, EvictsHandlesUnusedForTooManyFrames) {
+	BindlessResidencyManager manager(2);
+	auto stale = makeTexture();
+	auto active = makeTexture();
+	const uint64_t staleHandle = manager.use(stale);
+	const uint64_t activeHandle = manager.use(active);
+
+	for (int frame = 0; frame < 3; ++frame) {
+		manager.nextFrame();
+		manager.use(active);
+	}
+
+	EXPECT_FALSE(stale->resident[staleHandle]);
+	EXPECT_TRUE(active->resident[activeHandle]);
+	EXPECT_EQ(manager.getStatistics().residentHandles, 1u);
+	EXPECT_EQ(manager.getStatistics().evictions, 1u);
+
+	// Volver a usarlo lo hace residente otra vez con el mismo handle
+	EXPECT_EQ(manager.use(stale), staleHandle);
+	EXPECT_TRUE(stale->resident[staleHandle]);
+	EXPECT_EQ(manager.getStatistics().madeResident, 3u);
+}
+
+TEST(BindlessResidencyManagerTest, ReleaseAllMakesEverythingNonResident) {
+	auto texture = makeTexture();
+	uint64_t handle = 0;
+	{
+		BindlessResidencyManager manager;
+		handle = manager.use(texture);
+		manager.releaseAll();
+		EXPECT_FALSE(texture->resident[handle]);
+		EXPECT_EQ(manager.getStatistics().residentHandles, 0u);
+
+		manager.use(texture);
+		EXPECT_TRUE(texture->resident[handle]);
+	}
+	// El destructor libera los handles que quedan
+	EXPECT_FALSE(texture->resident[handle]);
+}
@@ -0,0 +1,135 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/deferredReleaseQueue.h>
+
+#include <cstdint>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace ::testing;
+using namespace pgrender;
+
+namespace {
+
+	// Fences numerados que el test señaliza a mano; registra los objetos borrados en orden
+	class FakeBackend : public DeferredReleaseQueue::Backend {
+	public:
+		void* insertFence() override {
+			fences.push_back(++nextFence);
+			return reinterpret_cast<void*>(nextFence);
+		}
+		bool isFenceSignaled(void* fence) override { return signaled.count(id(fence)) != 0; }
+		void deleteFence(void* fence) override { deletedFences.push_back(id(fence)); }
+		void waitIdle() override { waits++; }
+		void destroy(uint32_t type, uint32_t name) override { destroyed.push_back({ type, name }); }
+
+		static uintptr_t id(void* fence) { return reinterpret_cast<uintptr_t>(fence); }
+
+		uintptr_t nextFence = 0;
+		std::vector<uintptr_t> fences;
+		std::set<uintptr_t> signaled;
+		std::vector<uintptr_t> deletedFences;
+		std::vector<std::pair<uint32_t, uint32_t>> destroyed;
+		uint32_t waits = 0;
+	};
+
+	using Destroyed = std::pair<uint32_t, uint32_t>;
+
+}
+
+TEST(DeferredReleaseQueueTest, DestroysBatchOnlyAfterItsFence) {
+	FakeBackend backend;
+	DeferredReleaseQueue queue(backend);
+
+	queue.release(0, 1);
+	queue.release(1, 2);
+	queue.collect();
+	EXPECT_THAT(backend.fences, IsEmpty());     // El lote sigue abierto hasta endFrame()
+
+	queue.endFrame();
+	ASSERT_THAT(backend.fences, ElementsAre(1u));
+	EXPECT_THAT(backend.destroyed, IsEmpty());
+	EXPECT_EQ(queue.getPendingCount(), 2u);
+
+	backend.signaled.insert(1);
+	queue.collect();
+	EXPECT_THAT(backend.destroyed, ElementsAre(Destroyed(0, 1), Destroyed(1, 2)));
+	EXPECT_THAT(backend.deletedFences, ElementsAre(1u));
+	EXPECT_EQ(queue.getPendingCount(), 0u);
+}
+
+TEST(DeferredReleaseQueueTest, NeverDestroysBeforeOlderBatches) {
+	FakeBackend backend;
+	DeferredReleaseQueue queue(backend);
+
+	queue.release(0, 1);
+	queue.endFrame();
+	queue.release(0, 2);
+	queue.endFrame();
+
+	// El lote más antiguo manda aunque el más reciente ya esté señalizado
+	backend.signaled.insert(2);
+	queue.collect();
+	EXPECT_THAT(backend.destroyed, IsEmpty());
+
+	backend.signaled.insert(1);
+	queue.endFrame();
+	EXPECT_THAT(backend.destroyed, ElementsAre(Destroyed(0, 1), Destroyed(0, 2)));
+	EXPECT_THAT(backend.deletedFences, ElementsAre(1u, 2u));
+}
+
+TEST(DeferredReleaseQueueTest, SkipsEmptyFramesAndNullNames) {
+	FakeBackend backend;
+	DeferredReleaseQueue queue(backend);
+
+	queue.release(0, 0);
+	queue.endFrame();
+	queue.endFrame();
+	EXPECT_THAT(backend.fences, IsEmpty());
+	EXPECT_EQ(queue.getPendingCount(), 0u);
+}
+
+TEST(DeferredReleaseQueueTest, ClosesFullBatchWithoutEndFrame) {
+	FakeBackend backend;
+	DeferredReleaseQueue queue(backend);
+
+	for (uint32_t name = 1; name < DeferredReleaseQueue::kMaxBatchSize; ++name) {
+		queue.release(0, name);
+	}
+	EXPECT_THAT(backend.fences, IsEmpty());
+
+	queue.release(0, DeferredReleaseQueue::kMaxBatchSize);
+	EXPECT_THAT(backend.fences, ElementsAre(1u));
+	EXPECT_EQ(queue.getPendingCount(), DeferredReleaseQueue::kMaxBatchSize);
+}
+
+TEST(DeferredReleaseQueueTest, FlushWaitsForGpuAndDestroysInOrder) {
+	FakeBackend backend;
+	DeferredReleaseQueue queue(backend);
+
+	queue.release(0, 1);
+	queue.endFrame();
+	queue.release(2, 3);
+
+	queue.flush();
+	EXPECT_EQ(backend.waits, 1u);
+	EXPECT_THAT(backend.destroyed, ElementsAre(Destroyed(0, 1), Destroyed(2, 3)));
+	EXPECT_THAT(backend.deletedFences, ElementsAre(1u));
+	EXPECT_EQ(queue.getPendingCount(), 0u);
+
+	// Sin nada pendiente no se espera a la GPU
+	queue.flush();
+	EXPECT_EQ(backend.waits, 1u);
+}
+
+TEST(DeferredReleaseQueueTest, DestructorFlushesPendingObjects) {
+	FakeBackend backend;
+	{
+		DeferredReleaseQueue queue(backend);
+		queue.release(1, 5);
+		queue.endFrame();
+	}
+	EXPECT_EQ(backend.waits, 1u);
+	EXPECT_THAT(backend.destroyed, ElementsAre(Destroyed(1, 5)));
+	EXPECT_THAT(backend.deletedFences, ElementsAre(1u));
+}
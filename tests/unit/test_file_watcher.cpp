@@ -0,0 +1,67 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/fileWatcher.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+using namespace ::testing;
+using pgrender::FileWatcher;
+
+namespace {
+
+	class FileWatcherTest : public Test {
+	protected:
+		void SetUp() override {
+			m_directory = std::filesystem::temp_directory_path() /
+				("pgrender_watch_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+			std::filesystem::create_directories(m_directory);
+		}
+
+		void TearDown() override {
+			std::filesystem::remove_all(m_directory);
+		}
+
+		// inotify encola el evento al cerrar el fichero; sin inotify la fecha de modificación
+		// se adelanta a mano para no depender de su resolución ni de esperas
+		std::string write(const std::string& name, const std::string& contents) {
+			const auto path = m_directory / name;
+			std::ofstream(path) << contents;
+			m_writeTime += std::chrono::seconds(1);
+			std::filesystem::last_write_time(path, m_writeTime);
+			return path.string();
+		}
+
+		std::filesystem::path m_directory;
+		std::filesystem::file_time_type m_writeTime = std::filesystem::file_time_type::clock::now();
+	};
+
+}
+
+TEST_F(FileWatcherTest, ReportsModifiedWatchedFiles) {
+	const std::string shader = write("lit.frag", "void main() {}");
+	write("other.frag", "void main() {}");
+
+	FileWatcher watcher;
+	watcher.watch(shader);
+	EXPECT_THAT(watcher.poll(), IsEmpty());
+
+	write("other.frag", "// cambio no vigilado");
+	write("lit.frag", "// cambio");
+	write("lit.frag", "// otro cambio");
+
+	EXPECT_THAT(watcher.poll(), ElementsAre(FileWatcher::normalizePath(shader)));
+	EXPECT_THAT(watcher.poll(), IsEmpty());
+}
+
+TEST_F(FileWatcherTest, DetectsSaveThroughRename) {
+	const std::string shader = write("lit.vert", "void main() {}");
+
+	FileWatcher watcher;
+	watcher.watch(shader);
+
+	const std::string temporary = write("lit.vert.tmp", "// guardado atómico");
+	std::filesystem::rename(temporary, shader);
+
+	EXPECT_THAT(watcher.poll(), ElementsAre(FileWatcher::normalizePath(shader)));
+}
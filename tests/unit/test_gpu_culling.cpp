@@ -0,0 +1,75 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/gpuCulling.h>
+
+using namespace ::testing;
+using namespace pgrender;
+
+namespace {
+
+	// Misma matriz que glm::perspective (clip de profundidad en [-1, 1])
+	glm::mat4 perspective(float focal, float aspect, float zNear, float zFar) {
+		glm::mat4 m(0.0f);
+		m[0][0] = focal / aspect;
+		m[1][1] = focal;
+		m[2][2] = (zFar + zNear) / (zNear - zFar);
+		m[2][3] = -1.0f;
+		m[3][2] = 2.0f * zFar * zNear / (zNear - zFar);
+		return m;
+	}
+
+	float distance(const glm::vec4& plane, float x, float y, float z) {
+		return plane[0] * x + plane[1] * y + plane[2] * z + plane[3];
+	}
+
+	bool inside(const glm::vec4 planes[6], float x, float y, float z) {
+		for (int i = 0; i < 6; ++i) {
+			if (distance(planes[i], x, y, z) < 0.0f) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+}
+
+TEST(FrustumPlanesTest, IdentityGivesUnitClipCube) {
+	glm::vec4 planes[6];
+	GpuCulling::extractFrustumPlanes(glm::mat4(1.0f), planes);
+
+	// Orden: -x, +x, -y, +y, -z, +z; todos a distancia 1 del origen
+	const float normals[6][3] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+	for (int i = 0; i < 6; ++i) {
+		EXPECT_FLOAT_EQ(planes[i][0], normals[i][0]) << "plane " << i;
+		EXPECT_FLOAT_EQ(planes[i][1], normals[i][1]) << "plane " << i;
+		EXPECT_FLOAT_EQ(planes[i][2], normals[i][2]) << "plane " << i;
+		EXPECT_FLOAT_EQ(planes[i][3], 1.0f) << "plane " << i;
+	}
+}
+
+TEST(FrustumPlanesTest, PlanesAreNormalized) {
+	glm::mat4 ortho(1.0f);
+	ortho[0][0] = 0.25f;     // x en [-4, 4]
+
+	glm::vec4 planes[6];
+	GpuCulling::extractFrustumPlanes(ortho, planes);
+	EXPECT_FLOAT_EQ(planes[0][0], 1.0f);
+	EXPECT_FLOAT_EQ(planes[0][3], 4.0f);
+	EXPECT_FLOAT_EQ(planes[1][0], -1.0f);
+	EXPECT_FLOAT_EQ(planes[1][3], 4.0f);
+}
+
+TEST(FrustumPlanesTest, ClassifiesPointsAgainstPerspective) {
+	glm::vec4 planes[6];
+	GpuCulling::extractFrustumPlanes(perspective(1.0f, 1.0f, 1.0f, 100.0f), planes);
+
+	EXPECT_TRUE(inside(planes, 0.0f, 0.0f, -5.0f));
+	EXPECT_TRUE(inside(planes, 4.9f, -4.9f, -5.0f));
+	EXPECT_FALSE(inside(planes, 5.1f, 0.0f, -5.0f));    // Fuera por la derecha (fov 90°)
+	EXPECT_FALSE(inside(planes, 0.0f, 0.0f, -0.5f));    // Delante del plano cercano
+	EXPECT_FALSE(inside(planes, 0.0f, 0.0f, -101.0f));  // Detrás del plano lejano
+	EXPECT_FALSE(inside(planes, 0.0f, 0.0f, 5.0f));     // Detrás de la cámara
+
+	// Las distancias son métricas: el plano cercano está en z = -1
+	EXPECT_NEAR(distance(planes[4], 0.0f, 0.0f, -3.0f), 2.0f, 1e-4f);
+	EXPECT_NEAR(distance(planes[5], 0.0f, 0.0f, -90.0f), 10.0f, 1e-3f);
+}
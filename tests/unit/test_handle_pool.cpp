@@ -0,0 +1,136 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/handlePool.h>
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace ::testing;
+using namespace pgrender;
+
+namespace {
+
+	// Objeto no copiable ni movible que cuenta sus destrucciones
+	struct Tracked {
+		Tracked(int value, int& destroyed) : value(value), destroyed(destroyed) {}
+		~Tracked() { ++destroyed; }
+		Tracked(const Tracked&) = delete;
+		Tracked& operator=(const Tracked&) = delete;
+
+		int value;
+		int& destroyed;
+	};
+
+}
+
+TEST(HandlePoolTest, CreatesAndResolvesHandles) {
+	HandlePool<BufferHandle, std::string> pool;
+	const BufferHandle first = pool.create("first");
+	const BufferHandle second = pool.create(3, 'x');
+
+	EXPECT_TRUE(first);
+	EXPECT_NE(first, second);
+	EXPECT_EQ(pool.size(), 2u);
+	ASSERT_NE(pool.get(first), nullptr);
+	EXPECT_EQ(*pool.get(first), "first");
+	EXPECT_EQ(*pool.get(second), "xxx");
+
+	EXPECT_EQ(pool.get(BufferHandle()), nullptr);
+	EXPECT_FALSE(pool.contains(BufferHandle()));
+	EXPECT_EQ(BufferHandle::fromValue(first.value()), first);
+}
+
+TEST(HandlePoolTest, DestroyInvalidatesStaleHandles) {
+	HandlePool<TextureHandle, std::string> pool;
+	const TextureHandle handle = pool.create("texture");
+	EXPECT_TRUE(pool.destroy(handle));
+	EXPECT_FALSE(pool.destroy(handle));
+	EXPECT_EQ(pool.get(handle), nullptr);
+	EXPECT_TRUE(pool.empty());
+
+	// El hueco se reutiliza con otra generación: el handle antiguo sigue siendo inválido
+	const TextureHandle reused = pool.create("other");
+	EXPECT_EQ(reused.index(), handle.index());
+	EXPECT_NE(reused.generation(), handle.generation());
+	EXPECT_EQ(pool.get(handle), nullptr);
+	EXPECT_EQ(*pool.get(reused), "other");
+}
+
+TEST(HandlePoolTest, KeepsObjectsInPlace) {
+	int destroyed = 0;
+	{
+		HandlePool<SamplerHandle, Tracked> pool;
+		const SamplerHandle first = pool.create(1, destroyed);
+		const Tracked* address = pool.get(first);
+		for (int i = 0; i < 1000; ++i) {
+			pool.create(i, destroyed);
+		}
+		EXPECT_EQ(pool.get(first), address);
+		EXPECT_EQ(pool.get(first)->value, 1);
+		EXPECT_EQ(destroyed, 0);
+
+		pool.destroy(first);
+		EXPECT_EQ(destroyed, 1);
+		pool.clear();
+		EXPECT_EQ(destroyed, 1001);
+		EXPECT_TRUE(pool.empty());
+	}
+	EXPECT_EQ(destroyed, 1001);
+}
+
+TEST(HandlePoolTest, RetiresSlotsWithExhaustedGenerations) {
+	HandlePool<BufferHandle, int> pool;
+	std::unordered_set<BufferHandle> issued;
+	BufferHandle handle = pool.create(0);
+	const uint32_t index = handle.index();
+	while (handle.index() == index) {
+		EXPECT_TRUE(issued.insert(handle).second);
+		pool.destroy(handle);
+		handle = pool.create(0);
+	}
+
+	// Todas las generaciones del hueco se han usado una vez y ninguna vuelve a ser válida
+	EXPECT_EQ(issued.size(), BufferHandle::kMaxGeneration);
+	for (BufferHandle stale : issued) {
+		EXPECT_FALSE(pool.contains(stale));
+	}
+	EXPECT_TRUE(pool.contains(handle));
+}
+
+TEST(HandlePoolTest, RejectsGenerationZero) {
+	HandlePool<BufferHandle, int> pool;
+	pool.create(0);
+	BufferHandle handle = pool.create(1);
+	const uint32_t index = handle.index();
+	ASSERT_NE(index, 0u);
+
+	// Un handle de generación 0 no es nulo, pero nunca se emite
+	const BufferHandle forged(index, 0);
+	EXPECT_FALSE(forged.isNull());
+	EXPECT_FALSE(pool.contains(forged));
+
+	// Tampoco resuelve el hueco una vez retirado, cuya generación pasa a ser 0
+	while (handle.index() == index) {
+		pool.destroy(handle);
+		handle = pool.create(1);
+	}
+	EXPECT_FALSE(pool.contains(forged));
+	EXPECT_EQ(pool.get(forged), nullptr);
+	EXPECT_FALSE(pool.destroy(forged));
+	EXPECT_EQ(pool.size(), 2u);
+}
+
+TEST(HandlePoolTest, GrowsAcrossChunks) {
+	HandlePool<TextureHandle, uint32_t> pool;
+	std::vector<TextureHandle> handles;
+	for (uint32_t i = 0; i < 3 * HandlePool<TextureHandle, uint32_t>::kChunkSize + 1; ++i) {
+		handles.push_back(pool.create(i));
+	}
+
+	const uint32_t* first = pool.get(handles[0]);
+	for (uint32_t i = 0; i < handles.size(); ++i) {
+		EXPECT_EQ(handles[i].index(), i);
+		EXPECT_EQ(*pool.get(handles[i]), i);
+	}
+	EXPECT_EQ(pool.get(handles[0]), first);
+}
@@ -0,0 +1,126 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/mipGenerator.h>
+#include <PGRenderCore/threadPool.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace ::testing;
+using pgrender::MipGenerator;
+using pgrender::ThreadPool;
+
+namespace {
+
+	std::vector<uint8_t> makeCheckerboard(uint32_t width, uint32_t height) {
+		std::vector<uint8_t> image(width * height * 4);
+		for (uint32_t y = 0; y < height; ++y) {
+			for (uint32_t x = 0; x < width; ++x) {
+				const uint8_t value = ((x + y) & 1) ? 255 : 0;
+				uint8_t* texel = &image[(y * width + x) * 4];
+				texel[0] = texel[1] = texel[2] = value;
+				texel[3] = 255;
+			}
+		}
+		return image;
+	}
+
+	// Follaje: alfa con ruido determinista uniforme
+	std::vector<uint8_t> makeFoliage(uint32_t width, uint32_t height) {
+		std::vector<uint8_t> image(width * height * 4);
+		uint32_t state = 12345;
+		for (size_t i = 0; i < image.size(); i += 4) {
+			state = state * 1664525u + 1013904223u;
+			image[i] = 40; image[i + 1] = 160; image[i + 2] = 60;
+			image[i + 3] = static_cast<uint8_t>(state >> 24);
+		}
+		return image;
+	}
+
+	float coverage(const MipGenerator::Level& level, uint8_t cutoff) {
+		size_t covered = 0;
+		for (size_t i = 3; i < level.rgba.size(); i += 4) {
+			covered += level.rgba[i] >= cutoff;
+		}
+		return static_cast<float>(covered) / (level.width * level.height);
+	}
+
+}
+
+TEST(MipGeneratorTest, ChainSizesHandleOddDimensions) {
+	const auto image = makeCheckerboard(13, 7);
+	const auto levels = MipGenerator::generate(image.data(), 13, 7, 0, {});
+
+	ASSERT_THAT(levels, SizeIs(4));
+	EXPECT_EQ(MipGenerator::fullChainLength(13, 7), 4u);
+	EXPECT_EQ(levels[0].rgba, image);
+	EXPECT_EQ(levels[1].width, 6u);
+	EXPECT_EQ(levels[1].height, 3u);
+	EXPECT_EQ(levels[2].width, 3u);
+	EXPECT_EQ(levels[2].height, 1u);
+	EXPECT_EQ(levels[3].width, 1u);
+	EXPECT_EQ(levels[3].rgba.size(), 4u);
+}
+
+TEST(MipGeneratorTest, BoxFilterAveragesInLinearSpace) {
+	const auto image = makeCheckerboard(8, 8);
+	MipGenerator::Options options;
+	options.filter = MipGenerator::Filter::Box;
+
+	auto levels = MipGenerator::generate(image.data(), 8, 8, 2, options);
+	EXPECT_THAT(levels[1].rgba[0], AnyOf(127, 128));
+
+	// Media lineal de negro y blanco = 0.5 lineal = 188 en sRGB
+	options.srgb = true;
+	levels = MipGenerator::generate(image.data(), 8, 8, 2, options);
+	EXPECT_EQ(levels[1].rgba[0], 188);
+	EXPECT_EQ(levels[1].rgba[3], 255);
+}
+
+TEST(MipGeneratorTest, FiltersPreserveConstantImages) {
+	std::vector<uint8_t> image(32 * 16 * 4);
+	for (size_t i = 0; i < image.size(); i += 4) {
+		image[i] = 10; image[i + 1] = 100; image[i + 2] = 200; image[i + 3] = 77;
+	}
+	for (auto filter : { MipGenerator::Filter::Box, MipGenerator::Filter::Kaiser, MipGenerator::Filter::Lanczos }) {
+		MipGenerator::Options options;
+		options.filter = filter;
+		options.srgb = true;
+		for (const auto& level : MipGenerator::generate(image.data(), 32, 16, 0, options)) {
+			EXPECT_THAT(std::vector<uint8_t>(level.rgba.begin(), level.rgba.begin() + 4), ElementsAre(10, 100, 200, 77));
+		}
+	}
+}
+
+TEST(MipGeneratorTest, PreservesAlphaCoverage) {
+	const auto image = makeFoliage(64, 64);
+	MipGenerator::Options options;
+	options.alphaCutoff = 0.75f;
+	const auto plain = MipGenerator::generate(image.data(), 64, 64, 4, options);
+	options.preserveAlphaCoverage = true;
+	const auto preserved = MipGenerator::generate(image.data(), 64, 64, 4, options);
+
+	// Al promediar, el alfa tiende a la media y casi nada supera el umbral
+	const float reference = coverage(plain[0], 192);
+	EXPECT_LT(coverage(plain[3], 192), reference - 0.1f);
+	EXPECT_NEAR(coverage(preserved[3], 192), reference, 0.05f);
+}
+
+TEST(MipGeneratorTest, OutputIsIndependentOfSimdAndThreads) {
+	const auto image = makeFoliage(45, 30);
+	ThreadPool pool(3);
+
+	MipGenerator::Options scalar;
+	scalar.srgb = true;
+	scalar.preserveAlphaCoverage = true;
+	scalar.useSimd = false;
+	MipGenerator::Options parallel = scalar;
+	parallel.useSimd = true;
+	parallel.threadPool = &pool;
+
+	const auto reference = MipGenerator::generate(image.data(), 45, 30, 0, scalar);
+	const auto threaded = MipGenerator::generateAsync(image, 45, 30, 0, parallel).get();
+	ASSERT_EQ(threaded.size(), reference.size());
+	for (size_t i = 0; i < reference.size(); ++i) {
+		EXPECT_EQ(threaded[i].rgba, reference[i].rgba);
+	}
+}
@@ -0,0 +1,115 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/programReflection.h>
+#include <PGRenderCore/vertexLayout.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+using pgrender::ProgramReflection;
+using pgrender::VertexLayoutBuilder;
+using pgrender::VertexAttributeType;
+using pgrender::hashName;
+
+namespace {
+
+	ProgramReflection::Uniform makeUniform(const std::string& name, int32_t location, uint32_t offset = 0) {
+		ProgramReflection::Uniform uniform;
+		uniform.name = name;
+		uniform.hash = hashName(name);
+		uniform.baseType = ProgramReflection::BaseType::Float;
+		uniform.location = location;
+		uniform.offset = offset;
+		return uniform;
+	}
+
+	ProgramReflection::VertexInput makeInput(const std::string& name, uint32_t location,
+		ProgramReflection::BaseType type, uint32_t locationCount = 1) {
+		ProgramReflection::VertexInput input;
+		input.name = name;
+		input.hash = hashName(name);
+		input.location = location;
+		input.baseType = type;
+		input.locationCount = locationCount;
+		return input;
+	}
+
+}
+
+TEST(ProgramReflectionTest, HashesNamesAtCompileTime) {
+	static_assert(hashName("") == 2166136261u, "FNV-1a offset basis");
+	constexpr auto hash = hashName("u_model");
+	EXPECT_EQ(hash, hashName(std::string("u_model")));
+	EXPECT_NE(hashName("u_model"), hashName("u_view"));
+}
+
+TEST(ProgramReflectionTest, FindsResourcesByHash) {
+	ProgramReflection::Block block;
+	block.name = "Camera";
+	block.hash = hashName("Camera");
+	block.binding = 2;
+	block.dataSize = 128;
+	block.members = { makeUniform("view", -1, 64), makeUniform("proj", -1, 0) };
+
+	ProgramReflection reflection(
+		{ makeUniform("u_color", 3), makeUniform("u_time", 1), makeUniform("u_model", 0) },
+		{ block }, {}, { makeInput("a_position", 0, ProgramReflection::BaseType::Float) });
+
+	EXPECT_FALSE(reflection.empty());
+	EXPECT_EQ(reflection.getUniformLocation(hashName("u_color")), 3);
+	EXPECT_EQ(reflection.getUniformLocation(hashName("u_time")), 1);
+	EXPECT_EQ(reflection.getUniformLocation(hashName("u_missing")), -1);
+	EXPECT_THAT(reflection.findStorageBlock(hashName("Camera")), IsNull());
+
+	const auto* camera = reflection.findUniformBlock(hashName("Camera"));
+	ASSERT_THAT(camera, NotNull());
+	EXPECT_EQ(camera->binding, 2u);
+	ASSERT_THAT(camera->members, SizeIs(2));
+	EXPECT_EQ(camera->members[0].name, "proj");
+	ASSERT_THAT(camera->findMember(hashName("view")), NotNull());
+	EXPECT_EQ(camera->findMember(hashName("view"))->offset, 64u);
+
+	const auto& uniforms = reflection.getUniforms();
+	EXPECT_TRUE(std::is_sorted(uniforms.begin(), uniforms.end(),
+		[](const auto& a, const auto& b) { return a.hash < b.hash; }));
+}
+
+TEST(ProgramReflectionTest, RejectsHashCollisions) {
+	auto first = makeUniform("a", 0);
+	auto second = makeUniform("b", 1);
+	second.hash = first.hash;
+	EXPECT_THROW(ProgramReflection({ first, second }, {}, {}, {}), std::runtime_error);
+}
+
+TEST(ProgramReflectionTest, ValidatesVertexLayoutAgainstInputs) {
+	ProgramReflection reflection({}, {}, {}, {
+		makeInput("a_position", 0, ProgramReflection::BaseType::Float),
+		makeInput("a_joints", 1, ProgramReflection::BaseType::UInt),
+		makeInput("a_instance", 2, ProgramReflection::BaseType::Float, 4) });
+
+	auto matching = VertexLayoutBuilder()
+		.addAttribute(0, VertexAttributeType::Float3)
+		.addAttribute(1, VertexAttributeType::UByte4)
+		.addAttribute(2, VertexAttributeType::Float4, 1)
+		.addAttribute(3, VertexAttributeType::Float4, 1)
+		.addAttribute(4, VertexAttributeType::Float4, 1)
+		.addAttribute(5, VertexAttributeType::Float4, 1)
+		.build();
+	EXPECT_NO_THROW(reflection.validateVertexLayout(matching));
+
+	auto mismatched = VertexLayoutBuilder()
+		.addAttribute(0, VertexAttributeType::Float3)
+		.addAttribute(1, VertexAttributeType::Float4)
+		.addAttribute(2, VertexAttributeType::Float4, 1)
+		.build();
+	try {
+		reflection.validateVertexLayout(mismatched);
+		FAIL() << "Expected std::invalid_argument";
+	}
+	catch (const std::invalid_argument& e) {
+		EXPECT_THAT(e.what(), HasSubstr("'a_joints' (location 1) expects uint"));
+		EXPECT_THAT(e.what(), HasSubstr("'a_instance' (location 3) has no vertex attribute"));
+	}
+}
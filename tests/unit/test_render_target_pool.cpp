@@ -0,0 +1,134 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/renderTargetPool.h>
+#include "fakeContext.h"
+
+#include <stdexcept>
+
+using namespace ::testing;
+using namespace pgrender;
+using namespace pgrender::fakes;
+
+namespace {
+
+	RenderTargetPool::Key colorKey(uint32_t width, uint32_t height) {
+		RenderTargetPool::Key key;
+		key.width = width;
+		key.height = height;
+		key.colorFormats = { Texture::Format::RGBA8 };
+		key.hasDepthStencil = true;
+		return key;
+	}
+
+}
+
+TEST(RenderTargetPoolTest, ReusesReleasedTargets) {
+	FakeContext context;
+	RenderTargetPool pool(context);
+
+	auto first = pool.acquire(colorKey(1280, 720));
+	pool.release(first);
+	auto second = pool.acquire(colorKey(1280, 720));
+
+	EXPECT_EQ(first, second);
+	EXPECT_EQ(context.renderTargetsCreated, 1u);
+	EXPECT_EQ(pool.getStatistics().hits, 1u);
+	EXPECT_EQ(pool.getStatistics().misses, 1u);
+
+	// Mientras está en uso, otra petición igual crea un render target nuevo
+	auto third = pool.acquire(colorKey(1280, 720));
+	EXPECT_NE(third, second);
+	EXPECT_EQ(pool.getStatistics().totalTargets, 2u);
+	EXPECT_EQ(pool.getStatistics().inUseTargets, 2u);
+}
+
+TEST(RenderTargetPoolTest, RoundsSizesForDynamicResolution) {
+	FakeContext context;
+	RenderTargetPool pool(context, 3, 64);
+
+	auto target = pool.acquire(colorKey(1250, 700));
+	EXPECT_EQ(target->getWidth(), 1280u);
+	EXPECT_EQ(target->getHeight(), 704u);
+	pool.release(target);
+
+	// Un paso de resolución dinámica dentro del mismo múltiplo reutiliza el render target
+	auto scaled = pool.acquire(colorKey(1221, 690));
+	EXPECT_EQ(scaled, target);
+	EXPECT_EQ(context.renderTargetsCreated, 1u);
+	pool.release(scaled);
+
+	RenderTargetPool exact(context, 3, 1);
+	EXPECT_EQ(exact.acquire(colorKey(1250, 700))->getWidth(), 1250u);
+	EXPECT_THROW(RenderTargetPool(context, 3, 0), std::invalid_argument);
+}
+
+TEST(RenderTargetPoolTest, EvictsTargetsUnusedForTooManyFrames) {
+	FakeContext context;
+	RenderTargetPool pool(context, 2);
+
+	auto target = pool.acquire(colorKey(512, 512));
+	const size_t memory = RenderTargetPool::estimateMemory(colorKey(512, 512));
+	EXPECT_EQ(pool.getStatistics().totalMemoryBytes, memory);
+	pool.release(target);
+	EXPECT_EQ(pool.getStatistics().freeMemoryBytes, memory);
+	target.reset();
+
+	pool.nextFrame();
+	pool.nextFrame();
+	EXPECT_EQ(pool.getStatistics().totalTargets, 1u);
+	pool.nextFrame();
+	EXPECT_EQ(pool.getStatistics().totalTargets, 0u);
+	EXPECT_EQ(pool.getStatistics().evictions, 1u);
+	EXPECT_EQ(pool.getStatistics().totalMemoryBytes, 0u);
+	EXPECT_EQ(pool.getStatistics().freeMemoryBytes, 0u);
+
+	pool.acquire(colorKey(512, 512));
+	EXPECT_EQ(context.renderTargetsCreated, 2u);
+}
+
+TEST(RenderTargetPoolTest, TrimKeepsTargetsInUse) {
+	FakeContext context;
+	RenderTargetPool pool(context);
+
+	auto used = pool.acquire(colorKey(256, 256));
+	pool.release(pool.acquire(colorKey(256, 256)));
+	auto freeTarget = pool.acquire(colorKey(128, 128));
+	pool.release(freeTarget);
+
+	pool.trim();
+	EXPECT_EQ(pool.getStatistics().totalTargets, 1u);
+	EXPECT_EQ(pool.getStatistics().inUseTargets, 1u);
+	EXPECT_EQ(pool.getStatistics().freeMemoryBytes, 0u);
+	EXPECT_NO_THROW(pool.release(used));
+}
+
+TEST(RenderTargetPoolTest, FailedCreationLeavesPoolUnchanged) {
+	FakeContext context;
+	RenderTargetPool pool(context);
+
+	context.onCreateRenderTarget = [](const RenderTarget::Desc&) { throw std::runtime_error("out of memory"); };
+	EXPECT_THROW(pool.acquire(colorKey(640, 480)), std::runtime_error);
+	EXPECT_EQ(pool.getStatistics().totalTargets, 0u);
+	EXPECT_EQ(pool.getStatistics().misses, 0u);
+
+	context.onCreateRenderTarget = nullptr;
+	auto target = pool.acquire(colorKey(640, 480));
+	EXPECT_EQ(pool.getStatistics().totalTargets, 1u);
+	EXPECT_EQ(pool.getStatistics().inUseTargets, 1u);
+}
+
+TEST(RenderTargetPoolTest, RejectsInvalidRequestsAndForeignReleases) {
+	FakeContext context;
+	RenderTargetPool pool(context);
+
+	EXPECT_THROW(pool.acquire(colorKey(0, 480)), std::invalid_argument);
+	RenderTargetPool::Key empty;
+	empty.width = empty.height = 64;
+	EXPECT_THROW(pool.acquire(empty), std::invalid_argument);
+
+	auto target = pool.acquire(colorKey(64, 64));
+	pool.release(target);
+	EXPECT_THROW(pool.release(target), std::runtime_error);
+
+	RenderTargetPool other(context);
+	EXPECT_THROW(other.release(target), std::invalid_argument);
+}
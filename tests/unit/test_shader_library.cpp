@@ -0,0 +1,299 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/shaderLibrary.h>
+#include "fakeContext.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+using namespace pgrender;
+using pgrender::fakes::FakeContext;
+using pgrender::fakes::FakeProgram;
+
+namespace {
+
+	using VariantKey = ShaderLibrary::VariantKey;
+
+	const char* kLitSource =
+		"#version 450\n"
+		"#ifdef FOG\n"
+		"#endif\n"
+		"#if defined(QUALITY_MEDIUM) || defined(QUALITY_HIGH)\n"
+		"#endif\n"
+		"#ifdef SKINNING\n"
+		"#endif\n"
+		"void main() {}\n";
+
+	ShaderLibrary::ShaderDesc litDesc(const std::string& name, const std::string& source = kLitSource) {
+		ShaderLibrary::ShaderDesc desc;
+		desc.name = name;
+		desc.stages.push_back({ ShaderStage::Fragment, source });
+		desc.keywords = {
+			{ "FOG", {} },
+			{ "QUALITY", { "", "QUALITY_MEDIUM", "QUALITY_HIGH" } },
+			{ "SKINNING", {} },
+			{ "UNUSED", {} },
+		};
+		return desc;
+	}
+
+	FakeProgram& fake(const std::shared_ptr<Program>& program) {
+		return static_cast<FakeProgram&>(*program);
+	}
+
+	// Directorio temporal con ficheros de shader; la fecha de modificación se adelanta a mano
+	// para que FileWatcher vea cada escritura sin esperas
+	class ShaderFiles {
+	public:
+		ShaderFiles() {
+			m_directory = std::filesystem::temp_directory_path() /
+				("pgrender_shaders_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+			std::filesystem::create_directories(m_directory);
+		}
+
+		~ShaderFiles() {
+			std::filesystem::remove_all(m_directory);
+		}
+
+		std::string write(const std::string& name, const std::string& contents) {
+			const auto path = m_directory / name;
+			std::ofstream(path) << contents;
+			m_writeTime += std::chrono::seconds(1);
+			std::filesystem::last_write_time(path, m_writeTime);
+			return path.string();
+		}
+
+	private:
+		std::filesystem::path m_directory;
+		std::filesystem::file_time_type m_writeTime = std::filesystem::file_time_type::clock::now();
+	};
+
+	const char* kEditedSource =
+		"#version 450\n"
+		"#ifdef FOG\n"
+		"#endif\n"
+		"void main() { /* editado */ }\n";
+
+	ShaderLibrary::ShaderDesc fileDesc(const std::string& name, const std::string& path) {
+		ShaderLibrary::ShaderDesc desc = litDesc(name, "");
+		desc.stageFiles = { path };
+		return desc;
+	}
+
+}
+
+TEST(ShaderLibraryTest, InsertsDefinesAfterVersion) {
+	const std::string source =
+		"// comentario\n"
+		"#version 450 core\n"
+		"void main() {}\n";
+
+	const std::string variant = ShaderLibrary::buildVariantSource(source, { "SKINNING", "SHADOWS_PCF" });
+
+	EXPECT_EQ(variant,
+		"// comentario\n"
+		"#version 450 core\n"
+		"#define SKINNING 1\n"
+		"#define SHADOWS_PCF 1\n"
+		"#line 3\n"
+		"void main() {}\n");
+}
+
+TEST(ShaderLibraryTest, InsertsDefinesAtStartWithoutVersion) {
+	const std::string variant = ShaderLibrary::buildVariantSource("void main() {}", { "FOG" });
+	EXPECT_EQ(variant, "#define FOG 1\n#line 1\nvoid main() {}");
+}
+
+TEST(ShaderLibraryTest, LeavesSourceUntouchedWithoutDefines) {
+	const std::string source = "#version 450\nvoid main() {}\n";
+	EXPECT_EQ(ShaderLibrary::buildVariantSource(source, {}), source);
+}
+
+TEST(ShaderLibraryTest, HandlesVersionOnLastLine) {
+	const std::string variant = ShaderLibrary::buildVariantSource("#version 460", { "FOG" });
+	EXPECT_EQ(variant, "#version 460\n#define FOG 1\n#line 2\n");
+}
+
+TEST(ShaderLibraryTest, PacksKeywordsInDeclarationOrder) {
+	FakeContext context;
+	ShaderLibrary library(context);
+	const auto shader = library.add(litDesc("lit"));
+
+	// Booleana: un bit; enumerada de tres valores: dos bits
+	EXPECT_EQ(library.keyword(shader, "FOG"), 1u);
+	EXPECT_EQ(library.keyword(shader, "QUALITY", ""), 0u);
+	EXPECT_EQ(library.keyword(shader, "QUALITY", "QUALITY_MEDIUM"), 1u << 1);
+	EXPECT_EQ(library.keyword(shader, "QUALITY", "QUALITY_HIGH"), 2u << 1);
+	EXPECT_EQ(library.keyword(shader, "SKINNING"), 1u << 3);
+	EXPECT_EQ(library.keyword(shader, "UNUSED"), 1u << 4);
+
+	EXPECT_THROW(library.keyword(shader, "MISSING"), std::invalid_argument);
+	EXPECT_THROW(library.keyword(shader, "QUALITY", "QUALITY_ULTRA"), std::invalid_argument);
+
+	const auto key = library.keyword(shader, "SKINNING") | library.keyword(shader, "QUALITY", "QUALITY_HIGH");
+	EXPECT_THAT(library.getDefines(shader, key), ElementsAre("QUALITY_HIGH", "SKINNING"));
+}
+
+TEST(ShaderLibraryTest, RejectsKeywordsBeyondSixtyFourBits) {
+	FakeContext context;
+	ShaderLibrary library(context);
+	ShaderLibrary::ShaderDesc desc = litDesc("wide");
+	desc.keywords.clear();
+	for (int i = 0; i < 65; ++i) {
+		desc.keywords.push_back({ "K" + std::to_string(i), {} });
+	}
+	EXPECT_THROW(library.add(desc), std::invalid_argument);
+
+	desc.keywords = { { "FOG", {} }, { "FOG", {} } };
+	EXPECT_THROW(library.add(desc), std::invalid_argument);
+}
+
+TEST(ShaderLibraryTest, NormalizesKeysOfUnusedKeywords) {
+	FakeContext context;
+	ShaderLibrary library(context);
+	const auto shader = library.add(litDesc("lit"));
+	const auto fog = library.keyword(shader, "FOG");
+	const auto unused = library.keyword(shader, "UNUSED");
+
+	// UNUSED no aparece en el código: no define nada ni crea otra variante
+	EXPECT_THAT(library.getDefines(shader, fog | unused), ElementsAre("FOG"));
+	EXPECT_EQ(library.getVariant(shader, fog | unused), library.getVariant(shader, fog));
+	EXPECT_EQ(library.getVariantStatus(shader, unused), Program::CompileStatus::NotCompiled);
+	EXPECT_EQ(library.getStatistics().variantsRequested, 1u);
+	EXPECT_EQ(library.getStatistics().programsCompiled, 1u);
+
+	EXPECT_THROW(library.getVariant(shader, VariantKey(1) << 5), std::invalid_argument);
+	EXPECT_THROW(library.getVariant(shader, VariantKey(3) << 1), std::invalid_argument);
+}
+
+TEST(ShaderLibraryTest, SharesProgramsWithIdenticalCode) {
+	FakeContext context;
+	ShaderLibrary library(context);
+	const auto first = library.add(litDesc("first"));
+	const auto second = library.add(litDesc("second"));
+	const auto other = library.add(litDesc("other", "#version 450\n#ifdef FOG\n#endif\nvoid other() {}\n"));
+
+	const auto fog = library.keyword(first, "FOG");
+	const auto program = library.getVariant(first, fog);
+	EXPECT_EQ(library.getVariant(second, fog), program);
+	EXPECT_NE(library.getVariant(other, fog), program);
+
+	EXPECT_EQ(context.programs.size(), 2u);
+	EXPECT_EQ(library.getStatistics().programsShared, 1u);
+}
+
+TEST(ShaderLibraryTest, ReturnsFallbackWhileVariantCompiles) {
+	FakeContext context;
+	ShaderLibrary library(context);
+	const auto shader = library.add(litDesc("lit"));
+	const auto fog = library.keyword(shader, "FOG");
+
+	context.pendingPolls = 1;
+	const auto fallback = library.getVariant(shader, fog);
+	EXPECT_EQ(fake(fallback).stageSource(ShaderStage::Fragment), kLitSource);
+	EXPECT_EQ(library.getVariantStatus(shader, fog), Program::CompileStatus::Pending);
+	EXPECT_EQ(library.getStatistics().programsPending, 1u);
+
+	library.update();
+	EXPECT_EQ(library.getVariantStatus(shader, fog), Program::CompileStatus::Ready);
+	EXPECT_EQ(library.getStatistics().programsPending, 0u);
+	const auto program = library.getVariant(shader, fog);
+	EXPECT_NE(program, fallback);
+	EXPECT_THAT(fake(program).stageSource(ShaderStage::Fragment), HasSubstr("#define FOG 1"));
+}
+
+TEST(ShaderLibraryTest, ReturnsFallbackWhenVariantFails) {
+	FakeContext context;
+	ShaderLibrary library(context);
+	ShaderLibrary::ShaderDesc desc = litDesc("lit", std::string(kLitSource) + "#ifdef COMPILE_ERROR\n#endif\n");
+	desc.keywords.push_back({ FakeProgram::kCompileError, {} });
+	const auto shader = library.add(desc);
+	const auto broken = library.keyword(shader, FakeProgram::kCompileError);
+
+	const auto fallback = library.getVariant(shader, 0);
+	EXPECT_EQ(library.getVariant(shader, broken), fallback);
+	EXPECT_EQ(library.getVariantStatus(shader, broken), Program::CompileStatus::Failed);
+	EXPECT_EQ(library.getStatistics().programsFailed, 1u);
+}
+
+TEST(ShaderLibraryTest, ThrowsWhenFallbackFails) {
+	FakeContext context;
+	ShaderLibrary library(context);
+	ShaderLibrary::ShaderDesc desc = litDesc("lit", std::string(kLitSource) + "#ifdef COMPILE_ERROR\n#endif\n");
+	desc.keywords.push_back({ FakeProgram::kCompileError, {} });
+	desc.fallbackKey = VariantKey(1) << 5;
+	const auto shader = library.add(desc);
+
+	// FOG sigue compilando y hay que recurrir a la reserva, que no compila
+	context.pendingPolls = 1;
+	EXPECT_THROW(library.getVariant(shader, library.keyword(shader, "FOG")), std::runtime_error);
+}
+
+TEST(ShaderLibraryTest, ReloadAdoptsExclusiveProgramInPlace) {
+	ShaderFiles files;
+	const std::string path = files.write("lit.frag", kLitSource);
+
+	FakeContext context;
+	ShaderLibrary library(context);
+	const auto shader = library.add(fileDesc("lit", path));
+	std::vector<std::string> reloaded;
+	library.enableHotReload([&reloaded](const std::string& name, bool success, const std::string&) {
+		EXPECT_TRUE(success);
+		reloaded.push_back(name);
+	});
+
+	const auto fog = library.keyword(shader, "FOG");
+	const auto program = library.getVariant(shader, fog);
+
+	files.write("lit.frag", kEditedSource);
+	library.update();
+
+	// Los pipelines que ya tienen el programa ven el código nuevo
+	EXPECT_THAT(reloaded, ElementsAre("lit"));
+	EXPECT_EQ(library.getVariant(shader, fog), program);
+	EXPECT_EQ(fake(program).adoptions, 1u);
+	EXPECT_THAT(fake(program).stageSource(ShaderStage::Fragment), HasSubstr("editado"));
+	EXPECT_EQ(library.getStatistics().programsReloaded, 1u);
+}
+
+TEST(ShaderLibraryTest, ReloadDoesNotChangeProgramsSharedWithOtherShaders) {
+	ShaderFiles files;
+	const std::string path = files.write("lit.frag", kLitSource);
+
+	FakeContext context;
+	ShaderLibrary library(context);
+	const auto edited = library.add(fileDesc("edited", path));
+	const auto other = library.add(litDesc("other"));
+	library.enableHotReload();
+
+	const auto fog = library.keyword(edited, "FOG");
+	const auto skinning = library.keyword(edited, "SKINNING");
+	const auto shared = library.getVariant(edited, fog);
+	ASSERT_EQ(library.getVariant(other, fog), shared);
+	library.getVariant(edited, skinning);
+	ASSERT_EQ(context.programs.size(), 2u);
+
+	files.write("lit.frag", kEditedSource);
+	library.update();
+
+	// Sólo se recompila FOG: SKINNING ya no aparece y su variante se olvida
+	EXPECT_EQ(context.programs.size(), 3u);
+	EXPECT_EQ(library.getVariantStatus(edited, skinning), Program::CompileStatus::NotCompiled);
+
+	const auto reloaded = library.getVariant(edited, fog);
+	EXPECT_NE(reloaded, shared);
+	EXPECT_THAT(fake(reloaded).stageSource(ShaderStage::Fragment), HasSubstr("editado"));
+
+	// El otro shader conserva su programa y su código
+	EXPECT_EQ(library.getVariant(other, fog), shared);
+	EXPECT_EQ(fake(shared).adoptions, 0u);
+	EXPECT_THAT(fake(shared).stageSource(ShaderStage::Fragment), Not(HasSubstr("editado")));
+
+	// Un tercer shader con el código editado comparte el programa recargado
+	const auto copy = library.add(litDesc("copy", kEditedSource));
+	EXPECT_EQ(library.getVariant(copy, fog), reloaded);
+}
@@ -0,0 +1,78 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/shaderPreprocessor.h>
+#include <PGRenderCore/shader.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+using namespace ::testing;
+using pgrender::ShaderPreprocessor;
+
+TEST(ShaderPreprocessorTest, LeavesSourceWithoutIncludesUntouched) {
+	ShaderPreprocessor preprocessor;
+	const std::string source = "#version 450\nvoid main() {}\n";
+	const auto result = preprocessor.process(source);
+	EXPECT_EQ(result.source, source);
+	EXPECT_EQ(result.hash, pgrender::hashContent(source.data(), source.size()));
+}
+
+TEST(ShaderPreprocessorTest, ExpandsVirtualIncludesWithLineDirectives) {
+	ShaderPreprocessor preprocessor;
+	preprocessor.addVirtualFile("common.glsl", "#pragma once\nfloat twice(float x) { return 2.0 * x; }\n");
+
+	const auto result = preprocessor.process(
+		"#version 450\n"
+		"#extension GL_GOOGLE_include_directive : require\n"
+		"#include \"common.glsl\"\n"
+		"#include <common.glsl>\n"
+		"void main() {}\n", "main.frag");
+
+	EXPECT_EQ(result.source,
+		"#version 450\n"
+		"\n"
+		"#line 1 1\n"
+		"\n"
+		"float twice(float x) { return 2.0 * x; }\n"
+		"#line 4 0\n"
+		"\n"
+		"void main() {}\n");
+	EXPECT_THAT(result.files, ElementsAre("main.frag", "common.glsl"));
+}
+
+TEST(ShaderPreprocessorTest, RejectsCyclicAndMissingIncludes) {
+	ShaderPreprocessor preprocessor;
+	preprocessor.addVirtualFile("a.glsl", "#include \"b.glsl\"\n");
+	preprocessor.addVirtualFile("b.glsl", "#include \"a.glsl\"\n");
+
+	EXPECT_THROW(preprocessor.process("#include \"a.glsl\"\n"), std::runtime_error);
+	EXPECT_THROW(preprocessor.process("#include \"missing.glsl\"\n"), std::runtime_error);
+	EXPECT_THROW(preprocessor.process("#include missing.glsl\n"), std::runtime_error);
+}
+
+TEST(ShaderPreprocessorTest, ResolvesRelativeIncludesAndCachesFiles) {
+	const auto directory = std::filesystem::temp_directory_path() /
+		("pgrender_include_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+	std::filesystem::create_directories(directory / "lib");
+	std::ofstream(directory / "main.vert") << "#include \"lib/light.glsl\"\nvoid main() {}\n";
+	std::ofstream(directory / "lib" / "light.glsl") << "#include \"brdf.glsl\"\n";
+	std::ofstream(directory / "lib" / "brdf.glsl") << "float brdf;\n";
+
+	ShaderPreprocessor preprocessor;
+	const auto first = preprocessor.processFile((directory / "main.vert").string());
+	EXPECT_THAT(first.source, HasSubstr("float brdf;\n"));
+	EXPECT_EQ(first.files.size(), 3u);
+	EXPECT_EQ(preprocessor.getCachedFileCount(), 3u);
+
+	// Sin invalidar se usa la copia en caché aunque el fichero cambie
+	std::ofstream(directory / "lib" / "brdf.glsl") << "float brdf2;\n";
+	EXPECT_EQ(preprocessor.processFile((directory / "main.vert").string()).hash, first.hash);
+
+	preprocessor.invalidate((directory / "lib" / "brdf.glsl").string());
+	const auto second = preprocessor.processFile((directory / "main.vert").string());
+	EXPECT_THAT(second.source, HasSubstr("float brdf2;\n"));
+	EXPECT_NE(second.hash, first.hash);
+
+	std::filesystem::remove_all(directory);
+}
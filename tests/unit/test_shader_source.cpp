@@ -0,0 +1,67 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/shader.h>
+
+#include <stdexcept>
+#include <vector>
+
+using namespace ::testing;
+using pgrender::ShaderSource;
+using pgrender::ShaderStage;
+
+namespace {
+
+	uint32_t byteSwap(uint32_t value) {
+		return (value >> 24) | ((value >> 8) & 0xFF00u) | ((value << 8) & 0xFF0000u) | (value << 24);
+	}
+
+}
+
+TEST(ShaderSourceTest, ReadsNativeSpirv) {
+	const std::vector<uint32_t> module = { 0x07230203u, 0x00010500u, 0x12345678u };
+	const auto words = ShaderSource::spirvFromBytes(module.data(), module.size() * 4);
+	EXPECT_EQ(words, module);
+}
+
+TEST(ShaderSourceTest, SwapsForeignEndianSpirv) {
+	const std::vector<uint32_t> swapped = { byteSwap(0x07230203u), byteSwap(0x12345678u) };
+	const auto words = ShaderSource::spirvFromBytes(swapped.data(), swapped.size() * 4);
+	EXPECT_THAT(words, ElementsAre(0x07230203u, 0x12345678u));
+}
+
+TEST(ShaderSourceTest, RejectsInvalidSpirv) {
+	const uint32_t notSpirv[] = { 0xDEADBEEFu, 0u };
+	EXPECT_THROW(ShaderSource::spirvFromBytes(notSpirv, sizeof(notSpirv)), std::invalid_argument);
+	EXPECT_THROW(ShaderSource::spirvFromBytes(notSpirv, 6), std::invalid_argument);
+	EXPECT_THROW(ShaderSource::spirvFromBytes(notSpirv, 0), std::invalid_argument);
+}
+
+TEST(ShaderSourceTest, GlslStagesKeepAggregateInitialization) {
+	const ShaderSource glsl{ ShaderStage::Vertex, "#version 450\nvoid main() {}\n" };
+	EXPECT_FALSE(glsl.isSpirv());
+	EXPECT_EQ(glsl.entryPoint, "main");
+
+	ShaderSource spirv{ ShaderStage::Fragment, {} };
+	spirv.spirv = { 0x07230203u };
+	spirv.specializationConstants = { { 0, 1 } };
+	EXPECT_TRUE(spirv.isSpirv());
+}
+
+TEST(ShaderSourceTest, ComparesEveryField) {
+	ShaderSource a{ ShaderStage::Fragment, "void main() {}" };
+	ShaderSource b = a;
+	EXPECT_EQ(a, b);
+
+	b.stage = ShaderStage::Vertex;
+	EXPECT_NE(a, b);
+
+	b = a;
+	b.specializationConstants = { { 0, 1 } };
+	EXPECT_NE(a, b);
+	a.specializationConstants = { { 0, 2 } };
+	EXPECT_NE(a, b);
+	a.specializationConstants[0].value = 1;
+	EXPECT_EQ(a, b);
+
+	b.entryPoint = "mainFS";
+	EXPECT_NE(a, b);
+}
@@ -0,0 +1,181 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/sparseResidencyManager.h>
+#include "fakeContext.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace ::testing;
+using namespace pgrender;
+using namespace pgrender::fakes;
+
+namespace {
+
+	// Textura de 512x512 con páginas de 128x128: niveles de 4x4, 2x2 y 1x1 páginas y cola desde el mip 3
+	class SparseResidencyManagerTest : public Test {
+	protected:
+		void SetUp() override {
+			Texture::Desc desc{};
+			desc.type = Texture::Type::Texture2D;
+			desc.width = desc.height = 512;
+			desc.mipLevels = 10;
+			desc.sparse = true;
+			texture = std::make_shared<FakeTexture>(desc);
+			texture->mipTailStart = 3;
+		}
+
+		std::unique_ptr<SparseResidencyManager> makeManager(uint32_t maxResidentPages = 1024, uint32_t maxCommitsPerFrame = 16,
+			uint32_t maxUnusedFrames = 60) {
+			SparseResidencyManager::Desc desc;
+			desc.texture = texture;
+			desc.pageLoader = [this](Texture&, const Texture::Region& region) { loaded.push_back(region); };
+			desc.maxResidentPages = maxResidentPages;
+			desc.maxCommitsPerFrame = maxCommitsPerFrame;
+			desc.maxUnusedFrames = maxUnusedFrames;
+			return std::make_unique<SparseResidencyManager>(context, desc);
+		}
+
+		float residencyAt(const SparseResidencyManager& manager, uint32_t x, uint32_t y) const {
+			auto* map = static_cast<FakeTexture*>(manager.getResidencyMap().get());
+			float value = 0.0f;
+			std::memcpy(&value, map->lastUpload.data() + (static_cast<size_t>(y) * map->getDesc().width + x) * sizeof(float), sizeof(float));
+			return value;
+		}
+
+		FakeContext context;
+		std::shared_ptr<FakeTexture> texture;
+		std::vector<Texture::Region> loaded;
+	};
+
+}
+
+TEST_F(SparseResidencyManagerTest, CommitsMipTailUpFront) {
+	auto manager = makeManager();
+
+	ASSERT_EQ(texture->commits.size(), 7u);
+	EXPECT_EQ(texture->commits.front().first.mipLevel, 3u);
+	EXPECT_EQ(texture->commits.front().first.width, 64u);
+	EXPECT_EQ(loaded.size(), 7u);
+
+	EXPECT_EQ(manager->getPageCountX(0), 4u);
+	EXPECT_EQ(manager->getPageCountY(1), 2u);
+	EXPECT_TRUE(manager->isPageResident(3, 0, 0));
+	EXPECT_FALSE(manager->isPageResident(2, 0, 0));
+	EXPECT_EQ(manager->getResidencyMap()->getDesc().width, 4u);
+	EXPECT_FLOAT_EQ(residencyAt(*manager, 2, 2), 3.0f);
+}
+
+TEST_F(SparseResidencyManagerTest, CommitsParentsBeforeChildren) {
+	auto manager = makeManager();
+	loaded.clear();
+
+	manager->requestPage(0, 1, 1);
+	manager->update();
+
+	// Los padres se ordenan primero, así que la cadena entera entra en un frame
+	ASSERT_EQ(loaded.size(), 3u);
+	EXPECT_EQ(loaded[0].mipLevel, 2u);
+	EXPECT_EQ(loaded[1].mipLevel, 1u);
+	EXPECT_EQ(loaded[2].mipLevel, 0u);
+	EXPECT_EQ(loaded[2].x, 128u);
+	EXPECT_EQ(loaded[2].y, 128u);
+	EXPECT_EQ(manager->getStatistics().residentPages, 3u);
+
+	EXPECT_FLOAT_EQ(residencyAt(*manager, 1, 1), 0.0f);
+	EXPECT_FLOAT_EQ(residencyAt(*manager, 0, 0), 1.0f);
+	EXPECT_FLOAT_EQ(residencyAt(*manager, 3, 3), 2.0f);
+}
+
+TEST_F(SparseResidencyManagerTest, LimitsCommitsPerFrame) {
+	auto manager = makeManager(1024, 1);
+
+	for (uint32_t mip = 3; mip-- > 0;) {
+		manager->requestPage(0, 0, 0);
+		manager->update();
+		EXPECT_TRUE(manager->isPageResident(mip, 0, 0));
+		EXPECT_EQ(manager->getStatistics().pendingPages, mip);
+	}
+	EXPECT_EQ(manager->getStatistics().commits, 3u);
+}
+
+TEST_F(SparseResidencyManagerTest, EvictsLeastRecentlyUsedLeavesOverBudget) {
+	auto manager = makeManager(3);
+	manager->requestPage(0, 0, 0);
+	manager->update();
+	ASSERT_EQ(manager->getStatistics().residentPages, 3u);
+
+	// La nueva cadena comparte el mip 2; el presupuesto obliga a liberar las hojas de la anterior
+	manager->requestPage(0, 3, 3);
+	manager->update();
+
+	EXPECT_EQ(manager->getStatistics().residentPages, 3u);
+	EXPECT_EQ(manager->getStatistics().evictions, 2u);
+	EXPECT_TRUE(manager->isPageResident(0, 3, 3));
+	EXPECT_TRUE(manager->isPageResident(1, 1, 1));
+	EXPECT_TRUE(manager->isPageResident(2, 0, 0));
+	EXPECT_FALSE(manager->isPageResident(0, 0, 0));
+	EXPECT_FALSE(manager->isPageResident(1, 0, 0));
+	EXPECT_EQ(std::count_if(texture->commits.begin(), texture->commits.end(), [](const auto& commit) { return !commit.second; }), 2);
+}
+
+TEST_F(SparseResidencyManagerTest, KeepsRequestedPagesWhenBudgetIsFull) {
+	auto manager = makeManager(2);
+	manager->requestPage(0, 0, 0);
+	manager->update();
+
+	EXPECT_EQ(manager->getStatistics().residentPages, 2u);
+	EXPECT_EQ(manager->getStatistics().pendingPages, 1u);
+	EXPECT_EQ(manager->getStatistics().evictions, 0u);
+	EXPECT_FALSE(manager->isPageResident(0, 0, 0));
+}
+
+TEST_F(SparseResidencyManagerTest, ReleasesUnusedPagesFromFinestLevel) {
+	auto manager = makeManager(1024, 16, 2);
+	manager->requestPage(0, 2, 1);
+	manager->update();
+
+	manager->update();
+	manager->update();
+	EXPECT_EQ(manager->getStatistics().residentPages, 3u);
+
+	// Las hojas se liberan antes que sus padres, dentro del mismo update()
+	manager->update();
+	EXPECT_EQ(manager->getStatistics().residentPages, 0u);
+	EXPECT_EQ(manager->getStatistics().evictions, 3u);
+	EXPECT_FLOAT_EQ(residencyAt(*manager, 2, 1), 3.0f);
+}
+
+TEST_F(SparseResidencyManagerTest, DecodesFeedbackEntries) {
+	auto manager = makeManager();
+	const uint32_t entries[] = {
+		SparseResidencyManager::kEmptyFeedback,
+		SparseResidencyManager::packFeedback(1, 1, 0),
+		SparseResidencyManager::packFeedback(0, 9, 9),     // Fuera de rango
+	};
+
+	BufferObject::Desc desc;
+	desc.type = BufferType::ShaderStorage;
+	desc.size = sizeof(entries);
+	desc.data = entries;
+	auto buffer = context.createBufferObject(desc);
+
+	manager->processFeedback(buffer, 16);
+	manager->update();
+
+	EXPECT_TRUE(manager->isPageResident(1, 1, 0));
+	EXPECT_TRUE(manager->isPageResident(2, 0, 0));
+	EXPECT_EQ(manager->getStatistics().residentPages, 2u);
+	EXPECT_THROW(manager->processFeedback(std::shared_ptr<BufferObject>(), 1), std::invalid_argument);
+}
+
+TEST_F(SparseResidencyManagerTest, RejectsNonSparseTextures) {
+	Texture::Desc desc{};
+	desc.type = Texture::Type::Texture2D;
+	desc.width = desc.height = 64;
+
+	SparseResidencyManager::Desc managerDesc;
+	managerDesc.texture = std::make_shared<FakeTexture>(desc);
+	managerDesc.pageLoader = [](Texture&, const Texture::Region&) {};
+	EXPECT_THROW(SparseResidencyManager(context, managerDesc), std::invalid_argument);
+}
@@ -0,0 +1,151 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/textureEncoder.h>
+#include <PGRenderCore/threadPool.h>
+
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+using namespace ::testing;
+using pgrender::Texture;
+using pgrender::TextureEncoder;
+using pgrender::ThreadPool;
+
+namespace {
+
+	// Imagen de referencia: luminancia con detalle fino modulada por un tinte que varía
+	// suavemente, alfa en degradado y un disco de bordes duros
+	std::vector<uint8_t> makeReferenceImage(uint32_t width, uint32_t height) {
+		std::vector<uint8_t> image(width * height * 4);
+		for (uint32_t y = 0; y < height; ++y) {
+			for (uint32_t x = 0; x < width; ++x) {
+				uint8_t* texel = &image[(y * width + x) * 4];
+				const float u = static_cast<float>(x) / width;
+				const float v = static_cast<float>(y) / height;
+				const float luminance = 0.55f + 0.35f * std::sin(u * 19.0f + v * 7.0f) * std::cos(v * 13.0f);
+				const bool disc = (u - 0.6f) * (u - 0.6f) + (v - 0.4f) * (v - 0.4f) < 0.04f;
+				const float tint[3] = { disc ? 0.9f : 0.6f + 0.4f * u, disc ? 0.3f : 0.8f, disc ? 0.2f : 1.0f - 0.5f * v };
+				for (int c = 0; c < 3; ++c) {
+					texel[c] = static_cast<uint8_t>(255.0f * luminance * tint[c]);
+				}
+				texel[3] = static_cast<uint8_t>(255.0f * (0.25f + 0.75f * (1.0f - u * v)));
+			}
+		}
+		return image;
+	}
+
+	double psnr(const std::vector<uint8_t>& reference, const std::vector<uint8_t>& decoded, uint32_t channels) {
+		double sum = 0.0;
+		size_t count = 0;
+		for (size_t i = 0; i < reference.size(); i += 4) {
+			for (uint32_t c = 0; c < channels; ++c) {
+				const double diff = static_cast<double>(reference[i + c]) - decoded[i + c];
+				sum += diff * diff;
+				++count;
+			}
+		}
+		const double mse = sum / count;
+		return mse == 0.0 ? 100.0 : 10.0 * std::log10(255.0 * 255.0 / mse);
+	}
+
+	double roundTripPsnr(Texture::Format format, TextureEncoder::Quality quality, uint32_t channels) {
+		const uint32_t size = 64;
+		const auto image = makeReferenceImage(size, size);
+		TextureEncoder::Options options;
+		options.quality = quality;
+		const auto blocks = TextureEncoder::encode(image.data(), size, size, format, options);
+		return psnr(image, TextureEncoder::decode(blocks.data(), size, size, format), channels);
+	}
+
+}
+
+// ============================================================================
+// Calidad (PSNR frente a la imagen de referencia)
+// ============================================================================
+
+TEST(TextureEncoderTest, BC1MeetsQualityTargets) {
+	EXPECT_GT(roundTripPsnr(Texture::Format::BC1, TextureEncoder::Quality::Fast, 3), 31.0);
+	EXPECT_GT(roundTripPsnr(Texture::Format::BC1, TextureEncoder::Quality::High, 3), 34.0);
+	EXPECT_GE(roundTripPsnr(Texture::Format::BC1, TextureEncoder::Quality::High, 3),
+		roundTripPsnr(Texture::Format::BC1, TextureEncoder::Quality::Fast, 3));
+}
+
+TEST(TextureEncoderTest, BC4AndBC5MeetQualityTargets) {
+	EXPECT_GT(roundTripPsnr(Texture::Format::BC4, TextureEncoder::Quality::Normal, 1), 41.0);
+	EXPECT_GT(roundTripPsnr(Texture::Format::BC5, TextureEncoder::Quality::Normal, 2), 41.0);
+}
+
+TEST(TextureEncoderTest, BC7MeetsQualityTargets) {
+	EXPECT_GT(roundTripPsnr(Texture::Format::BC7, TextureEncoder::Quality::Normal, 4), 40.0);
+	EXPECT_GE(roundTripPsnr(Texture::Format::BC7, TextureEncoder::Quality::High, 4),
+		roundTripPsnr(Texture::Format::BC7, TextureEncoder::Quality::Fast, 4));
+}
+
+// ============================================================================
+// Determinismo
+// ============================================================================
+
+TEST(TextureEncoderTest, OutputIsIndependentOfSimdAndThreads) {
+	const uint32_t width = 70, height = 45;     // Bloques incompletos en los bordes
+	const auto image = makeReferenceImage(width, height);
+	ThreadPool pool(3);
+
+	for (auto format : { Texture::Format::BC1, Texture::Format::BC5, Texture::Format::BC7 }) {
+		TextureEncoder::Options scalar;
+		scalar.quality = TextureEncoder::Quality::High;
+		scalar.useSimd = false;
+		TextureEncoder::Options parallel = scalar;
+		parallel.useSimd = true;
+		parallel.threadPool = &pool;
+
+		const auto reference = TextureEncoder::encode(image.data(), width, height, format, scalar);
+		EXPECT_EQ(reference.size(), Texture::getImageSize(format, width, height));
+		EXPECT_EQ(TextureEncoder::encode(image.data(), width, height, format, parallel), reference);
+	}
+}
+
+TEST(TextureEncoderTest, SolidColorRoundTrips) {
+	// Magenta es representable en RGB565; en BC7 modo 6 el p-bit compartido limita el error a 1
+	std::vector<uint8_t> image(8 * 8 * 4);
+	for (size_t i = 0; i < image.size(); i += 4) {
+		image[i] = 255; image[i + 1] = 0; image[i + 2] = 255; image[i + 3] = 255;
+	}
+	const auto bc1 = TextureEncoder::encode(image.data(), 8, 8, Texture::Format::BC1, {});
+	EXPECT_EQ(TextureEncoder::decode(bc1.data(), 8, 8, Texture::Format::BC1), image);
+
+	const auto bc7 = TextureEncoder::encode(image.data(), 8, 8, Texture::Format::BC7, {});
+	const auto decoded = TextureEncoder::decode(bc7.data(), 8, 8, Texture::Format::BC7);
+	for (size_t i = 0; i < image.size(); ++i) {
+		EXPECT_LE(std::abs(decoded[i] - image[i]), 1);
+	}
+}
+
+TEST(TextureEncoderTest, RejectsUnsupportedFormats) {
+	std::vector<uint8_t> image(16 * 4);
+	EXPECT_FALSE(TextureEncoder::canEncode(Texture::Format::ASTC_4x4));
+	EXPECT_THROW(TextureEncoder::encode(image.data(), 4, 4, Texture::Format::RGBA8, {}), std::invalid_argument);
+}
+
+// ============================================================================
+// ThreadPool
+// ============================================================================
+
+TEST(ThreadPoolTest, ParallelForCoversRangeOnce) {
+	ThreadPool pool(4);
+	std::vector<std::atomic<int>> hits(1000);
+	pool.parallelFor(hits.size(), 7, [&](size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i) {
+			hits[i]++;
+		}
+	});
+	for (auto& hit : hits) {
+		EXPECT_EQ(hit.load(), 1);
+	}
+}
+
+TEST(ThreadPoolTest, ParallelForPropagatesExceptions) {
+	ThreadPool pool(2);
+	EXPECT_THROW(pool.parallelFor(100, 1, [](size_t begin, size_t) {
+		if (begin == 42) throw std::runtime_error("boom");
+	}), std::runtime_error);
+}
@@ -0,0 +1,315 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/texture.h>
+#include <PGRenderCore/formatInfo.h>
+#include <PGRenderCore/textureLoader.h>
+
+#include <cstring>
+#include <vector>
+
+using namespace ::testing;
+using pgrender::Texture;
+using pgrender::TextureLoader;
+using pgrender::FormatFeatures;
+using pgrender::FormatType;
+using pgrender::getFormatInfo;
+
+namespace {
+
+	void write32(std::vector<uint8_t>& out, size_t offset, uint32_t value) {
+		for (int i = 0; i < 4; ++i) {
+			out[offset + i] = static_cast<uint8_t>(value >> (8 * i));
+		}
+	}
+
+	void write64(std::vector<uint8_t>& out, size_t offset, uint64_t value) {
+		write32(out, offset, static_cast<uint32_t>(value));
+		write32(out, offset + 4, static_cast<uint32_t>(value >> 32));
+	}
+
+	// DDS 2D con el FourCC dado; cada byte de datos vale su índice
+	std::vector<uint8_t> makeDDS(uint32_t width, uint32_t height, uint32_t mips, const char* fourCC, size_t dataSize) {
+		std::vector<uint8_t> file(128 + dataSize, 0);
+		std::memcpy(file.data(), "DDS ", 4);
+		write32(file, 4, 124);
+		write32(file, 4 + 8, height);
+		write32(file, 4 + 12, width);
+		write32(file, 4 + 24, mips);
+		write32(file, 4 + 72, 32);
+		write32(file, 4 + 76, 0x4);
+		std::memcpy(file.data() + 4 + 80, fourCC, 4);
+		for (size_t i = 0; i < dataSize; ++i) {
+			file[128 + i] = static_cast<uint8_t>(i);
+		}
+		return file;
+	}
+
+}
+
+// ============================================================================
+// Format helpers
+// ============================================================================
+
+TEST(TextureFormatTest, CompressedFormatsAreDetected) {
+	EXPECT_FALSE(Texture::isCompressedFormat(Texture::Format::RGBA8));
+	EXPECT_FALSE(Texture::isCompressedFormat(Texture::Format::Depth32F));
+	EXPECT_TRUE(Texture::isCompressedFormat(Texture::Format::BC1));
+	EXPECT_TRUE(Texture::isCompressedFormat(Texture::Format::BC7_SRGB));
+	EXPECT_TRUE(Texture::isCompressedFormat(Texture::Format::ETC2_RGBA8));
+	EXPECT_TRUE(Texture::isCompressedFormat(Texture::Format::ASTC_8x8_SRGB));
+}
+
+TEST(TextureFormatTest, BlockDimensions) {
+	EXPECT_EQ(Texture::getBlockWidth(Texture::Format::RGBA8), 1u);
+	EXPECT_EQ(Texture::getBlockWidth(Texture::Format::BC3), 4u);
+	EXPECT_EQ(Texture::getBlockHeight(Texture::Format::ASTC_6x6), 6u);
+	EXPECT_EQ(Texture::getBlockWidth(Texture::Format::ASTC_8x8), 8u);
+
+	EXPECT_EQ(Texture::getBlockSizeBytes(Texture::Format::BC1), 8u);
+	EXPECT_EQ(Texture::getBlockSizeBytes(Texture::Format::BC4), 8u);
+	EXPECT_EQ(Texture::getBlockSizeBytes(Texture::Format::ETC2_RGB8), 8u);
+	EXPECT_EQ(Texture::getBlockSizeBytes(Texture::Format::BC5), 16u);
+	EXPECT_EQ(Texture::getBlockSizeBytes(Texture::Format::ASTC_4x4), 16u);
+}
+
+TEST(TextureFormatTest, ImageSizeRoundsUpToBlocks) {
+	EXPECT_EQ(Texture::getImageSize(Texture::Format::RGBA8, 3, 5), 60u);
+	EXPECT_EQ(Texture::getImageSize(Texture::Format::BC1, 256, 256), 32768u);
+	EXPECT_EQ(Texture::getImageSize(Texture::Format::BC7, 5, 5), 4u * 16u);
+	EXPECT_EQ(Texture::getImageSize(Texture::Format::BC1, 1, 1), 8u);
+	EXPECT_EQ(Texture::getImageSize(Texture::Format::ASTC_6x6, 13, 7), 3u * 2u * 16u);
+	EXPECT_EQ(Texture::getRowPitch(Texture::Format::BC3, 10), 3u * 16u);
+}
+
+TEST(TextureFormatTest, BytesPerPixelRejectsCompressedFormats) {
+	EXPECT_EQ(Texture::getBytesPerPixel(Texture::Format::RGBA16F), 8u);
+	EXPECT_THROW(Texture::getBytesPerPixel(Texture::Format::BC1), std::invalid_argument);
+}
+
+TEST(TextureFormatTest, PackedAndIntegerFormatSizes) {
+	EXPECT_EQ(Texture::getBytesPerPixel(Texture::Format::SRGB8_A8), 4u);
+	EXPECT_EQ(Texture::getBytesPerPixel(Texture::Format::RGB10_A2), 4u);
+	EXPECT_EQ(Texture::getBytesPerPixel(Texture::Format::R11G11B10F), 4u);
+	EXPECT_EQ(Texture::getBytesPerPixel(Texture::Format::R32UI), 4u);
+	EXPECT_EQ(Texture::getBytesPerPixel(Texture::Format::RG16UI), 4u);
+	EXPECT_EQ(Texture::getBytesPerPixel(Texture::Format::Depth16), 2u);
+	EXPECT_EQ(Texture::getImageSize(Texture::Format::Depth16, 3, 3), 18u);
+}
+
+TEST(TextureFormatTest, FormatTableDescribesCapabilities) {
+	for (const auto& info : pgrender::kFormatTable) {
+		EXPECT_EQ(getFormatInfo(info.format).name, info.name);
+		EXPECT_EQ(info.blockWidth, info.blockHeight) << info.name;
+		EXPECT_TRUE(pgrender::hasFeatures(info.features, FormatFeatures::Sampled)) << info.name;
+		// Los formatos comprimidos no se pueden renderizar ni escribir desde shaders
+		if (info.isCompressed()) {
+			EXPECT_FALSE(pgrender::hasFeatures(info.features, FormatFeatures::Renderable)) << info.name;
+			EXPECT_FALSE(pgrender::hasFeatures(info.features, FormatFeatures::Storage)) << info.name;
+		}
+		// Los enteros no admiten filtrado lineal y la profundidad no es imagen de shader
+		if (info.isInteger()) {
+			EXPECT_FALSE(pgrender::hasFeatures(info.features, FormatFeatures::Filterable)) << info.name;
+		}
+		if (info.isDepth()) {
+			EXPECT_FALSE(pgrender::hasFeatures(info.features, FormatFeatures::Storage)) << info.name;
+		}
+	}
+
+	EXPECT_TRUE(getFormatInfo(Texture::Format::Depth24Stencil8).hasStencil());
+	EXPECT_FALSE(getFormatInfo(Texture::Format::Depth24).hasStencil());
+	EXPECT_TRUE(getFormatInfo(Texture::Format::Depth16).isDepth());
+	EXPECT_EQ(getFormatInfo(Texture::Format::SRGB8_A8).type, FormatType::Srgb);
+	EXPECT_TRUE(pgrender::hasFeatures(getFormatInfo(Texture::Format::R11G11B10F).features,
+		FormatFeatures::Renderable | FormatFeatures::Storage));
+	EXPECT_FALSE(pgrender::hasFeatures(getFormatInfo(Texture::Format::SRGB8_A8).features, FormatFeatures::Storage));
+	EXPECT_FALSE(pgrender::hasFeatures(getFormatInfo(Texture::Format::RGB32F).features, FormatFeatures::Renderable));
+}
+
+// ============================================================================
+// DDS / KTX2
+// ============================================================================
+
+TEST(TextureLoaderTest, LoadsBC1DDSWithMipChain) {
+	// 8x8 -> 4x4 -> 2x2 -> 1x1: 32 + 8 + 8 + 8 bytes
+	auto file = makeDDS(8, 8, 4, "DXT1", 56);
+	auto data = TextureLoader::loadFromMemory(file.data(), file.size());
+
+	EXPECT_EQ(data.desc.type, Texture::Type::Texture2D);
+	EXPECT_EQ(data.desc.format, Texture::Format::BC1);
+	EXPECT_EQ(data.desc.width, 8u);
+	EXPECT_EQ(data.desc.mipLevels, 4);
+	ASSERT_THAT(data.subresources, SizeIs(4));
+	EXPECT_EQ(data.subresources[0].size, 32u);
+	EXPECT_EQ(data.subresources[1].offset, 32u);
+	EXPECT_EQ(data.subresources[3].size, 8u);
+	EXPECT_EQ(data.bytes.size(), 56u);
+	EXPECT_EQ(data.bytes[40], 40);
+}
+
+TEST(TextureLoaderTest, RejectsTruncatedDDS) {
+	auto file = makeDDS(8, 8, 4, "DXT1", 40);
+	EXPECT_THROW(TextureLoader::loadDDS(file.data(), file.size()), std::runtime_error);
+}
+
+TEST(TextureLoaderTest, RejectsOversizedDDSHeaders) {
+	// Volumen RGBA8 cuyo tamaño desborda size_t: debe rechazarse antes de calcularlo
+	auto volume = makeDDS(4, 4, 1, "DX10", 20 + 64);
+	write32(volume, 4 + 8, (1u << 29) + 1);
+	write32(volume, 4 + 12, (1u << 29) - 1);
+	write32(volume, 4 + 20, 16);
+	write32(volume, 128, 28);       // DXGI_FORMAT_R8G8B8A8_UNORM
+	write32(volume, 128 + 4, 4);    // D3D10_RESOURCE_DIMENSION_TEXTURE3D
+	write32(volume, 128 + 8, 0);
+	write32(volume, 128 + 12, 1);
+	EXPECT_THROW(TextureLoader::loadDDS(volume.data(), volume.size()), std::runtime_error);
+
+	auto wide = makeDDS(16385, 4, 1, "DXT1", 64);
+	EXPECT_THROW(TextureLoader::loadDDS(wide.data(), wide.size()), std::runtime_error);
+
+	auto layers = makeDDS(4, 4, 1, "DX10", 20 + 64);
+	write32(layers, 128, 71);
+	write32(layers, 128 + 4, 3);
+	write32(layers, 128 + 8, 0x4);  // Cubemap: 6 caras por elemento
+	write32(layers, 128 + 12, 0x40000000);
+	EXPECT_THROW(TextureLoader::loadDDS(layers.data(), layers.size()), std::runtime_error);
+}
+
+TEST(TextureLoaderTest, RejectsUnknownContainer) {
+	std::vector<uint8_t> file(256, 0);
+	EXPECT_THROW(TextureLoader::loadFromMemory(file.data(), file.size()), std::runtime_error);
+}
+
+TEST(TextureLoaderTest, LoadsKTX2Cubemap) {
+	// BC7 4x4 cubemap, un nivel: 6 caras de 16 bytes
+	const uint8_t identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+	const size_t dataOffset = 80 + 24;
+	std::vector<uint8_t> file(dataOffset + 6 * 16, 0);
+	std::memcpy(file.data(), identifier, sizeof(identifier));
+	write32(file, 12, 145);  // VK_FORMAT_BC7_UNORM_BLOCK
+	write32(file, 16, 1);
+	write32(file, 20, 4);
+	write32(file, 24, 4);
+	write32(file, 36, 6);
+	write32(file, 40, 1);
+	write64(file, 80, dataOffset);
+	write64(file, 88, 6 * 16);
+	file[dataOffset + 5 * 16] = 0x5A;
+
+	auto data = TextureLoader::loadFromMemory(file.data(), file.size());
+
+	EXPECT_EQ(data.desc.type, Texture::Type::TextureCube);
+	EXPECT_EQ(data.desc.format, Texture::Format::BC7);
+	EXPECT_EQ(data.desc.mipLevels, 1);
+	ASSERT_THAT(data.subresources, SizeIs(6));
+	EXPECT_EQ(data.subresources[5].layer, 5u);
+	EXPECT_EQ(data.bytes[data.subresources[5].offset], 0x5A);
+}
+
+TEST(TextureLoaderTest, LoadsKTX2CubemapArray) {
+	// RGBA8 2x2, 2 cubemaps, un nivel: 12 caras de 16 bytes
+	const uint8_t identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+	const size_t dataOffset = 80 + 24;
+	std::vector<uint8_t> file(dataOffset + 12 * 16, 0);
+	std::memcpy(file.data(), identifier, sizeof(identifier));
+	write32(file, 12, 37);   // VK_FORMAT_R8G8B8A8_UNORM
+	write32(file, 16, 1);
+	write32(file, 20, 2);
+	write32(file, 24, 2);
+	write32(file, 32, 2);
+	write32(file, 36, 6);
+	write32(file, 40, 1);
+	write64(file, 80, dataOffset);
+	write64(file, 88, 12 * 16);
+	file[dataOffset + 7 * 16] = 0x5A;   // Cubemap 1, cara 1
+
+	auto data = TextureLoader::loadFromMemory(file.data(), file.size());
+
+	EXPECT_EQ(data.desc.type, Texture::Type::TextureCubeArray);
+	EXPECT_EQ(data.desc.arrayLayers, 2u);
+	EXPECT_EQ(Texture::getLayerCount(data.desc), 12u);
+	EXPECT_EQ(Texture::getLevelSizeBytes(data.desc, 0), 12u * 16u);
+	ASSERT_THAT(data.subresources, SizeIs(12));
+	EXPECT_EQ(data.subresources[7].layer, 7u);
+	EXPECT_EQ(data.bytes[data.subresources[7].offset], 0x5A);
+}
+
+TEST(TextureLoaderTest, LoadsDDSTextureArray) {
+	// DX10 BC1 4x4 con 3 capas y 2 niveles: cada capa guarda su cadena completa
+	std::vector<uint8_t> file = makeDDS(4, 4, 2, "DX10", 20 + 3 * 16);
+	file.erase(file.begin() + 128 + 20, file.end());
+	write32(file, 128, 71);      // DXGI_FORMAT_BC1_UNORM
+	write32(file, 128 + 4, 3);   // D3D10_RESOURCE_DIMENSION_TEXTURE2D
+	write32(file, 128 + 12, 3);
+	for (size_t i = 0; i < 3 * 16; ++i) {
+		file.push_back(static_cast<uint8_t>(i));
+	}
+
+	auto data = TextureLoader::loadDDS(file.data(), file.size());
+
+	EXPECT_EQ(data.desc.type, Texture::Type::Texture2DArray);
+	EXPECT_EQ(data.desc.arrayLayers, 3u);
+	ASSERT_THAT(data.subresources, SizeIs(6));
+	EXPECT_EQ(data.subresources[2].layer, 1u);
+	EXPECT_EQ(data.subresources[2].mipLevel, 0u);
+	EXPECT_EQ(data.bytes[data.subresources[2].offset], 16);
+}
+
+TEST(TextureLoaderTest, RejectsSupercompressedKTX2) {
+	const uint8_t identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+	std::vector<uint8_t> file(80 + 24, 0);
+	std::memcpy(file.data(), identifier, sizeof(identifier));
+	write32(file, 12, 37);
+	write32(file, 20, 4);
+	write32(file, 24, 4);
+	write32(file, 36, 1);
+	write32(file, 40, 1);
+	write32(file, 44, 2);   // Zstandard
+
+	EXPECT_THROW(TextureLoader::loadKTX2(file.data(), file.size()), std::runtime_error);
+}
+
+TEST(TextureLoaderTest, RejectsKTX2LevelsLargerThanTheirData) {
+	// 16 capas RGBA8 de 4x4 (256 bytes cada una) en un nivel que declara 512 bytes
+	const uint8_t identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+	const size_t dataOffset = 80 + 24;
+	std::vector<uint8_t> file(dataOffset + 512, 0);
+	std::memcpy(file.data(), identifier, sizeof(identifier));
+	write32(file, 12, 37);
+	write32(file, 20, 16);
+	write32(file, 24, 16);
+	write32(file, 32, 16);
+	write32(file, 36, 1);
+	write32(file, 40, 1);
+	write64(file, 80, dataOffset);
+	write64(file, 88, 512);
+	EXPECT_THROW(TextureLoader::loadKTX2(file.data(), file.size()), std::runtime_error);
+
+	// Dimensiones cuyo tamaño desbordaría antes de compararlo con byteLength
+	write32(file, 20, 0x80000000u);
+	write32(file, 24, 0x80000000u);
+	write32(file, 32, 0);
+	EXPECT_THROW(TextureLoader::loadKTX2(file.data(), file.size()), std::runtime_error);
+
+	write32(file, 20, 4);
+	write32(file, 24, 4);
+	write32(file, 32, 0x10000000u);
+	EXPECT_THROW(TextureLoader::loadKTX2(file.data(), file.size()), std::runtime_error);
+}
+
+TEST(TextureLoaderTest, RejectsKTX2FormatsWithoutSrgbEquivalent) {
+	// RGB8 4x4, un nivel de 48 bytes
+	const uint8_t identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+	const size_t dataOffset = 80 + 24;
+	std::vector<uint8_t> file(dataOffset + 48, 0);
+	std::memcpy(file.data(), identifier, sizeof(identifier));
+	write32(file, 12, 23);   // VK_FORMAT_R8G8B8_UNORM
+	write32(file, 20, 4);
+	write32(file, 24, 4);
+	write32(file, 36, 1);
+	write32(file, 40, 1);
+	write64(file, 80, dataOffset);
+	write64(file, 88, 48);
+	EXPECT_EQ(TextureLoader::loadKTX2(file.data(), file.size()).desc.format, Texture::Format::RGB8);
+
+	write32(file, 12, 29);   // VK_FORMAT_R8G8B8_SRGB
+	EXPECT_THROW(TextureLoader::loadKTX2(file.data(), file.size()), std::runtime_error);
+}
@@ -0,0 +1,217 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/textureStreamer.h>
+#include "fakeContext.h"
+
+#include <stdexcept>
+
+using namespace ::testing;
+using namespace pgrender;
+using namespace pgrender::fakes;
+
+namespace {
+
+	// 256x256 RGBA8 con 9 niveles: 262144, 65536, 16384, 4096, 1024, 256, 64, 16 y 4 bytes
+	std::shared_ptr<FakeTexture> makeTexture(bool sparse = false) {
+		Texture::Desc desc{};
+		desc.type = Texture::Type::Texture2D;
+		desc.width = desc.height = 256;
+		desc.depth = 1;
+		desc.mipLevels = 9;
+		desc.format = Texture::Format::RGBA8;
+		desc.sparse = sparse;
+		return std::make_shared<FakeTexture>(desc);
+	}
+
+	size_t bytesFrom(const Texture& texture, uint32_t baseLevel) {
+		size_t bytes = 0;
+		for (uint32_t mip = baseLevel; mip < texture.getDesc().mipLevels; ++mip) {
+			bytes += Texture::getLevelSizeBytes(texture.getDesc(), mip);
+		}
+		return bytes;
+	}
+
+	void runUpdates(TextureStreamer& streamer, int count) {
+		for (int i = 0; i < count; ++i) {
+			streamer.update();
+		}
+	}
+
+}
+
+TEST(TextureStreamerTest, StartsAtCoarsestLevelAndRefinesOneLevelPerUpdate) {
+	TextureStreamer streamer(TextureStreamer::Desc{});
+	auto texture = makeTexture();
+	std::vector<uint32_t> loaded;
+	streamer.add(texture, [&loaded](Texture&, uint32_t mip) { loaded.push_back(mip); });
+
+	EXPECT_EQ(texture->residentBaseLevel, 8u);
+	EXPECT_EQ(streamer.getStatistics().residentBytes, 4u);
+
+	streamer.setScreenSize(texture, 64.0f);
+	streamer.update();
+	EXPECT_EQ(texture->residentBaseLevel, 7u);
+	EXPECT_EQ(streamer.getStatistics().pendingTextures, 1u);
+
+	runUpdates(streamer, 10);
+	EXPECT_EQ(texture->residentBaseLevel, TextureStreamer::desiredBaseLevel(texture->getDesc(), 64.0f));
+	EXPECT_EQ(texture->residentBaseLevel, 2u);
+	EXPECT_THAT(loaded, ElementsAre(8u, 7u, 6u, 5u, 4u, 3u, 2u));
+	EXPECT_EQ(streamer.getStatistics().residentBytes, bytesFrom(*texture, 2));
+	EXPECT_EQ(streamer.getStatistics().pendingTextures, 0u);
+}
+
+TEST(TextureStreamerTest, LimitsLevelsPerFrame) {
+	TextureStreamer::Desc desc;
+	desc.maxLevelsPerFrame = 1;
+	TextureStreamer streamer(desc);
+	auto first = makeTexture();
+	auto second = makeTexture();
+	streamer.add(first, [](Texture&, uint32_t) {});
+	streamer.add(second, [](Texture&, uint32_t) {});
+	streamer.setScreenSize(first, 256.0f);
+	streamer.setScreenSize(second, 128.0f);
+
+	// La textura más grande en pantalla va primero
+	streamer.update();
+	EXPECT_EQ(first->residentBaseLevel, 7u);
+	EXPECT_EQ(second->residentBaseLevel, 8u);
+	EXPECT_EQ(streamer.getStatistics().pendingTextures, 2u);
+}
+
+TEST(TextureStreamerTest, EvictsLowerPriorityTexturesToStayInBudget) {
+	TextureStreamer::Desc desc;
+	desc.memoryBudgetBytes = 100000;
+	TextureStreamer streamer(desc);
+
+	auto background = makeTexture();
+	streamer.add(background, [](Texture&, uint32_t) {});
+	streamer.setScreenSize(background, 128.0f);
+	runUpdates(streamer, 10);
+	ASSERT_EQ(background->residentBaseLevel, 1u);
+
+	auto hero = makeTexture();
+	streamer.add(hero, [](Texture&, uint32_t) {});
+	streamer.setScreenSize(hero, 256.0f);
+	runUpdates(streamer, 10);
+
+	// El nivel 0 de hero no cabe nunca; el nivel 1 sí, a costa de background
+	EXPECT_EQ(hero->residentBaseLevel, 1u);
+	EXPECT_GT(background->residentBaseLevel, 1u);
+	EXPECT_GT(streamer.getStatistics().levelsEvicted, 0u);
+	EXPECT_EQ(streamer.getStatistics().pendingTextures, 2u);
+	EXPECT_LE(streamer.getStatistics().residentBytes, desc.memoryBudgetBytes);
+	EXPECT_EQ(streamer.getStatistics().residentBytes,
+		bytesFrom(*hero, hero->residentBaseLevel) + bytesFrom(*background, background->residentBaseLevel));
+}
+
+TEST(TextureStreamerTest, ReleasesExcessDetailFirstWhenBudgetShrinks) {
+	TextureStreamer streamer(TextureStreamer::Desc{});
+	auto farAway = makeTexture();
+	auto nearby = makeTexture();
+	streamer.add(farAway, [](Texture&, uint32_t) {});
+	streamer.add(nearby, [](Texture&, uint32_t) {});
+	streamer.setScreenSize(farAway, 128.0f);
+	streamer.setScreenSize(nearby, 64.0f);
+	runUpdates(streamer, 10);
+	ASSERT_EQ(farAway->residentBaseLevel, 1u);
+	ASSERT_EQ(nearby->residentBaseLevel, 2u);
+
+	// farAway deja de verse de cerca: su detalle sobrante se libera antes que el útil de nearby
+	streamer.setScreenSize(farAway, 16.0f);
+	streamer.setMemoryBudget(bytesFrom(*nearby, 2) + bytesFrom(*farAway, 4));
+	streamer.update();
+
+	EXPECT_EQ(nearby->residentBaseLevel, 2u);
+	EXPECT_EQ(farAway->residentBaseLevel, 4u);
+	EXPECT_EQ(streamer.getStatistics().levelsEvicted, 3u);
+}
+
+TEST(TextureStreamerTest, FadesInNewLevelsWithLodBias) {
+	TextureStreamer::Desc desc;
+	desc.lodFadeFrames = 4;
+	TextureStreamer streamer(desc);
+	auto texture = makeTexture();
+	streamer.add(texture, [](Texture&, uint32_t) {});
+	EXPECT_FLOAT_EQ(texture->lodBias, 0.0f);
+
+	streamer.setScreenSize(texture, 2.0f);     // Nivel deseado: 7
+	streamer.update();
+	EXPECT_EQ(texture->residentBaseLevel, 7u);
+	EXPECT_FLOAT_EQ(texture->lodBias, 1.0f);
+
+	for (float expected : { 0.75f, 0.5f, 0.25f, 0.0f, 0.0f }) {
+		streamer.update();
+		EXPECT_FLOAT_EQ(texture->lodBias, expected);
+	}
+	EXPECT_EQ(texture->residentBaseLevel, 7u);
+}
+
+TEST(TextureStreamerTest, CommitsSparseLevels) {
+	TextureStreamer streamer(TextureStreamer::Desc{});
+	auto texture = makeTexture(true);
+	texture->mipTailStart = 5;
+	streamer.add(texture, [](Texture&, uint32_t) {});
+
+	// La cola de mips (niveles 5-8) se asigna al registrar la textura
+	ASSERT_EQ(texture->commits.size(), 4u);
+	EXPECT_EQ(texture->residentBaseLevel, 5u);
+
+	streamer.setScreenSize(texture, 128.0f);
+	streamer.update();
+	ASSERT_EQ(texture->commits.size(), 5u);
+	EXPECT_EQ(texture->commits.back().first.mipLevel, 4u);
+	EXPECT_TRUE(texture->commits.back().second);
+
+	streamer.setMemoryBudget(bytesFrom(*texture, 5));
+	streamer.update();
+	EXPECT_EQ(texture->commits.back().first.mipLevel, 4u);
+	EXPECT_FALSE(texture->commits.back().second);
+	EXPECT_EQ(texture->residentBaseLevel, 5u);
+}
+
+TEST(TextureStreamerTest, RejectsTexturesWithBindlessHandles) {
+	TextureStreamer streamer(TextureStreamer::Desc{});
+	auto texture = makeTexture();
+	texture->getBindlessHandle();
+
+	EXPECT_THROW(streamer.add(texture, [](Texture&, uint32_t) {}), std::invalid_argument);
+	EXPECT_EQ(streamer.getStatistics().textures, 0u);
+}
+
+TEST(TextureStreamerTest, FreezesTexturesThatGetBindlessHandles) {
+	TextureStreamer::Desc desc;
+	desc.memoryBudgetBytes = bytesFrom(*makeTexture(), 4) + bytesFrom(*makeTexture(), 8);
+	TextureStreamer streamer(desc);
+	auto frozen = makeTexture();
+	auto other = makeTexture();
+	streamer.add(frozen, [](Texture&, uint32_t) {});
+	streamer.add(other, [](Texture&, uint32_t) {});
+
+	streamer.setScreenSize(frozen, 16.0f);
+	runUpdates(streamer, 2);
+	EXPECT_EQ(frozen->residentBaseLevel, 6u);
+	EXPECT_GT(frozen->lodBias, 0.0f);
+
+	// A partir del handle no se cargan niveles, no se liberan ni avanza la transición
+	frozen->getBindlessHandle();
+	const float bias = frozen->lodBias;
+	streamer.setScreenSize(other, 256.0f);
+	EXPECT_NO_THROW(runUpdates(streamer, 10));
+	EXPECT_EQ(frozen->residentBaseLevel, 6u);
+	EXPECT_EQ(frozen->lodBias, bias);
+	EXPECT_GE(streamer.getStatistics().pendingTextures, 1u);
+
+	streamer.setScreenSize(frozen, 256.0f);
+	streamer.update();
+	EXPECT_EQ(frozen->residentBaseLevel, 6u);
+
+	EXPECT_NO_THROW(streamer.remove(frozen));
+	EXPECT_EQ(streamer.getStatistics().textures, 1u);
+}
+
+TEST(TextureStreamerTest, RejectsInvalidArguments) {
+	TextureStreamer streamer(TextureStreamer::Desc{});
+	EXPECT_THROW(streamer.add(nullptr, [](Texture&, uint32_t) {}), std::invalid_argument);
+	EXPECT_THROW(streamer.add(makeTexture(), nullptr), std::invalid_argument);
+	EXPECT_THROW(streamer.setScreenSize(makeTexture(), 10.0f), std::invalid_argument);
+}
@@ -0,0 +1,93 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/uniformLayout.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+using namespace ::testing;
+using namespace pgrender;
+
+namespace {
+
+	constexpr UniformMember kLightMembers[] = {
+		uniformMember<glm::mat4>("viewProjection"),
+		uniformMember<glm::vec3>("position"),
+		uniformMember<float>("intensity"),
+		uniformMember<float>("weights", 3),
+		uniformMember<glm::mat3>("normalMatrix"),
+		uniformMember<glm::vec2>("size"),
+		uniformMember<uint32_t>("count"),
+	};
+
+	constexpr auto kStd140 = describeUniformBlock(BlockLayout::Std140, kLightMembers);
+	constexpr auto kStd430 = describeUniformBlock(BlockLayout::Std430, kLightMembers);
+
+	static_assert(kStd140.offsetOf("intensity") == 76, "vec3 + float share a 16-byte slot");
+
+	float readFloat(const std::vector<uint8_t>& data, size_t offset) {
+		float value = 0.0f;
+		std::memcpy(&value, data.data() + offset, sizeof(value));
+		return value;
+	}
+
+}
+
+TEST(UniformLayoutTest, PacksStd140) {
+	EXPECT_EQ(kStd140.offsetOf("viewProjection"), 0u);
+	EXPECT_EQ(kStd140.offsetOf("position"), 64u);
+	EXPECT_EQ(kStd140.offsetOf("weights"), 80u);
+	EXPECT_EQ(kStd140.layouts[3].arrayStride, 16u);
+	EXPECT_EQ(kStd140.offsetOf("normalMatrix"), 128u);
+	EXPECT_EQ(kStd140.layouts[4].matrixStride, 16u);
+	EXPECT_EQ(kStd140.offsetOf("size"), 176u);
+	EXPECT_EQ(kStd140.offsetOf("count"), 184u);
+	EXPECT_EQ(kStd140.size, 192u);
+}
+
+TEST(UniformLayoutTest, PacksStd430ArraysTightly) {
+	EXPECT_EQ(kStd430.offsetOf("weights"), 80u);
+	EXPECT_EQ(kStd430.layouts[3].arrayStride, 4u);
+	EXPECT_EQ(kStd430.offsetOf("normalMatrix"), 96u);
+	EXPECT_EQ(kStd430.offsetOf("size"), 144u);
+	EXPECT_EQ(kStd430.size, 160u);
+}
+
+TEST(UniformLayoutTest, WriterAppliesStrides) {
+	const auto block = kStd140.toBlock("Light");
+	std::vector<uint8_t> data(block.dataSize, 0);
+	UniformWriter writer(block, data.data());
+
+	writer.set("weights", 2.0f, 1);
+	glm::mat3 normal;
+	normal[1][2] = 5.0f;
+	writer.set("normalMatrix", normal);
+	writer.set("count", 7u);
+
+	EXPECT_EQ(readFloat(data, 80 + 16), 2.0f);
+	EXPECT_EQ(readFloat(data, 128 + 16 + 8), 5.0f);
+	uint32_t count = 0;
+	std::memcpy(&count, data.data() + 184, sizeof(count));
+	EXPECT_EQ(count, 7u);
+
+	EXPECT_THROW(writer.set("weights", 1.0f, 3), std::invalid_argument);
+	EXPECT_THROW(writer.set("count", 1.0f), std::invalid_argument);
+	EXPECT_THROW(writer.set("missing", 1.0f), std::invalid_argument);
+}
+
+TEST(UniformLayoutTest, ValidatesAgainstLinkedBlock) {
+	const auto expected = kStd140.toBlock("Light");
+	auto linked = expected;
+	EXPECT_NO_THROW(validateUniformBlock(expected, linked));
+
+	linked.members[1].offset = 68;
+	EXPECT_THROW(validateUniformBlock(expected, linked), std::invalid_argument);
+
+	// Un miembro del shader que la descripción no cubre
+	linked = expected;
+	ProgramReflection::Uniform extra;
+	extra.name = "extra";
+	extra.hash = hashName(extra.name);
+	linked.members.push_back(extra);
+	EXPECT_THROW(validateUniformBlock(expected, linked), std::invalid_argument);
+}
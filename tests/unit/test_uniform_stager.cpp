@@ -0,0 +1,141 @@
+#include <gmock/gmock.h>
+#include <PGRenderCore/uniformStager.h>
+#include "fakeContext.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+using namespace ::testing;
+using namespace pgrender;
+using pgrender::fakes::FakeBuffer;
+using pgrender::fakes::FakeContext;
+
+namespace {
+
+	constexpr UniformMember kObjectMembers[] = {
+		uniformMember<glm::vec4>("color"),
+		uniformMember<float>("alpha"),
+	};
+
+	constexpr auto kObjectBlock = describeUniformBlock(BlockLayout::Std140, kObjectMembers);
+
+	UniformStager::Desc stagerDesc(size_t frameCapacity, uint32_t framesInFlight = 3) {
+		UniformStager::Desc desc;
+		desc.frameCapacity = frameCapacity;
+		desc.framesInFlight = framesInFlight;
+		return desc;
+	}
+
+	FakeBuffer& fakeBuffer(const UniformStager& stager) {
+		return static_cast<FakeBuffer&>(*stager.getBuffer());
+	}
+
+}
+
+TEST(UniformStagerTest, RejectsEmptyConfiguration) {
+	FakeContext context;
+	EXPECT_THROW(UniformStager(context, stagerDesc(0)), std::invalid_argument);
+	EXPECT_THROW(UniformStager(context, stagerDesc(1024, 0)), std::invalid_argument);
+}
+
+TEST(UniformStagerTest, SizesBufferForEveryFrameInFlight) {
+	FakeContext context;
+	UniformStager stager(context, stagerDesc(1000, 3));
+
+	// Cada región se redondea a la alineación de offsets
+	EXPECT_EQ(stager.getBuffer()->getSize(), 3u * 1024u);
+}
+
+TEST(UniformStagerTest, AlignsBlocksAndUploadsThemTogether) {
+	FakeContext context;
+	UniformStager stager(context, stagerDesc(1024));
+	const uint32_t values[3] = { 1, 2, 3 };
+
+	UniformStager::Allocation blocks[3];
+	for (int i = 0; i < 3; ++i) {
+		blocks[i] = stager.push(&values[i], sizeof(uint32_t));
+		EXPECT_EQ(blocks[i].offset, i * 256u);
+		EXPECT_EQ(blocks[i].size, sizeof(uint32_t));
+	}
+	stager.bind(2, blocks);
+
+	// Un único tramo contiguo, relleno de alineación incluido
+	FakeBuffer& buffer = fakeBuffer(stager);
+	EXPECT_THAT(buffer.updates, ElementsAre(std::pair<size_t, size_t>(0, 516)));
+	uint32_t uploaded = 0;
+	std::memcpy(&uploaded, buffer.data.data() + 512, sizeof(uploaded));
+	EXPECT_EQ(uploaded, 3u);
+
+	for (uint32_t i = 0; i < 3; ++i) {
+		const BufferRange& range = context.boundUniformRanges.at(2 + i);
+		EXPECT_EQ(range.buffer, stager.getBuffer());
+		EXPECT_EQ(range.offset, i * 256u);
+		EXPECT_EQ(range.size, sizeof(uint32_t));
+	}
+	EXPECT_EQ(stager.getStatistics().blocks, 3u);
+	EXPECT_EQ(stager.getStatistics().uploads, 1u);
+	EXPECT_EQ(stager.getStatistics().bindCalls, 1u);
+}
+
+TEST(UniformStagerTest, UploadsOnlyBlocksAddedSinceLastBind) {
+	FakeContext context;
+	context.uniformBufferOffsetAlignment = 64;
+	UniformStager stager(context, stagerDesc(1024));
+	const float value = 1.0f;
+
+	stager.bind(0, stager.push(&value, sizeof(value)));
+	stager.bind(0, stager.push(&value, sizeof(value)));
+	stager.upload();    // Sin bloques nuevos no sube nada
+
+	EXPECT_THAT(fakeBuffer(stager).updates, ElementsAre(
+		std::pair<size_t, size_t>(0, 4),
+		std::pair<size_t, size_t>(4, 64)));
+	EXPECT_EQ(context.boundUniformRanges.at(0).offset, 64u);
+}
+
+TEST(UniformStagerTest, WritesLayoutBlocksThroughWriter) {
+	FakeContext context;
+	UniformStager stager(context, stagerDesc(1024));
+	const auto layout = kObjectBlock.toBlock("Object");
+
+	auto object = stager.allocate(layout);
+	object.writer.set("alpha", 0.5f);
+	stager.bind(0, object);
+
+	EXPECT_EQ(object.size, layout.dataSize);
+	float alpha = 0.0f;
+	std::memcpy(&alpha, fakeBuffer(stager).data.data() + object.offset + kObjectBlock.offsetOf("alpha"), sizeof(alpha));
+	EXPECT_EQ(alpha, 0.5f);
+	EXPECT_THROW(stager.push(&alpha, 0), std::invalid_argument);
+}
+
+TEST(UniformStagerTest, CyclesThroughFrameRegions) {
+	FakeContext context;
+	UniformStager stager(context, stagerDesc(1024, 3));
+	const uint32_t value = 7;
+
+	// Cada frame escribe en su región; al cuarto se vuelve a la primera
+	for (size_t frame = 0; frame < 4; ++frame) {
+		const auto block = stager.push(&value, sizeof(value));
+		EXPECT_EQ(block.offset, (frame % 3) * 1024u);
+		stager.upload();
+		EXPECT_EQ(fakeBuffer(stager).updates.back().first, (frame % 3) * 1024u);
+		stager.beginFrame();
+		EXPECT_EQ(stager.getStatistics().blocks, 0u);
+	}
+}
+
+TEST(UniformStagerTest, ThrowsWhenFrameIsFull) {
+	FakeContext context;
+	UniformStager stager(context, stagerDesc(512));
+	const uint8_t block[256] = {};
+
+	stager.push(block, sizeof(block));
+	stager.push(block, sizeof(block));
+	EXPECT_THROW(stager.push(block, 1), std::runtime_error);
+
+	// La siguiente región está vacía
+	stager.beginFrame();
+	EXPECT_EQ(stager.push(block, sizeof(block)).offset, 512u);
+}